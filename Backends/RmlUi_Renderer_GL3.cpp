@@ -86,6 +86,20 @@ void main() {
 	finalColor = fragColor * texColor;
 }
 )";
+static const char* shader_main_fragment_distance_field = RMLUI_SHADER_HEADER R"(
+uniform sampler2D _tex;
+in vec2 fragTexCoord;
+in vec4 fragColor;
+
+out vec4 finalColor;
+
+void main() {
+	float distance = texture(_tex, fragTexCoord).a;
+	float width = 0.5 * fwidth(distance);
+	float alpha = smoothstep(0.5 - width, 0.5 + width, distance);
+	finalColor = vec4(fragColor.rgb, fragColor.a * alpha);
+}
+)";
 static const char* shader_main_fragment_color = RMLUI_SHADER_HEADER R"(
 in vec2 fragTexCoord;
 in vec4 fragColor;
@@ -121,9 +135,11 @@ struct ProgramData {
 struct ShadersData {
 	ProgramData program_color;
 	ProgramData program_texture;
+	ProgramData program_distance_field;
 	GLuint shader_main_vertex;
 	GLuint shader_main_fragment_color;
 	GLuint shader_main_fragment_texture;
+	GLuint shader_main_fragment_distance_field;
 };
 
 static void CheckGLError(const char* operation_name)
@@ -267,6 +283,7 @@ static bool CreateShaders(ShadersData& out_shaders)
 	GLuint& main_vertex = out_shaders.shader_main_vertex;
 	GLuint& main_fragment_color = out_shaders.shader_main_fragment_color;
 	GLuint& main_fragment_texture = out_shaders.shader_main_fragment_texture;
+	GLuint& main_fragment_distance_field = out_shaders.shader_main_fragment_distance_field;
 
 	main_vertex = CreateShader(GL_VERTEX_SHADER, shader_main_vertex);
 	if (!main_vertex)
@@ -286,6 +303,12 @@ static bool CreateShaders(ShadersData& out_shaders)
 		Rml::Log::Message(Rml::Log::LT_ERROR, "Could not create OpenGL shader: 'shader_main_fragment_texture'.");
 		return false;
 	}
+	main_fragment_distance_field = CreateShader(GL_FRAGMENT_SHADER, shader_main_fragment_distance_field);
+	if (!main_fragment_distance_field)
+	{
+		Rml::Log::Message(Rml::Log::LT_ERROR, "Could not create OpenGL shader: 'shader_main_fragment_distance_field'.");
+		return false;
+	}
 
 	if (!CreateProgram(main_vertex, main_fragment_color, out_shaders.program_color))
 	{
@@ -297,6 +320,11 @@ static bool CreateShaders(ShadersData& out_shaders)
 		Rml::Log::Message(Rml::Log::LT_ERROR, "Could not create OpenGL program: 'program_texture'.");
 		return false;
 	}
+	if (!CreateProgram(main_vertex, main_fragment_distance_field, out_shaders.program_distance_field))
+	{
+		Rml::Log::Message(Rml::Log::LT_ERROR, "Could not create OpenGL program: 'program_distance_field'.");
+		return false;
+	}
 
 	return true;
 }
@@ -305,10 +333,12 @@ static void DestroyShaders(ShadersData& shaders)
 {
 	glDeleteProgram(shaders.program_color.id);
 	glDeleteProgram(shaders.program_texture.id);
+	glDeleteProgram(shaders.program_distance_field.id);
 
 	glDeleteShader(shaders.shader_main_vertex);
 	glDeleteShader(shaders.shader_main_fragment_color);
 	glDeleteShader(shaders.shader_main_fragment_texture);
+	glDeleteShader(shaders.shader_main_fragment_distance_field);
 
 	shaders = {};
 }
@@ -509,7 +539,14 @@ void RenderInterface_GL3::RenderCompiledGeometry(Rml::CompiledGeometryHandle han
 {
 	Gfx::CompiledGeometryData* geometry = (Gfx::CompiledGeometryData*)handle;
 
-	if (geometry->texture)
+	if (geometry->texture && distance_field_textures.count(geometry->texture))
+	{
+		glUseProgram(shaders->program_distance_field.id);
+		glBindTexture(GL_TEXTURE_2D, (GLuint)geometry->texture);
+		SubmitTransformUniform(ProgramId::DistanceField, shaders->program_distance_field.uniform_locations[(size_t)Gfx::ProgramUniform::Transform]);
+		glUniform2fv(shaders->program_distance_field.uniform_locations[(size_t)Gfx::ProgramUniform::Translate], 1, &translation.x);
+	}
+	else if (geometry->texture)
 	{
 		glUseProgram(shaders->program_texture.id);
 		if (geometry->texture != TextureEnableWithoutBinding)
@@ -741,8 +778,28 @@ bool RenderInterface_GL3::GenerateTexture(Rml::TextureHandle& texture_handle, co
 	return true;
 }
 
+bool RenderInterface_GL3::GenerateDistanceFieldTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source,
+	const Rml::Vector2i& source_dimensions)
+{
+	if (!GenerateTexture(texture_handle, source, source_dimensions))
+		return false;
+
+	distance_field_textures.insert(texture_handle);
+	return true;
+}
+
+bool RenderInterface_GL3::UpdateTexture(Rml::TextureHandle texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions)
+{
+	glBindTexture(GL_TEXTURE_2D, (GLuint)texture_handle);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, source_dimensions.x, source_dimensions.y, GL_RGBA, GL_UNSIGNED_BYTE, source);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	return true;
+}
+
 void RenderInterface_GL3::ReleaseTexture(Rml::TextureHandle texture_handle)
 {
+	distance_field_textures.erase(texture_handle);
 	glDeleteTextures(1, (GLuint*)&texture_handle);
 }
 
@@ -69,6 +69,8 @@ public:
 
 	bool LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& source) override;
 	bool GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
+	bool GenerateDistanceFieldTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
+	bool UpdateTexture(Rml::TextureHandle texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
 	void ReleaseTexture(Rml::TextureHandle texture_handle) override;
 
 	void SetTransform(const Rml::Matrix4f* transform) override;
@@ -77,7 +79,7 @@ public:
 	static const Rml::TextureHandle TextureEnableWithoutBinding = Rml::TextureHandle(-1);
 
 private:
-	enum class ProgramId { None, Texture = 1, Color = 2, All = (Texture | Color) };
+	enum class ProgramId { None, Texture = 1, Color = 2, DistanceField = 4, All = (Texture | Color | DistanceField) };
 	void SubmitTransformUniform(ProgramId program_id, int uniform_location);
 
 	Rml::Matrix4f transform, projection;
@@ -92,6 +94,9 @@ private:
 
 	Rml::UniquePtr<Gfx::ShadersData> shaders;
 
+	// Textures generated with GenerateDistanceFieldTexture(), rendered with the distance-field program.
+	Rml::UnorderedSet<Rml::TextureHandle> distance_field_textures;
+
 	struct GLStateBackup {
 		bool enable_cull_face;
 		bool enable_blend;
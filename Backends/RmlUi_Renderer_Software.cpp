@@ -0,0 +1,552 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "RmlUi_Renderer_Software.h"
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/FileInterface.h>
+#include <RmlUi/Core/Log.h>
+#include <RmlUi/Core/StringUtilities.h>
+#include <algorithm>
+#include <math.h>
+#include <string.h>
+
+#ifdef RMLUI_RENDERER_SOFTWARE_LODEPNG
+	#include <lodepng.h>
+#endif
+
+// Vertex positions are snapped to a fixed-point grid, so that the coverage tests are exact and pixels on edges shared between triangles are
+// filled exactly once.
+static constexpr int subpixel_bits = 8;
+static constexpr int64_t subpixel_scale = int64_t(1) << subpixel_bits;
+
+static int64_t FloorDivide(int64_t value, int64_t divisor)
+{
+	return value >= 0 ? value / divisor : -((-value + divisor - 1) / divisor);
+}
+
+// Returns twice the signed area of the triangle (a, b, p), positive when 'p' lies to the right of the edge from 'a' to 'b' in screen space.
+template <typename T>
+static int64_t EdgeFunction(const T& a, const T& b, int64_t px, int64_t py)
+{
+	return (b.x - a.x) * (py - a.y) - (b.y - a.y) * (px - a.x);
+}
+
+// Tie-breaking rule for pixels exactly on an edge. Exactly one of the two triangles sharing an edge traverses it in the owning direction.
+template <typename T>
+static int64_t EdgeBias(const T& a, const T& b)
+{
+	const int64_t dx = b.x - a.x;
+	const int64_t dy = b.y - a.y;
+	const bool owns_edge = (dy > 0 || (dy == 0 && dx < 0));
+	return owns_edge ? 0 : 1;
+}
+
+// Bilinear sampling with clamp-to-edge addressing, matching the OpenGL renderers. Returns the texel in the range [0, 255].
+static void SampleTexture(const Rml::byte* data, Rml::Vector2i dimensions, float u, float v, float out_texel[4])
+{
+	const float x = u * float(dimensions.x) - 0.5f;
+	const float y = v * float(dimensions.y) - 0.5f;
+	const float x_floor = floorf(x);
+	const float y_floor = floorf(y);
+	const float tx = x - x_floor;
+	const float ty = y - y_floor;
+
+	const int x0 = Rml::Math::Clamp(int(x_floor), 0, dimensions.x - 1);
+	const int x1 = Rml::Math::Clamp(int(x_floor) + 1, 0, dimensions.x - 1);
+	const int y0 = Rml::Math::Clamp(int(y_floor), 0, dimensions.y - 1);
+	const int y1 = Rml::Math::Clamp(int(y_floor) + 1, 0, dimensions.y - 1);
+
+	const Rml::byte* p00 = data + 4 * (y0 * dimensions.x + x0);
+	const Rml::byte* p10 = data + 4 * (y0 * dimensions.x + x1);
+	const Rml::byte* p01 = data + 4 * (y1 * dimensions.x + x0);
+	const Rml::byte* p11 = data + 4 * (y1 * dimensions.x + x1);
+
+	for (int i = 0; i < 4; i++)
+	{
+		const float top = float(p00[i]) + (float(p10[i]) - float(p00[i])) * tx;
+		const float bottom = float(p01[i]) + (float(p11[i]) - float(p01[i])) * tx;
+		out_texel[i] = top + (bottom - top) * ty;
+	}
+}
+
+// Returns the alpha of a distance-field texel in the range [0, 255], by a smooth step one pixel wide across the edge at half the distance range.
+static float SampleDistanceField(const Rml::byte* data, Rml::Vector2i dimensions, Rml::Vector2f tex_coord, Rml::Vector2f tex_coord_step_x,
+	Rml::Vector2f tex_coord_step_y, float distance)
+{
+	float texel_x[4], texel_y[4];
+	SampleTexture(data, dimensions, tex_coord.x + tex_coord_step_x.x, tex_coord.y + tex_coord_step_x.y, texel_x);
+	SampleTexture(data, dimensions, tex_coord.x + tex_coord_step_y.x, tex_coord.y + tex_coord_step_y.y, texel_y);
+
+	const float value = distance * (1.f / 255.f);
+	const float width = 0.5f * (fabsf(texel_x[3] - distance) + fabsf(texel_y[3] - distance)) * (1.f / 255.f);
+	if (width <= 0.f)
+		return value >= 0.5f ? 255.f : 0.f;
+
+	const float t = Rml::Math::Clamp((value - (0.5f - width)) / (2.f * width), 0.f, 1.f);
+	return 255.f * t * t * (3.f - 2.f * t);
+}
+
+RenderInterface_Software::RenderInterface_Software(int viewport_width, int viewport_height)
+{
+	SetViewport(viewport_width, viewport_height);
+}
+
+RenderInterface_Software::~RenderInterface_Software() {}
+
+void RenderInterface_Software::SetViewport(int in_viewport_width, int in_viewport_height)
+{
+	viewport_width = Rml::Math::Max(in_viewport_width, 0);
+	viewport_height = Rml::Math::Max(in_viewport_height, 0);
+
+	framebuffer.assign(size_t(viewport_width) * size_t(viewport_height) * 4, 0);
+	pixel_write_counts.assign(size_t(viewport_width) * size_t(viewport_height), 0);
+}
+
+void RenderInterface_Software::BeginFrame()
+{
+	std::fill(framebuffer.begin(), framebuffer.end(), Rml::byte(0));
+	std::fill(pixel_write_counts.begin(), pixel_write_counts.end(), uint16_t(0));
+
+	statistics = {};
+	scissor_enabled = false;
+	transform_enabled = false;
+	state_dirty = true;
+	previous_texture = 0;
+}
+
+void RenderInterface_Software::EndFrame() {}
+
+const RenderInterface_Software::Statistics& RenderInterface_Software::GetStatistics() const
+{
+	return statistics;
+}
+
+Rml::Vector2i RenderInterface_Software::GetViewportDimensions() const
+{
+	return Rml::Vector2i(viewport_width, viewport_height);
+}
+
+const Rml::byte* RenderInterface_Software::GetFramebuffer() const
+{
+	return framebuffer.data();
+}
+
+int RenderInterface_Software::GetPixelWriteCount(int x, int y) const
+{
+	if (x < 0 || y < 0 || x >= viewport_width || y >= viewport_height)
+		return 0;
+	return pixel_write_counts[size_t(y) * size_t(viewport_width) + size_t(x)];
+}
+
+#ifdef RMLUI_RENDERER_SOFTWARE_LODEPNG
+bool RenderInterface_Software::SaveFramebuffer(const Rml::String& path) const
+{
+	const unsigned int result = lodepng_encode32_file(path.c_str(), framebuffer.data(), (unsigned int)viewport_width, (unsigned int)viewport_height);
+	if (result)
+	{
+		Rml::Log::Message(Rml::Log::LT_ERROR, "Could not write framebuffer to %s: %s", path.c_str(), lodepng_error_text(result));
+		return false;
+	}
+	return true;
+}
+#endif
+
+void RenderInterface_Software::RenderGeometry(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices, Rml::TextureHandle texture,
+	const Rml::Vector2f& translation)
+{
+	RenderTriangles(vertices, num_vertices, indices, num_indices, texture, translation);
+}
+
+struct CompiledGeometry_Software {
+	Rml::Vector<Rml::Vertex> vertices;
+	Rml::Vector<int> indices;
+	Rml::TextureHandle texture;
+};
+
+Rml::CompiledGeometryHandle RenderInterface_Software::CompileGeometry(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices,
+	Rml::TextureHandle texture)
+{
+	CompiledGeometry_Software* geometry = new CompiledGeometry_Software;
+	geometry->vertices.assign(vertices, vertices + num_vertices);
+	geometry->indices.assign(indices, indices + num_indices);
+	geometry->texture = texture;
+	return reinterpret_cast<Rml::CompiledGeometryHandle>(geometry);
+}
+
+void RenderInterface_Software::RenderCompiledGeometry(Rml::CompiledGeometryHandle handle, const Rml::Vector2f& translation)
+{
+	const CompiledGeometry_Software* geometry = reinterpret_cast<const CompiledGeometry_Software*>(handle);
+	RenderTriangles(geometry->vertices.data(), (int)geometry->vertices.size(), geometry->indices.data(), (int)geometry->indices.size(),
+		geometry->texture, translation);
+}
+
+void RenderInterface_Software::ReleaseCompiledGeometry(Rml::CompiledGeometryHandle handle)
+{
+	delete reinterpret_cast<CompiledGeometry_Software*>(handle);
+}
+
+void RenderInterface_Software::EnableScissorRegion(bool enable)
+{
+	if (enable != scissor_enabled)
+		state_dirty = true;
+	scissor_enabled = enable;
+}
+
+void RenderInterface_Software::SetScissorRegion(int x, int y, int width, int height)
+{
+	const Rml::Rectanglei region = Rml::Rectanglei::FromPositionSize({x, y}, {Rml::Math::Max(width, 0), Rml::Math::Max(height, 0)});
+	if (region != scissor_region)
+		state_dirty = true;
+	scissor_region = region;
+}
+
+// Set to byte packing, or the compiler will expand our struct, which means it won't read correctly from file
+#pragma pack(1)
+struct TGAHeader {
+	char idLength;
+	char colourMapType;
+	char dataType;
+	short int colourMapOrigin;
+	short int colourMapLength;
+	char colourMapDepth;
+	short int xOrigin;
+	short int yOrigin;
+	short int width;
+	short int height;
+	char bitsPerPixel;
+	char imageDescriptor;
+};
+// Restore packing
+#pragma pack()
+
+bool RenderInterface_Software::LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& source)
+{
+	Rml::FileInterface* file_interface = Rml::GetFileInterface();
+	Rml::FileHandle file_handle = file_interface->Open(source);
+	if (!file_handle)
+		return false;
+
+	file_interface->Seek(file_handle, 0, SEEK_END);
+	const size_t buffer_size = file_interface->Tell(file_handle);
+	file_interface->Seek(file_handle, 0, SEEK_SET);
+
+	Rml::Vector<Rml::byte> buffer(buffer_size);
+	file_interface->Read(buffer.data(), buffer_size, file_handle);
+	file_interface->Close(file_handle);
+
+#ifdef RMLUI_RENDERER_SOFTWARE_LODEPNG
+	const Rml::String extension = Rml::StringUtilities::ToLower(source.substr(source.rfind('.') + 1));
+	if (extension == "png")
+	{
+		unsigned char* image = nullptr;
+		unsigned int width = 0, height = 0;
+		const unsigned int result = lodepng_decode32(&image, &width, &height, buffer.data(), buffer.size());
+		if (result)
+		{
+			Rml::Log::Message(Rml::Log::LT_ERROR, "Could not decode PNG image %s: %s", source.c_str(), lodepng_error_text(result));
+			return false;
+		}
+
+		texture_dimensions = Rml::Vector2i(int(width), int(height));
+		const bool success = GenerateTexture(texture_handle, image, texture_dimensions);
+		free(image);
+		return success;
+	}
+#endif
+
+	if (buffer_size <= sizeof(TGAHeader))
+	{
+		Rml::Log::Message(Rml::Log::LT_ERROR, "Texture file size is smaller than TGAHeader, file is not a valid TGA image.");
+		return false;
+	}
+
+	TGAHeader header;
+	memcpy(&header, buffer.data(), sizeof(TGAHeader));
+
+	const int color_mode = header.bitsPerPixel / 8;
+	const size_t image_size = size_t(header.width) * size_t(header.height) * 4; // We always make 32bit textures
+
+	if (header.dataType != 2)
+	{
+		Rml::Log::Message(Rml::Log::LT_ERROR, "Only 24/32bit uncompressed TGAs are supported.");
+		return false;
+	}
+
+	// Ensure we have at least 3 colors
+	if (color_mode < 3)
+	{
+		Rml::Log::Message(Rml::Log::LT_ERROR, "Only 24 and 32bit textures are supported.");
+		return false;
+	}
+
+	if (buffer_size < sizeof(TGAHeader) + size_t(header.width) * size_t(header.height) * size_t(color_mode))
+	{
+		Rml::Log::Message(Rml::Log::LT_ERROR, "TGA image %s is truncated.", source.c_str());
+		return false;
+	}
+
+	const Rml::byte* image_src = buffer.data() + sizeof(TGAHeader);
+	Rml::Vector<Rml::byte> image_dest(image_size);
+
+	// Targa is BGR, swap to RGB and flip Y axis
+	for (long y = 0; y < header.height; y++)
+	{
+		long read_index = y * header.width * color_mode;
+		long write_index = ((header.imageDescriptor & 32) != 0) ? y * header.width * 4 : (header.height - y - 1) * header.width * 4;
+		for (long x = 0; x < header.width; x++)
+		{
+			image_dest[write_index] = image_src[read_index + 2];
+			image_dest[write_index + 1] = image_src[read_index + 1];
+			image_dest[write_index + 2] = image_src[read_index];
+			if (color_mode == 4)
+				image_dest[write_index + 3] = image_src[read_index + 3];
+			else
+				image_dest[write_index + 3] = 255;
+
+			write_index += 4;
+			read_index += color_mode;
+		}
+	}
+
+	texture_dimensions.x = header.width;
+	texture_dimensions.y = header.height;
+
+	return GenerateTexture(texture_handle, image_dest.data(), texture_dimensions);
+}
+
+bool RenderInterface_Software::GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions)
+{
+	if (source_dimensions.x <= 0 || source_dimensions.y <= 0)
+		return false;
+
+	Texture* texture = new Texture;
+	texture->dimensions = source_dimensions;
+	texture->data.assign(source, source + size_t(source_dimensions.x) * size_t(source_dimensions.y) * 4);
+
+	texture_handle = reinterpret_cast<Rml::TextureHandle>(texture);
+	return true;
+}
+
+bool RenderInterface_Software::GenerateDistanceFieldTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source,
+	const Rml::Vector2i& source_dimensions)
+{
+	if (!GenerateTexture(texture_handle, source, source_dimensions))
+		return false;
+
+	reinterpret_cast<Texture*>(texture_handle)->distance_field = true;
+	return true;
+}
+
+bool RenderInterface_Software::UpdateTexture(Rml::TextureHandle texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions)
+{
+	Texture* texture = reinterpret_cast<Texture*>(texture_handle);
+	if (!texture || texture->dimensions != source_dimensions)
+		return false;
+
+	memcpy(texture->data.data(), source, texture->data.size());
+	return true;
+}
+
+void RenderInterface_Software::ReleaseTexture(Rml::TextureHandle texture_handle)
+{
+	delete reinterpret_cast<Texture*>(texture_handle);
+}
+
+void RenderInterface_Software::SetTransform(const Rml::Matrix4f* new_transform)
+{
+	if (new_transform || transform_enabled)
+		state_dirty = true;
+
+	transform_enabled = (new_transform != nullptr);
+	if (new_transform)
+		transform = *new_transform;
+}
+
+void RenderInterface_Software::RenderTriangles(const Rml::Vertex* vertices, int num_vertices, const int* indices, int num_indices,
+	Rml::TextureHandle texture_handle, Rml::Vector2f translation)
+{
+	statistics.draw_calls += 1;
+	if (state_dirty || texture_handle != previous_texture)
+		statistics.state_changes += 1;
+	state_dirty = false;
+	previous_texture = texture_handle;
+
+	statistics.triangles += num_indices / 3;
+
+	Rml::Rectanglei bounds = Rml::Rectanglei::FromSize({viewport_width, viewport_height});
+	if (scissor_enabled)
+		bounds.Intersect(scissor_region);
+	if (bounds.Width() <= 0 || bounds.Height() <= 0)
+		return;
+
+	// Transform the vertices to fixed-point screen coordinates.
+	screen_vertices.resize(num_vertices);
+	for (int i = 0; i < num_vertices; i++)
+	{
+		Rml::Vector2f position = vertices[i].position + translation;
+		if (transform_enabled)
+		{
+			const Rml::Vector4f projected = transform * Rml::Vector4f(position.x, position.y, 0.f, 1.f);
+			position = Rml::Vector2f(projected.x, projected.y) / projected.w;
+		}
+
+		ScreenVertex& vertex = screen_vertices[i];
+		vertex.x = int64_t(roundf(position.x * float(subpixel_scale)));
+		vertex.y = int64_t(roundf(position.y * float(subpixel_scale)));
+		vertex.colour = vertices[i].colour;
+		vertex.tex_coord = vertices[i].tex_coord;
+	}
+
+	const Texture* texture = reinterpret_cast<const Texture*>(texture_handle);
+	for (int i = 0; i + 2 < num_indices; i += 3)
+		RasterizeTriangle(screen_vertices[indices[i]], screen_vertices[indices[i + 1]], screen_vertices[indices[i + 2]], texture, bounds);
+}
+
+void RenderInterface_Software::RasterizeTriangle(const ScreenVertex& v0, const ScreenVertex& v1, const ScreenVertex& v2, const Texture* texture,
+	Rml::Rectanglei bounds)
+{
+	// Orient the triangle so that its interior is on the positive side of all edges.
+	const ScreenVertex* a = &v0;
+	const ScreenVertex* b = &v1;
+	const ScreenVertex* c = &v2;
+	int64_t area = EdgeFunction(*a, *b, c->x, c->y);
+	if (area == 0)
+		return;
+	if (area < 0)
+	{
+		std::swap(b, c);
+		area = -area;
+	}
+
+	// Find the pixels whose centers may be covered by the triangle, restricted to the bounds.
+	const int64_t min_x = std::min({a->x, b->x, c->x});
+	const int64_t max_x = std::max({a->x, b->x, c->x});
+	const int64_t min_y = std::min({a->y, b->y, c->y});
+	const int64_t max_y = std::max({a->y, b->y, c->y});
+
+	const int x_begin = (int)Rml::Math::Max(int64_t(bounds.Left()), FloorDivide(min_x, subpixel_scale));
+	const int x_end = (int)Rml::Math::Min(int64_t(bounds.Right()), FloorDivide(max_x, subpixel_scale) + 1);
+	const int y_begin = (int)Rml::Math::Max(int64_t(bounds.Top()), FloorDivide(min_y, subpixel_scale));
+	const int y_end = (int)Rml::Math::Min(int64_t(bounds.Bottom()), FloorDivide(max_y, subpixel_scale) + 1);
+	if (x_begin >= x_end || y_begin >= y_end)
+		return;
+
+	// Evaluate the edge functions at the center of the first pixel, and step them incrementally from there.
+	const int64_t px = int64_t(x_begin) * subpixel_scale + subpixel_scale / 2;
+	const int64_t py = int64_t(y_begin) * subpixel_scale + subpixel_scale / 2;
+
+	int64_t w0_row = EdgeFunction(*b, *c, px, py);
+	int64_t w1_row = EdgeFunction(*c, *a, px, py);
+	int64_t w2_row = EdgeFunction(*a, *b, px, py);
+
+	const int64_t w0_step_x = -(c->y - b->y) * subpixel_scale, w0_step_y = (c->x - b->x) * subpixel_scale;
+	const int64_t w1_step_x = -(a->y - c->y) * subpixel_scale, w1_step_y = (a->x - c->x) * subpixel_scale;
+	const int64_t w2_step_x = -(b->y - a->y) * subpixel_scale, w2_step_y = (b->x - a->x) * subpixel_scale;
+
+	const int64_t bias0 = EdgeBias(*b, *c);
+	const int64_t bias1 = EdgeBias(*c, *a);
+	const int64_t bias2 = EdgeBias(*a, *b);
+
+	const float inv_area = 1.f / float(area);
+	const bool uniform_colour = (a->colour == b->colour && a->colour == c->colour);
+
+	// Distance fields are sampled like the 'fwidth' function in shaders, by the change in distance between neighboring pixels. The texture
+	// coordinates change linearly across the triangle, thus the offsets to the neighboring pixels are constant.
+	Rml::Vector2f tex_coord_step_x, tex_coord_step_y;
+	if (texture && texture->distance_field)
+	{
+		const float l0_step_x = float(w0_step_x) * inv_area, l1_step_x = float(w1_step_x) * inv_area;
+		const float l0_step_y = float(w0_step_y) * inv_area, l1_step_y = float(w1_step_y) * inv_area;
+		tex_coord_step_x = (a->tex_coord - c->tex_coord) * l0_step_x + (b->tex_coord - c->tex_coord) * l1_step_x;
+		tex_coord_step_y = (a->tex_coord - c->tex_coord) * l0_step_y + (b->tex_coord - c->tex_coord) * l1_step_y;
+	}
+
+	for (int y = y_begin; y < y_end; y++)
+	{
+		int64_t w0 = w0_row, w1 = w1_row, w2 = w2_row;
+
+		for (int x = x_begin; x < x_end; x++)
+		{
+			if (w0 >= bias0 && w1 >= bias1 && w2 >= bias2)
+			{
+				const float l0 = float(w0) * inv_area;
+				const float l1 = float(w1) * inv_area;
+				const float l2 = 1.f - l0 - l1;
+
+				float fragment[4];
+				if (uniform_colour)
+				{
+					for (int i = 0; i < 4; i++)
+						fragment[i] = float(a->colour[i]);
+				}
+				else
+				{
+					for (int i = 0; i < 4; i++)
+						fragment[i] = float(a->colour[i]) * l0 + float(b->colour[i]) * l1 + float(c->colour[i]) * l2;
+				}
+
+				if (texture)
+				{
+					const Rml::Vector2f tex_coord = a->tex_coord * l0 + b->tex_coord * l1 + c->tex_coord * l2;
+					float texel[4];
+					SampleTexture(texture->data.data(), texture->dimensions, tex_coord.x, tex_coord.y, texel);
+					if (texture->distance_field)
+						texel[3] =
+							SampleDistanceField(texture->data.data(), texture->dimensions, tex_coord, tex_coord_step_x, tex_coord_step_y, texel[3]);
+					for (int i = 0; i < 4; i++)
+						fragment[i] *= texel[i] * (1.f / 255.f);
+				}
+
+				// Blend with straight alpha, equivalent to glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA).
+				const size_t pixel_index = size_t(y) * size_t(viewport_width) + size_t(x);
+				Rml::byte* destination = framebuffer.data() + 4 * pixel_index;
+				const float alpha = Rml::Math::Clamp(fragment[3] * (1.f / 255.f), 0.f, 1.f);
+				for (int i = 0; i < 4; i++)
+				{
+					const float value = fragment[i] * alpha + float(destination[i]) * (1.f - alpha);
+					destination[i] = Rml::byte(Rml::Math::Clamp(value + 0.5f, 0.f, 255.f));
+				}
+
+				uint16_t& write_count = pixel_write_counts[pixel_index];
+				if (write_count > 0)
+					statistics.pixels_overdrawn += 1;
+				if (write_count < UINT16_MAX)
+					write_count += 1;
+				statistics.pixels_filled += 1;
+			}
+
+			w0 += w0_step_x;
+			w1 += w1_step_x;
+			w2 += w2_step_x;
+		}
+
+		w0_row += w0_step_y;
+		w1_row += w1_step_y;
+		w2_row += w2_step_y;
+	}
+}
@@ -0,0 +1,144 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_BACKENDS_RENDERER_SOFTWARE_H
+#define RMLUI_BACKENDS_RENDERER_SOFTWARE_H
+
+#include <RmlUi/Core/RenderInterface.h>
+#include <RmlUi/Core/Types.h>
+#include <stdint.h>
+
+/**
+    Headless renderer rasterizing on the CPU into an in-memory framebuffer, without any dependency on a window or graphics API.
+
+    Blending and texture filtering follow the OpenGL renderers, so that the framebuffer is comparable to what is displayed on screen. In
+    addition, the renderer collects statistics about the cost of each frame, such as overdraw and the number of pixels filled, which
+    makes it suitable for rendering benchmarks and tests on machines without a GPU.
+
+    Textures are loaded from uncompressed TGA files, and also PNG files when compiled with RMLUI_RENDERER_SOFTWARE_LODEPNG.
+ */
+
+class RenderInterface_Software : public Rml::RenderInterface {
+public:
+	struct Statistics {
+		// Number of geometry render calls, compiled or not.
+		int draw_calls = 0;
+		// Number of times the texture, scissor region, or transform was changed between two consecutive draw calls.
+		int state_changes = 0;
+		// Number of triangles submitted, including those culled by the scissor region or viewport.
+		int triangles = 0;
+		// Number of fragments written to the framebuffer.
+		int64_t pixels_filled = 0;
+		// Number of fragments written to pixels that were already written to during the frame.
+		int64_t pixels_overdrawn = 0;
+	};
+
+	RenderInterface_Software(int viewport_width, int viewport_height);
+	~RenderInterface_Software();
+
+	// Resizes and clears the framebuffer.
+	void SetViewport(int viewport_width, int viewport_height);
+
+	// Clears the framebuffer and resets the statistics and render state for a new frame.
+	void BeginFrame();
+	void EndFrame();
+
+	// Returns the statistics collected since the frame began.
+	const Statistics& GetStatistics() const;
+
+	Rml::Vector2i GetViewportDimensions() const;
+	// Returns the framebuffer as tightly packed rows of RGBA8 pixels with straight alpha, from top to bottom.
+	const Rml::byte* GetFramebuffer() const;
+	// Returns the number of fragments written to the given pixel since the frame began.
+	int GetPixelWriteCount(int x, int y) const;
+
+#ifdef RMLUI_RENDERER_SOFTWARE_LODEPNG
+	// Writes the framebuffer to a PNG file.
+	bool SaveFramebuffer(const Rml::String& path) const;
+#endif
+
+	// -- Inherited from Rml::RenderInterface --
+
+	void RenderGeometry(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices, Rml::TextureHandle texture,
+		const Rml::Vector2f& translation) override;
+
+	Rml::CompiledGeometryHandle CompileGeometry(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices,
+		Rml::TextureHandle texture) override;
+	void RenderCompiledGeometry(Rml::CompiledGeometryHandle geometry, const Rml::Vector2f& translation) override;
+	void ReleaseCompiledGeometry(Rml::CompiledGeometryHandle geometry) override;
+
+	void EnableScissorRegion(bool enable) override;
+	void SetScissorRegion(int x, int y, int width, int height) override;
+
+	bool LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& source) override;
+	bool GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
+	bool GenerateDistanceFieldTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
+	bool UpdateTexture(Rml::TextureHandle texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
+	void ReleaseTexture(Rml::TextureHandle texture_handle) override;
+
+	void SetTransform(const Rml::Matrix4f* transform) override;
+
+private:
+	struct Texture {
+		Rml::Vector2i dimensions;
+		Rml::Vector<Rml::byte> data;
+		// The alpha channel holds a signed distance field, see GenerateDistanceFieldTexture().
+		bool distance_field = false;
+	};
+
+	struct ScreenVertex {
+		// Position in 24.8 fixed-point pixel coordinates.
+		int64_t x, y;
+		Rml::Colourb colour;
+		Rml::Vector2f tex_coord;
+	};
+
+	void RenderTriangles(const Rml::Vertex* vertices, int num_vertices, const int* indices, int num_indices, Rml::TextureHandle texture,
+		Rml::Vector2f translation);
+	void RasterizeTriangle(const ScreenVertex& v0, const ScreenVertex& v1, const ScreenVertex& v2, const Texture* texture, Rml::Rectanglei bounds);
+
+	int viewport_width = 0;
+	int viewport_height = 0;
+	Rml::Vector<Rml::byte> framebuffer;
+	Rml::Vector<uint16_t> pixel_write_counts;
+
+	bool scissor_enabled = false;
+	Rml::Rectanglei scissor_region;
+
+	bool transform_enabled = false;
+	Rml::Matrix4f transform;
+
+	// Render state of the previous draw call, used to count state changes.
+	bool state_dirty = true;
+	Rml::TextureHandle previous_texture = 0;
+
+	Statistics statistics;
+	Rml::Vector<ScreenVertex> screen_vertices;
+};
+
+#endif
@@ -119,3 +119,10 @@ set(GLFW_VK_HDR_FILES
 	${PROJECT_SOURCE_DIR}/Backends/RmlUi_Platform_GLFW.h
 	${PROJECT_SOURCE_DIR}/Backends/RmlUi_Renderer_VK.h
 )
+
+set(Software_SRC_FILES
+	${PROJECT_SOURCE_DIR}/Backends/RmlUi_Renderer_Software.cpp
+)
+set(Software_HDR_FILES
+	${PROJECT_SOURCE_DIR}/Backends/RmlUi_Renderer_Software.h
+)
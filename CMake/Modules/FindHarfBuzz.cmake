@@ -0,0 +1,26 @@
+# Try to find HarfBuzz
+if (TARGET harfbuzz)
+	# This is for when HarfBuzz is added via an add_subdirectory
+	set(HARFBUZZ_LIBRARY harfbuzz)
+	get_target_property(HARFBUZZ_INCLUDE_DIR harfbuzz INTERFACE_INCLUDE_DIRECTORIES)
+
+	set(HARFBUZZ_LIBRARIES ${HARFBUZZ_LIBRARY} )
+	set(HARFBUZZ_INCLUDE_DIRS ${HARFBUZZ_INCLUDE_DIR} )
+else()
+	find_path(HARFBUZZ_INCLUDE_DIR hb.h
+			HINTS $ENV{HARFBUZZ_DIR}
+			PATH_SUFFIXES harfbuzz include/harfbuzz include )
+
+	find_library(HARFBUZZ_LIBRARY NAMES harfbuzz libharfbuzz
+				HINTS $ENV{HARFBUZZ_DIR} $ENV{HARFBUZZ_DIR}/build
+				PATH_SUFFIXES lib Release release )
+
+	include(FindPackageHandleStandardArgs)
+	find_package_handle_standard_args(HarfBuzz  DEFAULT_MSG
+									HARFBUZZ_LIBRARY HARFBUZZ_INCLUDE_DIR)
+
+	mark_as_advanced(HARFBUZZ_INCLUDE_DIR HARFBUZZ_LIBRARY )
+
+	set(HARFBUZZ_LIBRARIES ${HARFBUZZ_LIBRARY} )
+	set(HARFBUZZ_INCLUDE_DIRS ${HARFBUZZ_INCLUDE_DIR} )
+endif()
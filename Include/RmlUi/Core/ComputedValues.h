@@ -197,6 +197,64 @@ namespace Style {
 		float scrollbar_margin = 0.f;
 	};
 
+	/*
+	    A reference-counted, copy-on-write handle to a group of values. Copying the handle only shares the underlying block, which is cloned
+	    the first time a shared block is written to. Default-constructed handles all share a single block of default values.
+	*/
+	template <typename T>
+	class SharedValues {
+	public:
+		SharedValues() : block(GetDefaultBlock()) { block->num_references += 1; }
+		SharedValues(const SharedValues& other) : block(other.block) { block->num_references += 1; }
+		~SharedValues() { Release(); }
+
+		SharedValues& operator=(const SharedValues& other)
+		{
+			other.block->num_references += 1;
+			Release();
+			block = other.block;
+			return *this;
+		}
+
+		const T* operator->() const { return &block->values; }
+
+		// Returns the values for modification, first making a private copy if they are shared.
+		T& Write()
+		{
+			if (block->num_references > 1)
+			{
+				block->num_references -= 1;
+				block = new Block{block->values, 1};
+			}
+			return block->values;
+		}
+
+		bool IsSharedWith(const SharedValues& other) const { return block == other.block; }
+		bool IsDefault() const { return block == GetDefaultBlock(); }
+
+	private:
+		struct Block {
+			T values;
+			int num_references;
+		};
+
+		void Release()
+		{
+			block->num_references -= 1;
+			if (block->num_references == 0)
+				delete block;
+		}
+
+		static Block* GetDefaultBlock()
+		{
+			// The initial reference is never released, keeping the default block alive for the lifetime of the program.
+			static Block default_block{T(), 1};
+			return &default_block;
+		}
+
+		Block* block;
+	};
+
 	class ComputedValues : NonCopyMoveable {
 	public:
 		explicit ComputedValues(Element* element) : element(element) {}
@@ -241,40 +299,40 @@ namespace Style {
 		// -- Inherited --
 		String         font_family()      const;
 		String         cursor()           const;
-		FontFaceHandle font_face_handle() const { return inherited.font_face_handle; }
-		float          font_size()        const { return inherited.font_size; }
+		FontFaceHandle font_face_handle() const { return inherited->font_face_handle; }
+		float          font_size()        const { return inherited->font_size; }
 		float          letter_spacing()   const;
-		bool           has_font_effect()  const { return inherited.has_font_effect; }
-		FontStyle      font_style()       const { return inherited.font_style; }
-		FontWeight     font_weight()      const { return inherited.font_weight; }
-		PointerEvents  pointer_events()   const { return inherited.pointer_events; }
-		Focus          focus()            const { return inherited.focus; }
-		TextAlign      text_align()       const { return inherited.text_align; }
-		TextDecoration text_decoration()  const { return inherited.text_decoration; }
-		TextTransform  text_transform()   const { return inherited.text_transform; }
-		WhiteSpace     white_space()      const { return inherited.white_space; }
-		WordBreak      word_break()       const { return inherited.word_break; }
-		Colourb        color()            const { return inherited.color; }
-		float          opacity()          const { return inherited.opacity; }
-		LineHeight     line_height()      const { return LineHeight(inherited.line_height, inherited.line_height_inherit_type, inherited.line_height_inherit); }
+		bool           has_font_effect()  const { return inherited->has_font_effect; }
+		FontStyle      font_style()       const { return inherited->font_style; }
+		FontWeight     font_weight()      const { return inherited->font_weight; }
+		PointerEvents  pointer_events()   const { return inherited->pointer_events; }
+		Focus          focus()            const { return inherited->focus; }
+		TextAlign      text_align()       const { return inherited->text_align; }
+		TextDecoration text_decoration()  const { return inherited->text_decoration; }
+		TextTransform  text_transform()   const { return inherited->text_transform; }
+		WhiteSpace     white_space()      const { return inherited->white_space; }
+		WordBreak      word_break()       const { return inherited->word_break; }
+		Colourb        color()            const { return inherited->color; }
+		float          opacity()          const { return inherited->opacity; }
+		LineHeight     line_height()      const { return LineHeight(inherited->line_height, inherited->line_height_inherit_type, inherited->line_height_inherit); }
 
 		// -- Rare --
-		MinWidth          min_width()                  const { return LengthPercentage(rare.min_width_type, rare.min_width); }
-		MaxWidth          max_width()                  const { return LengthPercentage(rare.max_width_type, rare.max_width); }
-		MinHeight         min_height()                 const { return LengthPercentage(rare.min_height_type, rare.min_height); }
-		MinHeight         max_height()                 const { return LengthPercentage(rare.max_height_type, rare.max_height); }
-		VerticalAlign     vertical_align()             const { return VerticalAlign(rare.vertical_align_type, rare.vertical_align_length); }
+		MinWidth          min_width()                  const { return LengthPercentage(rare->min_width_type, rare->min_width); }
+		MaxWidth          max_width()                  const { return LengthPercentage(rare->max_width_type, rare->max_width); }
+		MinHeight         min_height()                 const { return LengthPercentage(rare->min_height_type, rare->min_height); }
+		MinHeight         max_height()                 const { return LengthPercentage(rare->max_height_type, rare->max_height); }
+		VerticalAlign     vertical_align()             const { return VerticalAlign(rare->vertical_align_type, rare->vertical_align_length); }
 		const             AnimationList* animation()   const;
 		const             TransitionList* transition() const;
-		float             perspective()                const { return rare.perspective; }
-		PerspectiveOrigin perspective_origin_x()       const { return LengthPercentage(rare.perspective_origin_x_type, rare.perspective_origin_x); }
-		PerspectiveOrigin perspective_origin_y()       const { return LengthPercentage(rare.perspective_origin_y_type, rare.perspective_origin_y); }
+		float             perspective()                const { return rare->perspective; }
+		PerspectiveOrigin perspective_origin_x()       const { return LengthPercentage(rare->perspective_origin_x_type, rare->perspective_origin_x); }
+		PerspectiveOrigin perspective_origin_y()       const { return LengthPercentage(rare->perspective_origin_y_type, rare->perspective_origin_y); }
 		TransformPtr      transform()                  const { return GetLocalProperty(PropertyId::Transform, TransformPtr()); }
-		TransformOrigin   transform_origin_x()         const { return LengthPercentage(rare.transform_origin_x_type, rare.transform_origin_x); }
-		TransformOrigin   transform_origin_y()         const { return LengthPercentage(rare.transform_origin_y_type, rare.transform_origin_y); }
-		float             transform_origin_z()         const { return rare.transform_origin_z; }
-		bool              has_local_transform()        const { return rare.has_local_transform; }
-		bool              has_local_perspective()      const { return rare.has_local_perspective; }
+		TransformOrigin   transform_origin_x()         const { return LengthPercentage(rare->transform_origin_x_type, rare->transform_origin_x); }
+		TransformOrigin   transform_origin_y()         const { return LengthPercentage(rare->transform_origin_y_type, rare->transform_origin_y); }
+		float             transform_origin_z()         const { return rare->transform_origin_z; }
+		bool              has_local_transform()        const { return rare->has_local_transform; }
+		bool              has_local_perspective()      const { return rare->has_local_perspective; }
 		AlignContent      align_content()              const { return GetLocalPropertyKeyword(PropertyId::AlignContent, AlignContent::Stretch); }
 		AlignItems        align_items()                const { return GetLocalPropertyKeyword(PropertyId::AlignItems, AlignItems::Stretch); }
 		AlignSelf         align_self()                 const { return GetLocalPropertyKeyword(PropertyId::AlignSelf, AlignSelf::Auto); }
@@ -283,19 +341,19 @@ namespace Style {
 		JustifyContent    justify_content()            const { return GetLocalPropertyKeyword(PropertyId::JustifyContent, JustifyContent::FlexStart); }
 		float             flex_grow()                  const { return GetLocalProperty(PropertyId::FlexGrow, 0.f); }
 		float             flex_shrink()                const { return GetLocalProperty(PropertyId::FlexShrink, 1.f); }
-		FlexBasis         flex_basis()                 const { return LengthPercentageAuto(rare.flex_basis_type, rare.flex_basis); }
-		float             border_top_left_radius()     const { return (float)rare.border_top_left_radius; }
-		float             border_top_right_radius()    const { return (float)rare.border_top_right_radius; }
-		float             border_bottom_right_radius() const { return (float)rare.border_bottom_right_radius; }
-		float             border_bottom_left_radius()  const { return (float)rare.border_bottom_left_radius; }
-		Clip              clip()                       const { return rare.clip; }
-		Drag              drag()                       const { return rare.drag; }
-		TabIndex          tab_index()                  const { return rare.tab_index; }
-		Colourb           image_color()                const { return rare.image_color; }
-		LengthPercentage  row_gap()                    const { return LengthPercentage(rare.row_gap_type, rare.row_gap); }
-		LengthPercentage  column_gap()                 const { return LengthPercentage(rare.column_gap_type, rare.column_gap); }
-		OverscrollBehavior overscroll_behavior()       const { return rare.overscroll_behavior; }
-		float             scrollbar_margin()           const { return rare.scrollbar_margin; }
+		FlexBasis         flex_basis()                 const { return LengthPercentageAuto(rare->flex_basis_type, rare->flex_basis); }
+		float             border_top_left_radius()     const { return (float)rare->border_top_left_radius; }
+		float             border_top_right_radius()    const { return (float)rare->border_top_right_radius; }
+		float             border_bottom_right_radius() const { return (float)rare->border_bottom_right_radius; }
+		float             border_bottom_left_radius()  const { return (float)rare->border_bottom_left_radius; }
+		Clip              clip()                       const { return rare->clip; }
+		Drag              drag()                       const { return rare->drag; }
+		TabIndex          tab_index()                  const { return rare->tab_index; }
+		Colourb           image_color()                const { return rare->image_color; }
+		LengthPercentage  row_gap()                    const { return LengthPercentage(rare->row_gap_type, rare->row_gap); }
+		LengthPercentage  column_gap()                 const { return LengthPercentage(rare->column_gap_type, rare->column_gap); }
+		OverscrollBehavior overscroll_behavior()       const { return rare->overscroll_behavior; }
+		float             scrollbar_margin()           const { return rare->scrollbar_margin; }
 		
 		// -- Assignment --
 		// Common
@@ -333,49 +391,49 @@ namespace Style {
 		void border_left_color  (Colourb value)              { common.border_left_color   = value; }
 		void has_decorator      (bool value)                 { common.has_decorator       = value; }
 		// Inherited
-		void font_face_handle  (FontFaceHandle value) { inherited.font_face_handle   = value; }
-		void font_size         (float value)          { inherited.font_size          = value; }
-		void has_letter_spacing(bool value)           { inherited.has_letter_spacing = value; }
-		void has_font_effect   (bool value)           { inherited.has_font_effect    = value; }
-		void font_style        (FontStyle value)      { inherited.font_style         = value; }
-		void font_weight       (FontWeight value)     { inherited.font_weight        = value; }
-		void pointer_events    (PointerEvents value)  { inherited.pointer_events     = value; }
-		void focus             (Focus value)          { inherited.focus              = value; }
-		void text_align        (TextAlign value)      { inherited.text_align         = value; }
-		void text_decoration   (TextDecoration value) { inherited.text_decoration    = value; }
-		void text_transform    (TextTransform value)  { inherited.text_transform     = value; }
-		void white_space       (WhiteSpace value)     { inherited.white_space        = value; }
-		void word_break        (WordBreak value)      { inherited.word_break         = value; }
-		void color             (Colourb value)        { inherited.color              = value; }
-		void opacity           (float value)          { inherited.opacity            = value; }
-		void line_height       (LineHeight value)     { inherited.line_height = value.value; inherited.line_height_inherit_type = value.inherit_type; inherited.line_height_inherit = value.inherit_value;  }
+		void font_face_handle  (FontFaceHandle value) { if (inherited->font_face_handle != value) inherited.Write().font_face_handle = value; }
+		void font_size         (float value)          { if (inherited->font_size != value) inherited.Write().font_size = value; }
+		void has_letter_spacing(bool value)           { if (inherited->has_letter_spacing != value) inherited.Write().has_letter_spacing = value; }
+		void has_font_effect   (bool value)           { if (inherited->has_font_effect != value) inherited.Write().has_font_effect = value; }
+		void font_style        (FontStyle value)      { if (inherited->font_style != value) inherited.Write().font_style = value; }
+		void font_weight       (FontWeight value)     { if (inherited->font_weight != value) inherited.Write().font_weight = value; }
+		void pointer_events    (PointerEvents value)  { if (inherited->pointer_events != value) inherited.Write().pointer_events = value; }
+		void focus             (Focus value)          { if (inherited->focus != value) inherited.Write().focus = value; }
+		void text_align        (TextAlign value)      { if (inherited->text_align != value) inherited.Write().text_align = value; }
+		void text_decoration   (TextDecoration value) { if (inherited->text_decoration != value) inherited.Write().text_decoration = value; }
+		void text_transform    (TextTransform value)  { if (inherited->text_transform != value) inherited.Write().text_transform = value; }
+		void white_space       (WhiteSpace value)     { if (inherited->white_space != value) inherited.Write().white_space = value; }
+		void word_break        (WordBreak value)      { if (inherited->word_break != value) inherited.Write().word_break = value; }
+		void color             (Colourb value)        { if (inherited->color != value) inherited.Write().color = value; }
+		void opacity           (float value)          { if (inherited->opacity != value) inherited.Write().opacity = value; }
+		void line_height       (LineHeight value)     { if (inherited->line_height != value.value || inherited->line_height_inherit_type != value.inherit_type || inherited->line_height_inherit != value.inherit_value) { auto& values = inherited.Write(); values.line_height = value.value; values.line_height_inherit_type = value.inherit_type; values.line_height_inherit = value.inherit_value; } }
 		// Rare
-		void min_width                 (MinWidth value)          { rare.min_width_type             = value.type; rare.min_width                  = value.value; }
-		void max_width                 (MaxWidth value)          { rare.max_width_type             = value.type; rare.max_width                  = value.value; }
-		void min_height                (MinHeight value)         { rare.min_height_type            = value.type; rare.min_height                 = value.value; }
-		void max_height                (MaxHeight value)         { rare.max_height_type            = value.type; rare.max_height                 = value.value; }
-		void vertical_align            (VerticalAlign value)     { rare.vertical_align_type        = value.type; rare.vertical_align_length      = value.value; }
-		void perspective_origin_x      (PerspectiveOrigin value) { rare.perspective_origin_x_type  = value.type; rare.perspective_origin_x       = value.value; }
-		void perspective_origin_y      (PerspectiveOrigin value) { rare.perspective_origin_y_type  = value.type; rare.perspective_origin_y       = value.value; }
-		void transform_origin_x        (TransformOrigin value)   { rare.transform_origin_x_type    = value.type; rare.transform_origin_x         = value.value; }
-		void transform_origin_y        (TransformOrigin value)   { rare.transform_origin_y_type    = value.type; rare.transform_origin_y         = value.value; }
-		void row_gap                   (LengthPercentage value)  { rare.row_gap_type               = value.type; rare.row_gap                    = value.value; }
-		void column_gap                (LengthPercentage value)  { rare.column_gap_type            = value.type; rare.column_gap                 = value.value; }
-		void flex_basis                (FlexBasis value)         { rare.flex_basis_type            = value.type; rare.flex_basis                 = value.value; }
-		void transform_origin_z        (float value)             { rare.transform_origin_z         = value; }
-		void perspective               (float value)             { rare.perspective                = value; }
-		void has_local_perspective     (bool value)              { rare.has_local_perspective      = value; }
-		void has_local_transform       (bool value)              { rare.has_local_transform        = value; }
-		void border_top_left_radius    (float value)             { rare.border_top_left_radius     = (int16_t)value; }
-		void border_top_right_radius   (float value)             { rare.border_top_right_radius    = (int16_t)value; }
-		void border_bottom_right_radius(float value)             { rare.border_bottom_right_radius = (int16_t)value; }
-		void border_bottom_left_radius (float value)             { rare.border_bottom_left_radius  = (int16_t)value; }
-		void clip                      (Clip value)              { rare.clip                       = value; }
-		void drag                      (Drag value)              { rare.drag                       = value; }
-		void tab_index                 (TabIndex value)          { rare.tab_index                  = value; }
-		void image_color               (Colourb value)           { rare.image_color                = value; }
-		void overscroll_behavior       (OverscrollBehavior value){ rare.overscroll_behavior        = value; }
-		void scrollbar_margin          (float value)             { rare.scrollbar_margin           = value; }
+		void min_width                 (MinWidth value)          { if (rare->min_width_type != value.type || rare->min_width != value.value) { auto& values = rare.Write(); values.min_width_type = value.type; values.min_width = value.value; } }
+		void max_width                 (MaxWidth value)          { if (rare->max_width_type != value.type || rare->max_width != value.value) { auto& values = rare.Write(); values.max_width_type = value.type; values.max_width = value.value; } }
+		void min_height                (MinHeight value)         { if (rare->min_height_type != value.type || rare->min_height != value.value) { auto& values = rare.Write(); values.min_height_type = value.type; values.min_height = value.value; } }
+		void max_height                (MaxHeight value)         { if (rare->max_height_type != value.type || rare->max_height != value.value) { auto& values = rare.Write(); values.max_height_type = value.type; values.max_height = value.value; } }
+		void vertical_align            (VerticalAlign value)     { if (rare->vertical_align_type != value.type || rare->vertical_align_length != value.value) { auto& values = rare.Write(); values.vertical_align_type = value.type; values.vertical_align_length = value.value; } }
+		void perspective_origin_x      (PerspectiveOrigin value) { if (rare->perspective_origin_x_type != value.type || rare->perspective_origin_x != value.value) { auto& values = rare.Write(); values.perspective_origin_x_type = value.type; values.perspective_origin_x = value.value; } }
+		void perspective_origin_y      (PerspectiveOrigin value) { if (rare->perspective_origin_y_type != value.type || rare->perspective_origin_y != value.value) { auto& values = rare.Write(); values.perspective_origin_y_type = value.type; values.perspective_origin_y = value.value; } }
+		void transform_origin_x        (TransformOrigin value)   { if (rare->transform_origin_x_type != value.type || rare->transform_origin_x != value.value) { auto& values = rare.Write(); values.transform_origin_x_type = value.type; values.transform_origin_x = value.value; } }
+		void transform_origin_y        (TransformOrigin value)   { if (rare->transform_origin_y_type != value.type || rare->transform_origin_y != value.value) { auto& values = rare.Write(); values.transform_origin_y_type = value.type; values.transform_origin_y = value.value; } }
+		void row_gap                   (LengthPercentage value)  { if (rare->row_gap_type != value.type || rare->row_gap != value.value) { auto& values = rare.Write(); values.row_gap_type = value.type; values.row_gap = value.value; } }
+		void column_gap                (LengthPercentage value)  { if (rare->column_gap_type != value.type || rare->column_gap != value.value) { auto& values = rare.Write(); values.column_gap_type = value.type; values.column_gap = value.value; } }
+		void flex_basis                (FlexBasis value)         { if (rare->flex_basis_type != value.type || rare->flex_basis != value.value) { auto& values = rare.Write(); values.flex_basis_type = value.type; values.flex_basis = value.value; } }
+		void transform_origin_z        (float value)             { if (rare->transform_origin_z != value) rare.Write().transform_origin_z = value; }
+		void perspective               (float value)             { if (rare->perspective != value) rare.Write().perspective = value; }
+		void has_local_perspective     (bool value)              { if (rare->has_local_perspective != value) rare.Write().has_local_perspective = value; }
+		void has_local_transform       (bool value)              { if (rare->has_local_transform != value) rare.Write().has_local_transform = value; }
+		void border_top_left_radius    (float value)             { if (rare->border_top_left_radius != (int16_t)value) rare.Write().border_top_left_radius = (int16_t)value; }
+		void border_top_right_radius   (float value)             { if (rare->border_top_right_radius != (int16_t)value) rare.Write().border_top_right_radius = (int16_t)value; }
+		void border_bottom_right_radius(float value)             { if (rare->border_bottom_right_radius != (int16_t)value) rare.Write().border_bottom_right_radius = (int16_t)value; }
+		void border_bottom_left_radius (float value)             { if (rare->border_bottom_left_radius != (int16_t)value) rare.Write().border_bottom_left_radius = (int16_t)value; }
+		void clip                      (Clip value)              { if (rare->clip != value) rare.Write().clip = value; }
+		void drag                      (Drag value)              { if (rare->drag != value) rare.Write().drag = value; }
+		void tab_index                 (TabIndex value)          { if (rare->tab_index != value) rare.Write().tab_index = value; }
+		void image_color               (Colourb value)           { if (rare->image_color != value) rare.Write().image_color = value; }
+		void overscroll_behavior       (OverscrollBehavior value){ if (rare->overscroll_behavior != value) rare.Write().overscroll_behavior = value; }
+		void scrollbar_margin          (float value)             { if (rare->scrollbar_margin != value) rare.Write().scrollbar_margin = value; }
 
 		// clang-format on
 
@@ -387,6 +445,10 @@ namespace Style {
 		}
 		void CopyInherited(const ComputedValues& parent) { inherited = parent.inherited; }
 
+		// Inherited and rare values are shared between elements until written to, these can be used to inspect the sharing.
+		bool SharesInheritedValuesWith(const ComputedValues& other) const { return inherited.IsSharedWith(other.inherited); }
+		bool HasDefaultRareValues() const { return rare.IsDefault(); }
+
 	private:
 		template <typename T>
 		inline T GetLocalPropertyKeyword(PropertyId id, T default_value) const
@@ -406,8 +468,8 @@ namespace Style {
 		Element* element = nullptr;
 
 		CommonValues common;
-		InheritedValues inherited;
-		RareValues rare;
+		SharedValues<InheritedValues> inherited;
+		SharedValues<RareValues> rare;
 	};
 
 } // namespace Style
@@ -29,6 +29,7 @@
 #ifndef RMLUI_CORE_CONTEXT_H
 #define RMLUI_CORE_CONTEXT_H
 
+#include "FrameStatistics.h"
 #include "Header.h"
 #include "Input.h"
 #include "ScriptInterface.h"
@@ -46,6 +47,9 @@ class DataModel;
 class DataModelConstructor;
 class DataTypeRegister;
 class ScrollController;
+namespace FrameStatisticsCollector {
+	class ElementRecorder;
+}
 enum class EventId : uint16_t;
 
 /**
@@ -86,6 +90,37 @@ public:
 	bool Update();
 	/// Renders all visible elements in the context's documents.
 	bool Render();
+	/// Returns the number of elements that were fully or partially skipped during the last call to Render() because they were outside the
+	/// visible area.
+	/// @return The number of culled elements.
+	int GetNumCulledElements() const;
+	/// Returns statistics about the time spent and the work performed during the previous frame.
+	/// @note A frame consists of a call to Update() followed by Render(). The statistics of a frame are made available at the start of the
+	///     next call to Update().
+	/// @return The statistics of the previous frame.
+	const FrameStatistics& GetFrameStatistics() const;
+	/// Enables or disables the collection of per-element statistics, disabled by default.
+	/// @param[in] enable True to record which elements were regenerated and how much they rendered each frame.
+	void EnableElementStatistics(bool enable);
+	/// Returns the per-element statistics of the previous frame, listing every element that did work during the frame.
+	/// @note Empty unless element statistics are enabled. Made available at the same time as the frame statistics.
+	/// @return The element statistics of the previous frame.
+	const ElementFrameStatisticsList& GetElementStatistics() const;
+
+	/// Enables or disables document arenas for documents loaded into this context from now on, disabled by default.
+	/// @param[in] enable True to allocate the elements created while loading each document from an arena owned by the document. The arena
+	///     is freed in one step when the document and all its elements are destroyed.
+	void EnableDocumentArenas(bool enable);
+	/// Returns true if documents loaded into this context are allocated from their own arena.
+	bool AreDocumentArenasEnabled() const;
+
+	/// Enables or disables batching of text geometry, disabled by default.
+	/// @param[in] enable True to merge the geometry of consecutively rendered text elements sharing a texture, within each document, to reduce
+	///     the number of draw calls. Text under a transform is still rendered separately for each element.
+	/// @note Render calls submitted directly to the render interface, instead of through Geometry, may be rendered before any pending text.
+	void EnableTextBatching(bool enable);
+	/// Returns true if text geometry is batched.
+	bool IsTextBatchingEnabled() const;
 
 	/// Creates a new, empty document and places it into this context.
 	/// @param[in] instancer_name The name of the instancer used to create the document.
@@ -369,9 +404,31 @@ private:
 	// itself can't be part of it.
 	ElementSet drag_hover_chain;
 
+	// Storage reused between mouse moves to avoid allocating the event parameters and hover chains every time. They are
+	// moved out while in use, so that any events processed recursively during dispatch simply start out with empty containers.
+	Dictionary mouse_move_parameters;
+	Dictionary mouse_move_drag_parameters;
+	ElementSet hover_chain_buffer;
+	ElementSet drag_hover_chain_buffer;
+
 	Vector2i clip_origin;
 	Vector2i clip_dimensions;
 
+	// Number of elements skipped during rendering for being outside the visible area.
+	int num_culled_elements;
+
+	// Statistics of the previous frame, and of the frame currently being collected.
+	FrameStatistics frame_statistics;
+	FrameStatistics current_frame_statistics;
+	// Per-element statistics of the previous frame, and the recorder of the current frame. The recorder is kept once created, as it may be
+	// in use by the current frame while being disabled.
+	bool element_statistics_enabled = false;
+	ElementFrameStatisticsList element_statistics;
+	UniquePtr<FrameStatisticsCollector::ElementRecorder> element_recorder;
+
+	bool document_arenas_enabled = false;
+	bool text_batching_enabled = false;
+
 	using DataModels = UnorderedMap<String, UniquePtr<DataModel>>;
 	DataModels data_models;
 
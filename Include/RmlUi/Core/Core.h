@@ -42,6 +42,7 @@ class FileInterface;
 class FontEngineInterface;
 class RenderInterface;
 class SystemInterface;
+class TaskSchedulerInterface;
 enum class DefaultActionPhase;
 
 /**
@@ -89,6 +90,14 @@ RMLUICORE_API void SetFontEngineInterface(FontEngineInterface* font_interface);
 /// Returns RmlUi's font interface.
 RMLUICORE_API FontEngineInterface* GetFontEngineInterface();
 
+/// Sets the interface through which independent tasks are run, possibly concurrently. This is not required to be called, by default all work is done
+/// on the calling thread. When set, independent formatting contexts are laid out in parallel.
+/// @param[in] task_scheduler_interface A non-owning pointer to the application-specified task scheduler, or nullptr to disable parallel work.
+/// @lifetime The interface must be kept alive until it is replaced, or until after the call to Rml::Shutdown.
+RMLUICORE_API void SetTaskSchedulerInterface(TaskSchedulerInterface* task_scheduler_interface);
+/// Returns RmlUi's task scheduler interface, or nullptr if none is set.
+RMLUICORE_API TaskSchedulerInterface* GetTaskSchedulerInterface();
+
 /// Creates a new element context.
 /// @param[in] name The new name of the context. This must be unique.
 /// @param[in] dimensions The initial dimensions of the new context.
@@ -130,6 +139,21 @@ RMLUICORE_API bool LoadFontFace(const String& file_path, bool fallback_face = fa
 /// @lifetime The pointed to 'data' must remain available until after the call to Rml::Shutdown.
 RMLUICORE_API bool LoadFontFace(const byte* data, int data_size, const String& font_family, Style::FontStyle style,
 	Style::FontWeight weight = Style::FontWeight::Auto, bool fallback_face = false);
+/// Sets the directory of the persistent font cache, or an empty string to disable it, which is the default.
+/// When set, the default font engine saves rasterized glyphs and font-effect bitmaps to this directory through the file interface, and loads them
+/// from here instead of rendering them again when the same font face is later used at the same size. This should be set before loading documents.
+/// @param[in] directory The path of an existing directory, which must be writable through the file interface's SaveFile().
+RMLUICORE_API void SetFontCacheDirectory(const String& directory);
+/// Returns the directory of the persistent font cache, or an empty string if the cache is disabled.
+RMLUICORE_API const String& GetFontCacheDirectory();
+/// Enables rendering of text from signed distance fields in the default font engine, which is disabled by default.
+/// When enabled, the outlines of each font face are rasterized once at a reference size into a distance-field atlas, which is then used to render
+/// text at all font sizes instead of rasterizing the glyphs again for every size. This requires a render interface implementing
+/// GenerateDistanceFieldTexture(). This should be set before loading documents.
+/// @param[in] enable True to render text from distance fields, false to render glyph bitmaps rasterized at each font size.
+RMLUICORE_API void SetFontDistanceFieldRendering(bool enable);
+/// Returns true if the default font engine renders text from signed distance fields.
+RMLUICORE_API bool GetFontDistanceFieldRendering();
 
 /// Registers a generic RmlUi plugin.
 RMLUICORE_API void RegisterPlugin(Plugin* plugin);
@@ -148,6 +172,9 @@ RMLUICORE_API EventId RegisterEventType(const String& type, bool interruptible,
 
 /// Returns a list of source URLs to textures in all loaded documents.
 RMLUICORE_API StringList GetTextureSourceList();
+/// Returns the source and dimensions of all textures currently loaded through the render interface, including generated textures such as font
+/// atlases.
+RMLUICORE_API Vector<Pair<String, Vector2i>> GetLoadedTextures();
 /// Forces all texture handles loaded and generated by RmlUi to be released.
 RMLUICORE_API void ReleaseTextures();
 /// Forces all compiled geometry handles generated by RmlUi to be released.
@@ -68,6 +68,11 @@ struct DataAddressEntry {
 	DataAddressEntry(int index) : index(index) {}
 	String name;
 	int index;
+
+	// Lookup cache for name entries, filled in the first time the entry is resolved. The cached index is only valid for the
+	// owner which stored it, thus a different struct definition or data model will simply resolve the name again.
+	mutable const void* cache_owner = nullptr;
+	mutable int cache_index = -1;
 };
 using DataAddress = Vector<DataAddressEntry>;
 
@@ -150,7 +150,9 @@ public:
 	void AddMember(const String& name, UniquePtr<VariableDefinition> member);
 
 private:
-	SmallUnorderedMap<String, UniquePtr<VariableDefinition>> members;
+	// Members are only ever appended, so that member indices cached in data addresses stay valid.
+	Vector<UniquePtr<VariableDefinition>> members;
+	SmallUnorderedMap<String, int> member_indices;
 };
 
 template <typename Container>
@@ -41,12 +41,14 @@
 #include "Transform.h"
 #include "Tween.h"
 #include "Types.h"
+#include <vector>
 
 namespace Rml {
 
 class Context;
 class DataModel;
 class Decorator;
+class ElementArena;
 class ElementInstancer;
 class EventDispatcher;
 class EventListener;
@@ -57,6 +59,7 @@ class ElementScroll;
 class ElementStyle;
 class ContainerBox;
 class InlineLevelBox;
+class LayoutDetails;
 class ReplacedBox;
 class PropertiesIteratorView;
 class PropertyDictionary;
@@ -66,6 +69,30 @@ class TransformState;
 struct ElementMeta;
 struct StackingContextChild;
 
+/**
+    The memory used by an element and its components, in bytes. Components which are only created when needed report zero until then.
+    Only the objects themselves are counted, not any memory they allocate dynamically, nor the element's children.
+ */
+struct ElementMemoryUsage {
+	size_t element = 0;          // The element object, as seen from its base class.
+	size_t meta = 0;             // Style, background and border, and computed values; always allocated.
+	size_t event_dispatcher = 0; // Event dispatcher and attribute event listeners; created when the first listener is attached.
+	size_t decoration = 0;       // Decorators; created when the element is given a decorator.
+	size_t scroll = 0;           // Scrollbars; created when the element needs scrollbars.
+
+	size_t GetTotal() const { return element + meta + event_dispatcher + decoration + scroll; }
+
+	ElementMemoryUsage& operator+=(const ElementMemoryUsage& other)
+	{
+		element += other.element;
+		meta += other.meta;
+		event_dispatcher += other.event_dispatcher;
+		decoration += other.decoration;
+		scroll += other.scroll;
+		return *this;
+	}
+};
+
 /**
     A generic element in the DOM tree.
 
@@ -567,14 +594,20 @@ public:
 	    @name Internal Functions
 	 */
 	//@{
-	/// Access the event dispatcher for this element.
+	/// Access the event dispatcher for this element, creating it if necessary.
 	EventDispatcher* GetEventDispatcher() const;
+	/// Returns the event dispatcher for this element, or nullptr if no event listeners have been attached to it yet.
+	EventDispatcher* FindEventDispatcher() const;
 	/// Returns event types with number of listeners for debugging.
 	String GetEventDispatcherSummary() const;
-	/// Access the element decorators.
+	/// Access the element decorators, creating them if necessary.
 	ElementDecoration* GetElementDecoration() const;
-	/// Returns the element's scrollbar functionality.
+	/// Returns the element's scrollbar functionality, creating it if necessary.
 	ElementScroll* GetElementScroll() const;
+	/// Returns the element's scrollbar functionality, or nullptr if it has not been needed yet.
+	ElementScroll* FindElementScroll() const;
+	/// Returns the memory used by this element and its components, excluding its children.
+	ElementMemoryUsage GetMemoryUsage() const;
 	/// Returns the element's nearest scroll container that can be scrolled, if any.
 	Element* GetClosestScrollableContainer();
 	/// Returns the element's transform state.
@@ -609,6 +642,11 @@ protected:
 	virtual void OnUpdate();
 	/// Called during render after backgrounds, borders, decorators, but before children, are rendered.
 	virtual void OnRender();
+	/// Called during render to determine the region covered by everything rendered in OnRender(). Used to skip calling OnRender() when the
+	/// element is outside the visible area. By default the region is unknown, and OnRender() is always called.
+	/// @param[out] bounds The region in absolute coordinates, before any transform is applied.
+	/// @return True if the region is known and OnRender() can be skipped when it is not visible.
+	virtual bool GetRenderBounds(Rectanglef& bounds);
 	/// Called during update if the element size has been changed.
 	virtual void OnResize();
 	/// Called during a layout operation, when the element is being positioned and sized.
@@ -668,6 +706,8 @@ private:
 
 	void DirtyAbsoluteOffset();
 	void DirtyAbsoluteOffsetRecursive();
+	Vector2f GetUnscrolledAbsoluteOffset();
+	Vector2f GetScrollTranslation();
 	void UpdateOffset();
 	void SetBaseline(float baseline);
 
@@ -705,6 +745,43 @@ private:
 	/// Advances the animations (including transitions) forward in time.
 	void AdvanceAnimations();
 
+	/// Allocates the storage of the element's lists from the arena of the document being loaded when the element was constructed, or from the
+	/// heap if there was none.
+	template <typename T>
+	class ArenaAllocator {
+	public:
+		using value_type = T;
+		using propagate_on_container_move_assignment = std::true_type;
+		using propagate_on_container_swap = std::true_type;
+
+		explicit ArenaAllocator(ElementArena* arena) noexcept : arena(arena) {}
+		template <typename U>
+		ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.arena)
+		{}
+
+		T* allocate(size_t n) { return static_cast<T*>(AllocateListStorage(arena, n * sizeof(T))); }
+		void deallocate(T* ptr, size_t /*n*/) { DeallocateListStorage(arena, ptr); }
+
+		template <typename U>
+		bool operator==(const ArenaAllocator<U>& other) const
+		{
+			return arena == other.arena;
+		}
+		template <typename U>
+		bool operator!=(const ArenaAllocator<U>& other) const
+		{
+			return arena != other.arena;
+		}
+
+	private:
+		ElementArena* arena;
+		template <typename U>
+		friend class ArenaAllocator;
+	};
+
+	static void* AllocateListStorage(ElementArena* arena, size_t size);
+	static void DeallocateListStorage(ElementArena* arena, void* ptr);
+
 	// State flags are packed together for compact data layout.
 	bool local_stacking_context;
 	bool local_stacking_context_forced;
@@ -724,7 +801,13 @@ private:
 	bool dirty_transform : 1;
 	bool dirty_perspective : 1;
 
-	OwnedElementList children;
+	bool meta_from_arena : 1; // True if the meta components and lists are allocated from the owning document's arena.
+
+	bool max_content_width_valid : 1;
+	bool max_content_width_independent : 1; // True if the cached max-content width does not depend on the containing block width.
+	bool content_height_valid : 1;
+
+	std::vector<ElementPtr, ArenaAllocator<ElementPtr>> children;
 	int num_non_dom_children;
 
 	// Defines what box area represents the element's client area; this is usually padding, but may be content.
@@ -756,11 +839,17 @@ private:
 	Vector2f relative_offset_base;     // the base offset from the parent
 	Vector2f relative_offset_position; // the offset of a relatively positioned element
 
+	// The absolute offset of the element's border box, excluding any scrolling of its ancestors.
 	Vector2f absolute_offset;
 
 	// The offset this element adds to its logical children due to scrolling content.
 	Vector2f scroll_offset;
 
+	// The accumulated scroll offset of all our offset ancestors. Composed lazily so that scrolling does not need to visit any descendants, the
+	// translation is only valid while its generation matches the global scroll generation.
+	Vector2f scroll_translation;
+	unsigned int scroll_translation_generation;
+
 	// The size of the element.
 	struct PositionedBox {
 		Box box;
@@ -773,10 +862,18 @@ private:
 	// And of the element's scrollable content.
 	Vector2f scrollable_overflow_rectangle;
 
+	// Intrinsic sizes cached by the layout engine until the layout of this element or any of its descendants is dirtied. The max-content width is
+	// used for shrink-to-fit sizing, and the content height for a given width is used to size flex items, see LayoutDetails.
+	float max_content_width;
+	Vector2f max_content_containing_block;
+	float content_height;
+	float content_height_width;
+	float content_height_containing_block;
+
 	float baseline;
 	float z_index;
 
-	ElementList stacking_context;
+	std::vector<Element*, ArenaAllocator<Element*>> stacking_context;
 
 	UniquePtr<TransformState> transform_state;
 
@@ -790,6 +887,7 @@ private:
 	friend class Rml::InlineLevelBox;
 	friend class Rml::ReplacedBox;
 	friend class Rml::ElementScroll;
+	friend class Rml::LayoutDetails;
 	friend RMLUICORE_API void Rml::ReleaseFontResources();
 };
 
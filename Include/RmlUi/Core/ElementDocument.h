@@ -36,9 +36,11 @@ namespace Rml {
 class Context;
 class Stream;
 class DocumentHeader;
+class ElementArena;
 class ElementText;
 class StyleSheet;
 class StyleSheetContainer;
+class TextBatcher;
 
 /**
      ModalFlag used for controlling the modal state of the document.
@@ -184,6 +186,12 @@ private:
 
 	Context* context;
 
+	// Backs the elements instanced while loading this document, if document arenas are enabled in the context.
+	ElementArena* arena;
+
+	// Merges the geometry of our text elements, if text batching is enabled in the context. Created when first needed.
+	UniquePtr<TextBatcher> text_batcher;
+
 	// Is the current display modal
 	bool modal;
 
@@ -193,6 +201,7 @@ private:
 	bool position_dirty;
 
 	friend class Rml::Context;
+	friend class Rml::ElementText;
 	friend class Rml::Factory;
 };
 
@@ -35,6 +35,8 @@
 
 namespace Rml {
 
+class TextBatcher;
+
 /**
     @author Peter Curry
  */
@@ -80,6 +82,7 @@ public:
 
 protected:
 	void OnRender() override;
+	bool GetRenderBounds(Rectanglef& bounds) override;
 
 	void OnPropertyChange(const PropertyIdSet& properties) override;
 
@@ -103,6 +106,11 @@ private:
 	void GenerateGeometry(const FontFaceHandle font_face_handle, Line& line);
 	// Generates any geometry necessary for rendering decoration (underline, strike-through, etc).
 	void GenerateDecoration(const FontFaceHandle font_face_handle);
+	// Calculates the bounds of all the generated text and decoration geometry.
+	void UpdateGeometryBounds();
+
+	// Returns the text batcher of our document to render our geometry through, or nullptr to render it directly.
+	TextBatcher* GetTextBatcher();
 
 	String text;
 
@@ -118,6 +126,8 @@ private:
 	float opacity;
 
 	int font_handle_version;
+	// Changed whenever the geometry is regenerated, identifying its contents to the text batcher.
+	uint64_t geometry_revision;
 
 	bool geometry_dirty : 1;
 
@@ -132,6 +142,9 @@ private:
 
 	bool font_effects_dirty;
 	FontEffectsHandle font_effects_handle;
+
+	// The region covered by the generated geometry, relative to the element's offset. Invalid if there is no geometry.
+	Rectanglef geometry_bounds;
 };
 
 } // namespace Rml
@@ -39,6 +39,7 @@ namespace Rml {
 class Factory;
 class Element;
 class EventInstancer;
+class EventInstancerDefault;
 struct EventSpecification;
 
 enum class EventPhase { None, Capture = 1, Target = 2, Bubble = 4 };
@@ -123,6 +124,9 @@ protected:
 	Element* current_element = nullptr;
 
 private:
+	/// Reset all state and assign new event arguments, allowing instancers to reuse an existing event object.
+	void Initialize(Element* target, EventId id, const String& type, const Dictionary& parameters, bool interruptible);
+
 	/// Project the mouse coordinates to the current element to enable
 	/// interacting with transformed elements.
 	void ProjectMouse(Element* element);
@@ -145,6 +149,7 @@ private:
 	EventInstancer* instancer = nullptr;
 
 	friend class Rml::Factory;
+	friend class Rml::EventInstancerDefault;
 };
 
 } // namespace Rml
@@ -87,6 +87,26 @@ public:
 	/// @param out_data The string contents of the file.
 	/// @return True on success.
 	virtual bool LoadFile(const String& path, String& out_data);
+
+	/// Save data to a file, replacing its contents if it already exists.
+	/// This is only used for optional caches, such as the font cache. The default implementation does not support writing and returns false.
+	/// @param path The path to the file to save.
+	/// @param data The data to write to the file.
+	/// @return True on success.
+	virtual bool SaveFile(const String& path, const String& data);
+
+	/// Map a file into memory for reading, so that its contents are only read as they are accessed.
+	/// This is optional and only used for large files such as fonts, which are loaded instead when mapping is not supported. The default
+	/// implementation does not support mapping and returns false.
+	/// @param path The path to the file to map.
+	/// @param out_data The start of the mapped file contents, which must remain valid until released through UnmapFile().
+	/// @param out_size The size of the mapped file contents in bytes.
+	/// @return True on success.
+	virtual bool MapFile(const String& path, const byte*& out_data, size_t& out_size);
+	/// Release a file mapping previously created through MapFile().
+	/// @param data The start of the mapped file contents.
+	/// @param size The size of the mapped file contents in bytes.
+	virtual void UnmapFile(const byte* data, size_t size);
 };
 
 } // namespace Rml
@@ -0,0 +1,101 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FRAMESTATISTICS_H
+#define RMLUI_CORE_FRAMESTATISTICS_H
+
+#include "Header.h"
+#include "Types.h"
+
+namespace Rml {
+
+/**
+    Statistics about the work performed by a context during a single frame, that is, a call to Context::Update() followed
+    by Context::Render(). All durations are measured in seconds.
+ */
+
+struct RMLUICORE_API FrameStatistics {
+	// Total time spent in Context::Update(), including all of its phases below.
+	double update_time = 0;
+	// Time spent updating data models and their views.
+	double data_model_time = 0;
+	// Time spent looking up element definitions from the style sheets.
+	double definition_time = 0;
+	// Time spent computing property values of elements with dirty properties.
+	double property_time = 0;
+	// Time spent instancing decorators.
+	double decorator_time = 0;
+	// Time spent formatting and positioning documents.
+	double layout_time = 0;
+	// Time spent generating geometry for backgrounds, borders, decorators, and text.
+	double geometry_time = 0;
+	// Time spent in Context::Render() submitting geometry to the render interface, excluding geometry generation.
+	double render_time = 0;
+
+	// Number of elements whose property values were computed.
+	int elements_updated = 0;
+	// Number of elements whose computed values were shared from a sibling instead of being computed.
+	int computed_values_shared = 0;
+	// Number of element definitions looked up from the style sheets.
+	int definitions_updated = 0;
+	// Number of documents formatted by the layout engine.
+	int layout_passes = 0;
+	// Number of geometries compiled by the render interface.
+	int geometry_compiled = 0;
+	// Number of geometry render calls submitted to the render interface.
+	int draw_calls = 0;
+	// Number of vertices submitted to the render interface.
+	int vertices_rendered = 0;
+	// Number of textures loaded or generated through the render interface.
+	int texture_uploads = 0;
+	// Number of glyphs rasterized by the font engine.
+	int glyphs_rasterized = 0;
+};
+
+/**
+    Statistics about the work performed on a single element during a frame. Only collected while element statistics are enabled on the
+    context, see Context::EnableElementStatistics().
+ */
+
+struct RMLUICORE_API ElementFrameStatistics {
+	// The element, or null if it has since been destroyed.
+	ObserverPtr<Element> element;
+	// True if the element definition was looked up from the style sheets.
+	bool definition_updated = false;
+	// True if the element was formatted by the layout engine.
+	bool layout_updated = false;
+	// True if the background, border, decorator, or text geometry of the element was generated.
+	bool geometry_generated = false;
+	// Number of vertices rendered by the element itself, excluding its descendants.
+	int vertices_rendered = 0;
+};
+
+using ElementFrameStatisticsList = Vector<ElementFrameStatistics>;
+
+} // namespace Rml
+#endif
@@ -101,6 +101,23 @@ public:
 	/// @param[in] source_dimensions The dimensions, in pixels, of the source data.
 	/// @return True if the texture generation succeeded and the handle is valid, false if not.
 	virtual bool GenerateTexture(TextureHandle& texture_handle, const byte* source, const Vector2i& source_dimensions);
+	/// Called by RmlUi when a texture is required for rendering text from signed distance fields, see SetFontDistanceFieldRendering().
+	/// The alpha channel of the source data holds the distance to the glyph edge instead of coverage, with the edge at 0.5 (128) and larger values
+	/// inside the glyph. Geometry rendered with this texture should take its alpha from a smooth step across the edge, one screen pixel wide,
+	/// instead of from the sampled alpha value. See the GL3 and software renderers for reference implementations.
+	/// If not supported, do not override the function or return false; the text will then be rendered from a blurred bitmap.
+	/// @param[out] texture_handle The handle to write the texture handle for the generated texture to.
+	/// @param[in] source The raw 8-bit texture data, in the same format as for GenerateTexture().
+	/// @param[in] source_dimensions The dimensions, in pixels, of the source data.
+	/// @return True if the texture generation succeeded and the handle is valid, false if not.
+	virtual bool GenerateDistanceFieldTexture(TextureHandle& texture_handle, const byte* source, const Vector2i& source_dimensions);
+	/// Called by RmlUi when it wants to replace the contents of a previously generated texture, such as for animated images.
+	/// If not supported, do not override the function or return false; the texture will be released and generated anew instead.
+	/// @param[in] texture_handle The texture handle of a texture generated with GenerateTexture().
+	/// @param[in] source The raw 8-bit texture data, in the same format as for GenerateTexture().
+	/// @param[in] source_dimensions The dimensions, in pixels, of the source data. Always equal to the dimensions the texture was generated with.
+	/// @return True if the texture contents were updated, false if not.
+	virtual bool UpdateTexture(TextureHandle texture_handle, const byte* source, const Vector2i& source_dimensions);
 	/// Called by RmlUi when a loaded texture is no longer required.
 	/// @param texture The texture handle to release.
 	virtual void ReleaseTexture(TextureHandle texture);
@@ -125,6 +125,8 @@ namespace Style {
 		int GetNumber() const { return value < 0 ? 0 : value; }
 		Type GetType() const { return value == 0 ? Type::Auto : (value == -1 ? Type::None : (value == -2 ? Type::Always : Type::Number)); }
 		bool operator==(Type type) const { return GetType() == type; }
+		bool operator==(Clip other) const { return value == other.value; }
+		bool operator!=(Clip other) const { return value != other.value; }
 	};
 
 	enum class Visibility : uint8_t { Visible, Hidden };
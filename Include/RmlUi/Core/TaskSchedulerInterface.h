@@ -0,0 +1,60 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_TASKSCHEDULERINTERFACE_H
+#define RMLUI_CORE_TASKSCHEDULERINTERFACE_H
+
+#include "Header.h"
+#include "Traits.h"
+#include "Types.h"
+
+namespace Rml {
+
+/**
+    The abstract base class for running independent tasks concurrently.
+
+    By default, RmlUi does all of its work on the calling thread. Applications with a job system or thread pool can derive from this class and
+    install it through Rml::SetTaskSchedulerInterface() to let RmlUi spread work across threads. Currently, this is used to lay out independent
+    formatting contexts in parallel, such as flex items, table cells, and absolutely positioned boxes.
+ */
+
+class RMLUICORE_API TaskSchedulerInterface : public NonCopyMoveable {
+public:
+	TaskSchedulerInterface();
+	virtual ~TaskSchedulerInterface();
+
+	/// Runs a number of independent tasks, possibly concurrently.
+	/// @param[in] num_tasks The number of tasks to run.
+	/// @param[in] task The function to call once for each task index in the range [0, num_tasks).
+	/// @note This function must not return before all tasks have completed. The calling thread is allowed to run tasks itself. The default
+	/// implementation runs all the tasks in order on the calling thread.
+	virtual void RunTasks(int num_tasks, const Function<void(int)>& task);
+};
+
+} // namespace Rml
+#endif
@@ -50,6 +50,10 @@ public:
 	/// Returns the element's inherent size.
 	bool GetIntrinsicDimensions(Vector2f& dimensions, float& ratio) override;
 
+	/// Enables rendering of the upcoming animation frame in the background while the current one is displayed, disabled by
+	/// default. Uses rlottie's asynchronous rendering, and an additional frame buffer for each element.
+	static void SetRenderAhead(bool enable);
+
 protected:
 	/// Updates the animation.
 	void OnUpdate() override;
@@ -75,17 +79,25 @@ private:
 	bool LoadAnimation();
 	// Update the texture for the next animation frame when necessary.
 	void UpdateTexture();
+	// Renders the given animation frame into the texture data buffer, converted to the texture format.
+	void RenderFrame(size_t frame);
+	// Waits for and discards any frame currently being rendered ahead.
+	void FinishRenderAhead();
 
 	bool animation_dirty = false;
 	bool geometry_dirty = false;
 	bool texture_size_dirty = false;
 
-	// The texture this element is rendering from.
+	// The texture this element is rendering from, its contents are replaced in-place for new frames when supported by the render interface.
 	Texture texture;
 	// The texture data buffer.
 	size_t texture_data_size = 0;
 	UniquePtr<byte[]> texture_data;
 
+	// The upcoming frame being rendered ahead into its own buffer, if enabled.
+	struct RenderAheadState;
+	UniquePtr<RenderAheadState> render_ahead;
+
 	// The animation's intrinsic dimensions.
 	Vector2f intrinsic_dimensions;
 	// The element's size for rendering.
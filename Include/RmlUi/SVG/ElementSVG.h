@@ -32,14 +32,14 @@
 #include "../Core/Element.h"
 #include "../Core/Geometry.h"
 #include "../Core/Header.h"
-#include "../Core/Texture.h"
-
-namespace lunasvg {
-class Document;
-}
 
 namespace Rml {
 
+namespace SVG {
+	struct SVGDocumentData;
+	struct SVGTextureData;
+} // namespace SVG
+
 class RMLUICORE_API ElementSVG : public Element {
 public:
 	RMLUI_RTTI_DefineWithParent(ElementSVG, Element)
@@ -50,6 +50,11 @@ public:
 	/// Returns the element's inherent size.
 	bool GetIntrinsicDimensions(Vector2f& dimensions, float& ratio) override;
 
+	/// Enables rasterization of SVG images on a background worker thread, disabled by default. Parsed documents and
+	/// rasterized textures are shared between all SVG elements regardless of this setting.
+	/// @note While its image is being rasterized, an element is not rendered.
+	static void SetThreadedRasterization(bool enable);
+
 protected:
 	/// Renders the image.
 	void OnRender() override;
@@ -77,8 +82,8 @@ private:
 	bool geometry_dirty = false;
 	bool texture_dirty = false;
 
-	// The texture this element is rendering from.
-	Texture texture;
+	// The texture this element is rendering from, shared with other elements using the same source and dimensions.
+	SharedPtr<SVG::SVGTextureData> svg_texture;
 
 	// The image's intrinsic dimensions.
 	Vector2f intrinsic_dimensions;
@@ -88,7 +93,8 @@ private:
 	// The geometry used to render this element.
 	Geometry geometry;
 
-	UniquePtr<lunasvg::Document> svg_document;
+	// The parsed document, shared with other elements using the same source.
+	SharedPtr<SVG::SVGDocumentData> svg_document;
 };
 
 } // namespace Rml
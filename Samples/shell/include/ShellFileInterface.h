@@ -57,6 +57,9 @@ public:
 	/// Returns the current position of the file pointer.
 	size_t Tell(Rml::FileHandle file) override;
 
+	/// Saves data to a file relative to the current working directory.
+	bool SaveFile(const Rml::String& path, const Rml::String& data) override;
+
 private:
 	Rml::String root;
 };
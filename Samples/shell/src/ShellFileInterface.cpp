@@ -64,3 +64,15 @@ size_t ShellFileInterface::Tell(Rml::FileHandle file)
 {
 	return ftell((FILE*)file);
 }
+
+bool ShellFileInterface::SaveFile(const Rml::String& path, const Rml::String& data)
+{
+	FILE* fp = fopen(path.c_str(), "wb");
+	if (!fp)
+		return false;
+
+	const size_t written_size = fwrite(data.data(), 1, data.size(), fp);
+	const bool close_success = (fclose(fp) == 0);
+
+	return written_size == data.size() && close_success;
+}
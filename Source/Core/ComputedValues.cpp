@@ -70,7 +70,7 @@ String Style::ComputedValues::cursor() const
 
 float Style::ComputedValues::letter_spacing() const
 {
-	if (inherited.has_letter_spacing)
+	if (inherited->has_letter_spacing)
 	{
 		if (auto p = element->GetProperty(PropertyId::LetterSpacing))
 			return element->ResolveLength(p->GetNumericValue());
@@ -0,0 +1,103 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "ComputedValuesCache.h"
+#include <new>
+
+namespace Rml {
+
+static ComputedValuesCache* active_cache = nullptr;
+
+ComputedValuesCache::Scope::Scope(const Element* parent) : previous(active_cache), cache(parent)
+{
+	active_cache = (parent ? &cache : nullptr);
+}
+
+ComputedValuesCache::Scope::~Scope()
+{
+	active_cache = previous;
+}
+
+ComputedValuesCache* ComputedValuesCache::GetActive(const Element* parent)
+{
+	if (active_cache && parent && active_cache->parent == parent)
+		return active_cache;
+	return nullptr;
+}
+
+ComputedValuesCache::ComputedValuesCache(const Element* parent) : parent(parent) {}
+
+ComputedValuesCache::~ComputedValuesCache()
+{
+	for (int i = 0; i < num_entries; i++)
+		GetValues(i).~ComputedValues();
+}
+
+const Style::ComputedValues* ComputedValuesCache::Find(const ElementDefinition* definition) const
+{
+	for (int i = 0; i < num_entries; i++)
+	{
+		if (definitions[i] == definition)
+			return &GetValues(i);
+	}
+	return nullptr;
+}
+
+void ComputedValuesCache::Insert(const ElementDefinition* definition, const Style::ComputedValues& source_values)
+{
+	int index = -1;
+	for (int i = 0; i < num_entries; i++)
+	{
+		if (definitions[i] == definition)
+		{
+			index = i;
+			break;
+		}
+	}
+
+	if (index < 0)
+	{
+		if (num_entries < max_num_entries)
+		{
+			index = num_entries++;
+			new (&values[index]) Style::ComputedValues(nullptr);
+		}
+		else
+		{
+			index = next_entry;
+			next_entry = (next_entry + 1) % max_num_entries;
+		}
+		definitions[index] = definition;
+	}
+
+	Style::ComputedValues& entry = GetValues(index);
+	entry.CopyNonInherited(source_values);
+	entry.CopyInherited(source_values);
+}
+
+} // namespace Rml
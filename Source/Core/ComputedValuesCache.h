@@ -0,0 +1,94 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_COMPUTEDVALUESCACHE_H
+#define RMLUI_CORE_COMPUTEDVALUESCACHE_H
+
+#include "../../Include/RmlUi/Core/ComputedValues.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+#include <type_traits>
+
+namespace Rml {
+
+class Element;
+class ElementDefinition;
+
+/**
+    Shares computed values between sibling elements with identical style inputs.
+
+    A cache is active while the children of an element are being updated. During this time the parent's computed values, the
+    document's font size, the dp-ratio and the viewport dimensions are fixed, so siblings with the same definition and without any
+    inline properties compute identical values. Only the most recently computed definitions are kept, which covers the common case of
+    long lists of similar elements.
+ */
+
+class ComputedValuesCache : NonCopyMoveable {
+public:
+	// Activates a cache for the children of the given element while in scope, or deactivates caching if parent is nullptr.
+	class Scope;
+
+	// Returns the cache for the children of the given element, or nullptr if no such cache is active.
+	static ComputedValuesCache* GetActive(const Element* parent);
+
+	// Returns the values computed for a sibling with the given definition, or nullptr if none are cached.
+	const Style::ComputedValues* Find(const ElementDefinition* definition) const;
+	// Stores the values computed for an element with the given definition, replacing the oldest entry when full.
+	void Insert(const ElementDefinition* definition, const Style::ComputedValues& values);
+
+private:
+	explicit ComputedValuesCache(const Element* parent);
+	~ComputedValuesCache();
+
+	static constexpr int max_num_entries = 4;
+
+	using ValuesStorage = std::aligned_storage<sizeof(Style::ComputedValues), alignof(Style::ComputedValues)>::type;
+
+	Style::ComputedValues& GetValues(int index) { return *reinterpret_cast<Style::ComputedValues*>(&values[index]); }
+	const Style::ComputedValues& GetValues(int index) const { return *reinterpret_cast<const Style::ComputedValues*>(&values[index]); }
+
+	const Element* parent;
+	int num_entries = 0;
+	int next_entry = 0;
+
+	// The values are only constructed when inserted, so that an unused cache is cheap to set up for every updated element.
+	const ElementDefinition* definitions[max_num_entries];
+	ValuesStorage values[max_num_entries];
+};
+
+class ComputedValuesCache::Scope : NonCopyMoveable {
+public:
+	explicit Scope(const Element* parent);
+	~Scope();
+
+private:
+	ComputedValuesCache* previous;
+	ComputedValuesCache cache;
+};
+
+} // namespace Rml
+#endif
@@ -40,10 +40,12 @@
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "DataModel.h"
 #include "EventDispatcher.h"
+#include "FrameStatisticsCollector.h"
 #include "PluginRegistry.h"
 #include "RmlUi/Core/Debug.h"
 #include "ScrollController.h"
 #include "StreamFile.h"
+#include "TextBatcher.h"
 #include <algorithm>
 #include <iterator>
 #include <limits>
@@ -56,7 +58,7 @@ static constexpr float UNIT_SCROLL_LENGTH = 80.f;   // [dp]
 
 Context::Context(const String& name) :
 	name(name), dimensions(0, 0), density_independent_pixel_ratio(1.0f), mouse_position(0, 0), clip_origin(-1, -1), clip_dimensions(-1, -1),
-	next_update_timeout(0)
+	num_culled_elements(0), next_update_timeout(0)
 {
 	instancer = nullptr;
 
@@ -178,6 +180,18 @@ bool Context::Update()
 {
 	RMLUI_ZoneScoped;
 
+	// Start collecting the statistics of a new frame.
+	frame_statistics = current_frame_statistics;
+	current_frame_statistics = FrameStatistics();
+	if (element_recorder)
+	{
+		ElementFrameStatisticsList recorded_statistics = element_recorder->Take();
+		if (element_statistics_enabled)
+			element_statistics = std::move(recorded_statistics);
+	}
+	FrameStatisticsCollector::Scope statistics_scope(&current_frame_statistics, element_statistics_enabled ? element_recorder.get() : nullptr);
+	FrameStatisticsCollector::Timer update_timer(&FrameStatistics::update_time);
+
 	next_update_timeout = std::numeric_limits<double>::infinity();
 
 	if (scroll_controller->Update(mouse_position, density_independent_pixel_ratio))
@@ -188,8 +202,11 @@ bool Context::Update()
 		UpdateHoverChain(mouse_position);
 
 	// Update all the data models before updating properties and layout.
-	for (auto& data_model : data_models)
-		data_model.second->Update(true);
+	{
+		FrameStatisticsCollector::Timer timer(&FrameStatistics::data_model_time);
+		for (auto& data_model : data_models)
+			data_model.second->Update(true);
+	}
 
 	// The style definition of each document should be independent of each other. By manually resetting these flags we avoid unnecessary definition
 	// lookups in unrelated documents, such as when adding a new document. Adding an element dirties the parent definition, which in this case is the
@@ -199,12 +216,15 @@ bool Context::Update()
 
 	root->Update(density_independent_pixel_ratio, Vector2f(dimensions));
 
-	for (int i = 0; i < root->GetNumChildren(); ++i)
 	{
-		if (auto doc = root->GetChild(i)->GetOwnerDocument())
+		FrameStatisticsCollector::Timer timer(&FrameStatistics::layout_time);
+		for (int i = 0; i < root->GetNumChildren(); ++i)
 		{
-			doc->UpdateLayout();
-			doc->UpdatePosition();
+			if (auto doc = root->GetChild(i)->GetOwnerDocument())
+			{
+				doc->UpdateLayout();
+				doc->UpdatePosition();
+			}
 		}
 	}
 
@@ -218,9 +238,18 @@ bool Context::Render()
 {
 	RMLUI_ZoneScoped;
 
+	FrameStatisticsCollector::Scope statistics_scope(&current_frame_statistics, element_statistics_enabled ? element_recorder.get() : nullptr);
+	FrameStatisticsCollector::Timer render_timer(&FrameStatistics::render_time);
+	const double initial_geometry_time = current_frame_statistics.geometry_time;
+
+	num_culled_elements = 0;
+
+	TextBatcher::BeginFrame();
+
 	ElementUtilities::ApplyActiveClipRegion(this);
 
 	root->Render();
+	TextBatcher::Flush();
 
 	ElementUtilities::SetClippingRegion(nullptr, this);
 
@@ -231,11 +260,60 @@ bool Context::Render()
 		cursor_proxy->SetOffset(
 			Vector2f((float)Math::Clamp(mouse_position.x, 0, dimensions.x), (float)Math::Clamp(mouse_position.y, 0, dimensions.y)), nullptr);
 		cursor_proxy->Render();
+		TextBatcher::Flush();
 	}
 
+	// Geometry is generated lazily during rendering, don't count it towards the time spent submitting geometry.
+	current_frame_statistics.render_time -= current_frame_statistics.geometry_time - initial_geometry_time;
+
 	return true;
 }
 
+int Context::GetNumCulledElements() const
+{
+	return num_culled_elements;
+}
+
+const FrameStatistics& Context::GetFrameStatistics() const
+{
+	return frame_statistics;
+}
+
+void Context::EnableElementStatistics(bool enable)
+{
+	if (enable && !element_recorder)
+		element_recorder = MakeUnique<FrameStatisticsCollector::ElementRecorder>();
+
+	element_statistics_enabled = enable;
+	if (!enable)
+		element_statistics.clear();
+}
+
+const ElementFrameStatisticsList& Context::GetElementStatistics() const
+{
+	return element_statistics;
+}
+
+void Context::EnableDocumentArenas(bool enable)
+{
+	document_arenas_enabled = enable;
+}
+
+bool Context::AreDocumentArenasEnabled() const
+{
+	return document_arenas_enabled;
+}
+
+void Context::EnableTextBatching(bool enable)
+{
+	text_batching_enabled = enable;
+}
+
+bool Context::IsTextBatchingEnabled() const
+{
+	return text_batching_enabled;
+}
+
 ElementDocument* Context::CreateDocument(const String& instancer_name)
 {
 	ElementPtr element = Factory::InstanceElement(nullptr, instancer_name, documents_base_tag, XMLAttributes());
@@ -580,7 +658,8 @@ bool Context::ProcessMouseMove(int x, int y, int key_modifier_state)
 	mouse_active = true;
 
 	// Update the current hover chain. This will send all necessary 'onmouseout', 'onmouseover', 'ondragout' and 'ondragover' messages.
-	Dictionary parameters, drag_parameters;
+	Dictionary parameters = std::move(mouse_move_parameters);
+	Dictionary drag_parameters = std::move(mouse_move_drag_parameters);
 	UpdateHoverChain(old_mouse_position, key_modifier_state, &parameters, &drag_parameters);
 
 	// Dispatch any 'onmousemove' events.
@@ -595,6 +674,9 @@ bool Context::ProcessMouseMove(int x, int y, int key_modifier_state)
 		}
 	}
 
+	mouse_move_parameters = std::move(parameters);
+	mouse_move_drag_parameters = std::move(drag_parameters);
+
 	return !IsMouseInteracting();
 }
 
@@ -1119,7 +1201,8 @@ void Context::UpdateHoverChain(Vector2i old_mouse_position, int key_modifier_sta
 	}
 
 	// Build the new hover chain.
-	ElementSet new_hover_chain;
+	ElementSet new_hover_chain = std::move(hover_chain_buffer);
+	new_hover_chain.clear();
 	Element* element = hover;
 	while (element != nullptr)
 	{
@@ -1136,7 +1219,8 @@ void Context::UpdateHoverChain(Vector2i old_mouse_position, int key_modifier_sta
 	{
 		drag_hover = GetElementAtPoint(position, drag);
 
-		ElementSet new_drag_hover_chain;
+		ElementSet new_drag_hover_chain = std::move(drag_hover_chain_buffer);
+		new_drag_hover_chain.clear();
 		element = drag_hover;
 		while (element != nullptr)
 		{
@@ -1152,10 +1236,12 @@ void Context::UpdateHoverChain(Vector2i old_mouse_position, int key_modifier_sta
 		}
 
 		drag_hover_chain.swap(new_drag_hover_chain);
+		drag_hover_chain_buffer = std::move(new_drag_hover_chain);
 	}
 
 	// Swap the new chain in.
 	hover_chain.swap(new_hover_chain);
+	hover_chain_buffer = std::move(new_hover_chain);
 }
 
 Element* Context::GetElementAtPoint(Vector2f point, const Element* ignore_element, Element* element) const
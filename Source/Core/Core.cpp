@@ -70,6 +70,11 @@ static SystemInterface* system_interface = nullptr;
 static FileInterface* file_interface = nullptr;
 // RmlUi's font engine interface.
 static FontEngineInterface* font_interface = nullptr;
+// RmlUi's task scheduler interface, optional.
+static TaskSchedulerInterface* task_scheduler_interface = nullptr;
+// Directory of the persistent font cache, empty when disabled.
+static String font_cache_directory;
+static bool font_distance_field_rendering = false;
 
 // Default interfaces should be created and destroyed on Initialise and Shutdown, respectively.
 static UniquePtr<FileInterface> default_file_interface;
@@ -181,6 +186,9 @@ void Shutdown()
 	render_interface = nullptr;
 	file_interface = nullptr;
 	system_interface = nullptr;
+	task_scheduler_interface = nullptr;
+	font_cache_directory.clear();
+	font_distance_field_rendering = false;
 
 	default_file_interface.reset();
 
@@ -241,6 +249,16 @@ FontEngineInterface* GetFontEngineInterface()
 	return font_interface;
 }
 
+void SetTaskSchedulerInterface(TaskSchedulerInterface* _task_scheduler_interface)
+{
+	task_scheduler_interface = _task_scheduler_interface;
+}
+
+TaskSchedulerInterface* GetTaskSchedulerInterface()
+{
+	return task_scheduler_interface;
+}
+
 Context* CreateContext(const String& name, const Vector2i dimensions)
 {
 	if (!initialised)
@@ -324,6 +342,26 @@ bool LoadFontFace(const byte* data, int data_size, const String& font_family, St
 	return font_interface->LoadFontFace(data, data_size, font_family, style, weight, fallback_face);
 }
 
+void SetFontCacheDirectory(const String& directory)
+{
+	font_cache_directory = directory;
+}
+
+const String& GetFontCacheDirectory()
+{
+	return font_cache_directory;
+}
+
+void SetFontDistanceFieldRendering(bool enable)
+{
+	font_distance_field_rendering = enable;
+}
+
+bool GetFontDistanceFieldRendering()
+{
+	return font_distance_field_rendering;
+}
+
 void RegisterPlugin(Plugin* plugin)
 {
 	if (initialised)
@@ -350,6 +388,11 @@ StringList GetTextureSourceList()
 	return TextureDatabase::GetSourceList();
 }
 
+Vector<Pair<String, Vector2i>> GetLoadedTextures()
+{
+	return TextureDatabase::GetLoadedTextures();
+}
+
 void ReleaseTextures()
 {
 	TextureDatabase::ReleaseTextures();
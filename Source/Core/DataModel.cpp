@@ -156,13 +156,15 @@ bool DataModel::BindVariable(const String& name, DataVariable variable)
 		return false;
 	}
 
-	bool inserted = variables.emplace(name, variable).second;
+	bool inserted = variable_indices.emplace(name, (int)variables.size()).second;
 	if (!inserted)
 	{
 		Log::Message(Log::LT_WARNING, "Data model variable with name '%s' already exists.", name.c_str());
 		return false;
 	}
 
+	variables.push_back(variable);
+
 	return true;
 }
 
@@ -215,7 +217,7 @@ bool DataModel::InsertAlias(Element* element, const String& alias_name, DataAddr
 		return false;
 	}
 
-	if (variables.count(alias_name) == 1)
+	if (variable_indices.count(alias_name) == 1)
 		Log::Message(Log::LT_WARNING, "Alias variable '%s' is shadowed by a global variable.", alias_name.c_str());
 
 	auto& map = aliases.emplace(element, SmallUnorderedMap<String, DataAddress>()).first->second;
@@ -243,8 +245,8 @@ DataAddress DataModel::ResolveAddress(const String& address_str, Element* elemen
 
 	const String& first_name = address.front().name;
 
-	auto it = variables.find(first_name);
-	if (it != variables.end())
+	auto it = variable_indices.find(first_name);
+	if (it != variable_indices.end())
 		return address;
 
 	// Look for a variable alias for the first name.
@@ -286,10 +288,28 @@ DataVariable DataModel::GetVariable(const DataAddress& address) const
 	if (address.empty())
 		return DataVariable();
 
-	auto it = variables.find(address.front().name);
-	if (it != variables.end())
+	const DataAddressEntry& front = address.front();
+	int variable_index = -1;
+
+	if (front.cache_owner == this)
+	{
+		variable_index = front.cache_index;
+	}
+	else
+	{
+		auto it = variable_indices.find(front.name);
+		if (it != variable_indices.end())
+		{
+			variable_index = it->second;
+			front.cache_owner = this;
+			front.cache_index = variable_index;
+		}
+	}
+
+	if (variable_index >= 0)
 	{
-		DataVariable variable = it->second;
+		RMLUI_ASSERT(variable_index < (int)variables.size());
+		DataVariable variable = variables[variable_index];
 
 		for (int i = 1; i < (int)address.size() && variable; i++)
 		{
@@ -334,7 +354,7 @@ bool DataModel::GetVariableInto(const DataAddress& address, Variant& out_value)
 void DataModel::DirtyVariable(const String& variable_name)
 {
 	RMLUI_ASSERTMSG(LegalVariableName(variable_name) == nullptr, "Illegal variable name provided. Only top-level variables can be dirtied.");
-	RMLUI_ASSERTMSG(variables.count(variable_name) == 1, "In DirtyVariable: Variable name not found among added variables.");
+	RMLUI_ASSERTMSG(variable_indices.count(variable_name) == 1, "In DirtyVariable: Variable name not found among added variables.");
 	dirty_variables.emplace(variable_name);
 }
 
@@ -346,8 +366,8 @@ bool DataModel::IsVariableDirty(const String& variable_name) const
 
 void DataModel::DirtyAllVariables()
 {
-	dirty_variables.reserve(variables.size());
-	for (const auto& variable : variables)
+	dirty_variables.reserve(variable_indices.size());
+	for (const auto& variable : variable_indices)
 	{
 		dirty_variables.emplace(variable.first);
 	}
@@ -85,7 +85,9 @@ private:
 	UniquePtr<DataViews> views;
 	UniquePtr<DataControllers> controllers;
 
-	UnorderedMap<String, DataVariable> variables;
+	// Variables are only ever appended, so that variable indices cached in data addresses stay valid.
+	Vector<DataVariable> variables;
+	UnorderedMap<String, int> variable_indices;
 	DirtyVariables dirty_variables;
 
 	UnorderedMap<String, UniquePtr<FuncDefinition>> function_variable_definitions;
@@ -97,6 +97,12 @@ StructDefinition::StructDefinition() : VariableDefinition(DataVariableType::Stru
 
 DataVariable StructDefinition::Child(void* ptr, const DataAddressEntry& address)
 {
+	if (address.cache_owner == this)
+	{
+		RMLUI_ASSERT(address.cache_index >= 0 && address.cache_index < (int)members.size());
+		return DataVariable(members[address.cache_index].get(), ptr);
+	}
+
 	const String& name = address.name;
 	if (name.empty())
 	{
@@ -104,24 +110,27 @@ DataVariable StructDefinition::Child(void* ptr, const DataAddressEntry& address)
 		return DataVariable();
 	}
 
-	auto it = members.find(name);
-	if (it == members.end())
+	auto it = member_indices.find(name);
+	if (it == member_indices.end())
 	{
 		Log::Message(Log::LT_WARNING, "Member %s not found in data struct.", name.c_str());
 		return DataVariable();
 	}
 
-	VariableDefinition* next_definition = it->second.get();
+	const int member_index = it->second;
+	address.cache_owner = this;
+	address.cache_index = member_index;
 
-	return DataVariable(next_definition, ptr);
+	return DataVariable(members[member_index].get(), ptr);
 }
 
 void StructDefinition::AddMember(const String& name, UniquePtr<VariableDefinition> member)
 {
 	RMLUI_ASSERT(member);
-	bool inserted = members.emplace(name, std::move(member)).second;
+	bool inserted = member_indices.emplace(name, (int)members.size()).second;
 	RMLUI_ASSERTMSG(inserted, "Member name already exists.");
-	(void)inserted;
+	if (inserted)
+		members.push_back(std::move(member));
 }
 
 FuncDefinition::FuncDefinition(DataGetFunc get, DataSetFunc set) :
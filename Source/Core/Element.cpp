@@ -44,15 +44,19 @@
 #include "../../Include/RmlUi/Core/TransformPrimitive.h"
 #include "Clock.h"
 #include "ComputeProperty.h"
+#include "ComputedValuesCache.h"
 #include "DataModel.h"
 #include "ElementAnimation.h"
+#include "ElementArena.h"
 #include "ElementBackgroundBorder.h"
 #include "ElementDecoration.h"
 #include "ElementDefinition.h"
 #include "ElementStyle.h"
 #include "EventDispatcher.h"
 #include "EventSpecification.h"
+#include "FrameStatisticsCollector.h"
 #include "Layout/LayoutEngine.h"
+#include "Layout/ParallelLayout.h"
 #include "PluginRegistry.h"
 #include "Pool.h"
 #include "PropertiesIterator.h"
@@ -62,6 +66,7 @@
 #include "TransformUtilities.h"
 #include "XMLParseTools.h"
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 
 namespace Rml {
@@ -90,25 +95,96 @@ static float GetScrollOffsetDelta(ScrollAlignment alignment, float begin_offset,
 	return 0.f;
 }
 
-// Meta objects for element collected in a single struct to reduce memory allocations
-struct ElementMeta {
-	ElementMeta(Element* el) : event_dispatcher(el), style(el), background_border(), decoration(el), scroll(el), computed_values(el) {}
+// Event listeners of an element, only created once the first listener is attached.
+struct ElementEventMeta {
+	ElementEventMeta(Element* el) : event_dispatcher(el) {}
 	SmallUnorderedMap<EventId, EventListener*> attribute_event_listeners;
 	EventDispatcher event_dispatcher;
+};
+
+// Meta objects for element collected in a single struct to reduce memory allocations. Components which most elements never use, such as
+// '#text' nodes and plain containers, are created separately on first use.
+struct ElementMeta {
+	ElementMeta(Element* el) : style(el), background_border(), computed_values(el) {}
 	ElementStyle style;
 	ElementBackgroundBorder background_border;
-	ElementDecoration decoration;
-	ElementScroll scroll;
 	Style::ComputedValues computed_values;
+
+	UniquePtr<ElementEventMeta> events;
+	UniquePtr<ElementDecoration> decoration;
+	UniquePtr<ElementScroll> scroll;
 };
 
+static ElementEventMeta& GetOrCreateEventMeta(ElementMeta* meta, Element* element)
+{
+	if (!meta->events)
+		meta->events = MakeUnique<ElementEventMeta>(element);
+	return *meta->events;
+}
+
 static Pool<ElementMeta> element_meta_chunk_pool(200, true);
 
+// Incremented whenever any scroll offset changes, invalidating the scroll translation of all elements. Offsets may be set from parallel layout tasks.
+static std::atomic<unsigned int> scroll_generation{1};
+
+static void DirtyScrollTranslations()
+{
+	// Skip zero on wrap-around, as it is the initial generation of the elements.
+	unsigned int generation = scroll_generation.load(std::memory_order_relaxed);
+	unsigned int next_generation;
+	do
+	{
+		next_generation = (generation + 1 == 0 ? 1 : generation + 1);
+	} while (!scroll_generation.compare_exchange_weak(generation, next_generation, std::memory_order_relaxed));
+}
+
+// Returns true if the rectangles overlap, including touching edges.
+static bool Overlaps(Rectanglef a, Rectanglef b)
+{
+	return !(a.Left() > b.Right() || a.Right() < b.Left() || a.Top() > b.Bottom() || a.Bottom() < b.Top());
+}
+
+// Returns true if the given bounds are guaranteed to be invisible, being outside the active clip region or the context's viewport. The bounds
+// are given in absolute coordinates before the transform is applied.
+static bool IsOutsideVisibleArea(Context* context, const TransformState* transform_state, Rectanglef bounds)
+{
+	// The clip region is applied under the same transform as the element itself, thus we can compare it directly to the untransformed bounds.
+	Vector2i clip_origin, clip_dimensions;
+	if (context->GetActiveClipRegion(clip_origin, clip_dimensions))
+	{
+		if (!Overlaps(bounds, Rectanglef::FromPositionSize(Vector2f(clip_origin), Vector2f(clip_dimensions))))
+			return true;
+	}
+
+	if (const Matrix4f* transform = (transform_state ? transform_state->GetTransform() : nullptr))
+	{
+		// Find the bounding box of the projected corners. Corners at or behind the viewer cannot be projected properly, never cull in this case.
+		const Vector2f corners[4] = {bounds.TopLeft(), {bounds.Right(), bounds.Top()}, {bounds.Left(), bounds.Bottom()}, bounds.BottomRight()};
+		for (int i = 0; i < 4; i++)
+		{
+			const Vector4f projected = *transform * Vector4f(corners[i].x, corners[i].y, 0.f, 1.f);
+			if (projected.w < 1e-5f)
+				return false;
+
+			const Vector2f point = Vector2f(projected.x, projected.y) / projected.w;
+			if (i == 0)
+				bounds = Rectanglef::FromPosition(point);
+			else
+				bounds.Join(point);
+		}
+	}
+
+	return !Overlaps(bounds, Rectanglef::FromSize(Vector2f(context->GetDimensions())));
+}
+
 Element::Element(const String& tag) :
 	local_stacking_context(false), local_stacking_context_forced(false), stacking_context_dirty(false), computed_values_are_default_initialized(true),
 	visible(true), offset_fixed(false), absolute_offset_dirty(true), dirty_definition(false), dirty_child_definitions(false), dirty_animation(false),
-	dirty_transition(false), dirty_transform(false), dirty_perspective(false), tag(tag), relative_offset_base(0, 0), relative_offset_position(0, 0),
-	absolute_offset(0, 0), scroll_offset(0, 0)
+	dirty_transition(false), dirty_transform(false), dirty_perspective(false), meta_from_arena(false), max_content_width_valid(false),
+	max_content_width_independent(false), content_height_valid(false), children(ArenaAllocator<ElementPtr>(ElementArena::GetActive())), tag(tag),
+	relative_offset_base(0, 0), relative_offset_position(0, 0), absolute_offset(0, 0), scroll_offset(0, 0), scroll_translation(0, 0),
+	scroll_translation_generation(0), max_content_width(0), max_content_containing_block(0, 0), content_height(0), content_height_width(0),
+	content_height_containing_block(0), stacking_context(ArenaAllocator<Element*>(ElementArena::GetActive()))
 {
 	RMLUI_ASSERT(tag == StringUtilities::ToLower(tag));
 	parent = nullptr;
@@ -125,7 +201,15 @@ Element::Element(const String& tag) :
 
 	z_index = 0;
 
-	meta = element_meta_chunk_pool.AllocateAndConstruct(this);
+	if (ElementArena* arena = ElementArena::GetActive())
+	{
+		meta = arena->AllocateAndConstruct<ElementMeta>(this);
+		meta_from_arena = true;
+	}
+	else
+	{
+		meta = element_meta_chunk_pool.AllocateAndConstruct(this);
+	}
 	data_model = nullptr;
 }
 
@@ -148,7 +232,25 @@ Element::~Element()
 	children.clear();
 	num_non_dom_children = 0;
 
-	element_meta_chunk_pool.DestroyAndDeallocate(meta);
+	if (meta_from_arena)
+		ElementArena::DestroyAndDeallocate(meta);
+	else
+		element_meta_chunk_pool.DestroyAndDeallocate(meta);
+}
+
+void* Element::AllocateListStorage(ElementArena* arena, size_t size)
+{
+	if (arena)
+		return arena->Allocate(size);
+	return ::operator new(size);
+}
+
+void Element::DeallocateListStorage(ElementArena* arena, void* ptr)
+{
+	if (arena)
+		ElementArena::Deallocate(ptr);
+	else
+		::operator delete(ptr);
 }
 
 void Element::Update(float dp_ratio, Vector2f vp_dimensions)
@@ -165,7 +267,8 @@ void Element::Update(float dp_ratio, Vector2f vp_dimensions)
 	HandleAnimationProperty();
 	AdvanceAnimations();
 
-	meta->scroll.Update();
+	if (meta->scroll)
+		meta->scroll->Update();
 
 	UpdateProperties(dp_ratio, vp_dimensions);
 
@@ -177,10 +280,16 @@ void Element::Update(float dp_ratio, Vector2f vp_dimensions)
 		UpdateProperties(dp_ratio, vp_dimensions);
 	}
 
-	meta->decoration.InstanceDecorators();
+	if (meta->decoration)
+		meta->decoration->InstanceDecorators();
 
-	for (size_t i = 0; i < children.size(); i++)
-		children[i]->Update(dp_ratio, vp_dimensions);
+	{
+		// Let siblings share their computed values, only worthwhile when there is more than one child.
+		ComputedValuesCache::Scope computed_values_cache(children.size() > 1 ? this : nullptr);
+
+		for (size_t i = 0; i < children.size(); i++)
+			children[i]->Update(dp_ratio, vp_dimensions);
+	}
 
 	if (!animations.empty() && IsVisible(true))
 	{
@@ -195,6 +304,9 @@ void Element::UpdateProperties(const float dp_ratio, const Vector2f vp_dimension
 
 	if (meta->style.AnyPropertiesDirty())
 	{
+		FrameStatisticsCollector::Timer timer(&FrameStatistics::property_time);
+		FrameStatisticsCollector::Count(&FrameStatistics::elements_updated);
+
 		const ComputedValues* parent_values = parent ? &parent->GetComputedValues() : nullptr;
 		const ComputedValues* document_values = owner_document ? &owner_document->GetComputedValues() : nullptr;
 
@@ -236,14 +348,42 @@ void Element::Render()
 	// Set up the clipping region for this element.
 	if (ElementUtilities::SetClippingRegion(this))
 	{
-		meta->background_border.Render(this);
-		meta->decoration.RenderDecorators();
+		Context* context = GetContext();
+
+		// Backgrounds, borders, and decorators are all rendered within our boxes, skip them when they cannot be seen. Descendants are culled
+		// individually as they are rendered, since they may overflow this element.
+		const Vector2f border_position = GetAbsoluteOffset(BoxArea::Border);
+		Rectanglef bounds = Rectanglef::FromPositionSize(border_position, main_box.GetSize(BoxArea::Border));
+		for (const PositionedBox& additional_box : additional_boxes)
+			bounds.Join(Rectanglef::FromPositionSize(border_position + additional_box.offset, additional_box.box.GetSize(BoxArea::Border)));
+
+		bool culled = false;
+		if (IsOutsideVisibleArea(context, transform_state.get(), bounds))
+		{
+			culled = true;
+		}
+		else
+		{
+			FrameStatisticsCollector::RenderElementScope statistics_scope(this);
+			meta->background_border.Render(this);
+			if (meta->decoration)
+				meta->decoration->RenderDecorators();
+		}
 
+		if (GetRenderBounds(bounds) && IsOutsideVisibleArea(context, transform_state.get(), bounds))
+		{
+			culled = true;
+		}
+		else
 		{
 			RMLUI_ZoneScopedNC("OnRender", 0x228B22);
 
+			FrameStatisticsCollector::RenderElementScope statistics_scope(this);
 			OnRender();
 		}
+
+		if (culled)
+			context->num_culled_elements += 1;
 	}
 
 	// Render all elements in our local stacking context.
@@ -390,29 +530,51 @@ Vector2f Element::GetRelativeOffset(BoxArea area)
 }
 
 Vector2f Element::GetAbsoluteOffset(BoxArea area)
+{
+	return GetUnscrolledAbsoluteOffset() - GetScrollTranslation() + GetBox().GetPosition(area);
+}
+
+Vector2f Element::GetUnscrolledAbsoluteOffset()
 {
 	if (absolute_offset_dirty)
 	{
 		absolute_offset_dirty = false;
 
 		if (offset_parent)
-			absolute_offset = offset_parent->GetAbsoluteOffset(BoxArea::Border) + relative_offset_base + relative_offset_position;
+			absolute_offset = offset_parent->GetUnscrolledAbsoluteOffset() + relative_offset_base + relative_offset_position;
 		else
 			absolute_offset = relative_offset_base + relative_offset_position;
 
+		// There may be relatively positioned elements between ourself and our containing block, add their relative offsets as well.
 		if (!offset_fixed)
 		{
-			// Add any parent scrolling onto our position as well.
-			if (offset_parent)
-				absolute_offset -= offset_parent->scroll_offset;
-
-			// Finally, there may be relatively positioned elements between ourself and our containing block, add their relative offsets as well.
 			for (Element* ancestor = parent; ancestor && ancestor != offset_parent; ancestor = ancestor->parent)
 				absolute_offset += ancestor->relative_offset_position;
 		}
 	}
 
-	return absolute_offset + GetBox().GetPosition(area);
+	return absolute_offset;
+}
+
+Vector2f Element::GetScrollTranslation()
+{
+	if (scroll_translation_generation != scroll_generation)
+	{
+		scroll_translation_generation = scroll_generation;
+
+		if (offset_parent)
+		{
+			scroll_translation = offset_parent->GetScrollTranslation();
+
+			// Add any parent scrolling onto our position as well.
+			if (!offset_fixed)
+				scroll_translation += offset_parent->scroll_offset;
+		}
+		else
+			scroll_translation = Vector2f(0, 0);
+	}
+
+	return scroll_translation;
 }
 
 void Element::SetClientArea(BoxArea _client_area)
@@ -433,22 +595,25 @@ void Element::SetScrollableOverflowRectangle(Vector2f _scrollable_overflow_recta
 
 		scroll_offset.x = Math::Min(scroll_offset.x, GetScrollWidth() - GetClientWidth());
 		scroll_offset.y = Math::Min(scroll_offset.y, GetScrollHeight() - GetClientHeight());
-		DirtyAbsoluteOffset();
+		DirtyScrollTranslations();
 	}
 }
 
 void Element::SetBox(const Box& box)
 {
+	FrameStatisticsCollector::RecordElement(this, &ElementFrameStatistics::layout_updated);
+
 	if (box != main_box || additional_boxes.size() > 0)
 	{
 		main_box = box;
 		additional_boxes.clear();
 
-		OnResize();
+		ParallelLayout::CallElement(this, &Element::OnResize);
 
 		meta->background_border.DirtyBackground();
 		meta->background_border.DirtyBorder();
-		meta->decoration.DirtyDecoratorsData();
+		if (meta->decoration)
+			meta->decoration->DirtyDecoratorsData();
 	}
 }
 
@@ -456,11 +621,12 @@ void Element::AddBox(const Box& box, Vector2f offset)
 {
 	additional_boxes.emplace_back(PositionedBox{box, offset});
 
-	OnResize();
+	ParallelLayout::CallElement(this, &Element::OnResize);
 
 	meta->background_border.DirtyBackground();
 	meta->background_border.DirtyBorder();
-	meta->decoration.DirtyDecoratorsData();
+	if (meta->decoration)
+		meta->decoration->DirtyDecoratorsData();
 }
 
 const Box& Element::GetBox()
@@ -877,12 +1043,12 @@ float Element::GetClientTop()
 
 float Element::GetClientWidth()
 {
-	return GetBox().GetSize(client_area).x - meta->scroll.GetScrollbarSize(ElementScroll::VERTICAL);
+	return GetBox().GetSize(client_area).x - (meta->scroll ? meta->scroll->GetScrollbarSize(ElementScroll::VERTICAL) : 0.f);
 }
 
 float Element::GetClientHeight()
 {
-	return GetBox().GetSize(client_area).y - meta->scroll.GetScrollbarSize(ElementScroll::HORIZONTAL);
+	return GetBox().GetSize(client_area).y - (meta->scroll ? meta->scroll->GetScrollbarSize(ElementScroll::HORIZONTAL) : 0.f);
 }
 
 Element* Element::GetOffsetParent()
@@ -921,8 +1087,9 @@ void Element::SetScrollLeft(float scroll_left)
 	if (new_offset != scroll_offset.x)
 	{
 		scroll_offset.x = new_offset;
-		meta->scroll.UpdateScrollbar(ElementScroll::HORIZONTAL);
-		DirtyAbsoluteOffset();
+		if (meta->scroll)
+			meta->scroll->UpdateScrollbar(ElementScroll::HORIZONTAL);
+		DirtyScrollTranslations();
 
 		DispatchEvent(EventId::Scroll, Dictionary());
 	}
@@ -939,8 +1106,9 @@ void Element::SetScrollTop(float scroll_top)
 	if (new_offset != scroll_offset.y)
 	{
 		scroll_offset.y = new_offset;
-		meta->scroll.UpdateScrollbar(ElementScroll::VERTICAL);
-		DirtyAbsoluteOffset();
+		if (meta->scroll)
+			meta->scroll->UpdateScrollbar(ElementScroll::VERTICAL);
+		DirtyScrollTranslations();
 
 		DispatchEvent(EventId::Scroll, Dictionary());
 	}
@@ -1154,23 +1322,25 @@ void Element::Click()
 void Element::AddEventListener(const String& event, EventListener* listener, const bool in_capture_phase)
 {
 	const EventId id = EventSpecificationInterface::GetIdOrInsert(event);
-	meta->event_dispatcher.AttachEvent(id, listener, in_capture_phase);
+	GetEventDispatcher()->AttachEvent(id, listener, in_capture_phase);
 }
 
 void Element::AddEventListener(const EventId id, EventListener* listener, const bool in_capture_phase)
 {
-	meta->event_dispatcher.AttachEvent(id, listener, in_capture_phase);
+	GetEventDispatcher()->AttachEvent(id, listener, in_capture_phase);
 }
 
 void Element::RemoveEventListener(const String& event, EventListener* listener, bool in_capture_phase)
 {
 	EventId id = EventSpecificationInterface::GetIdOrInsert(event);
-	meta->event_dispatcher.DetachEvent(id, listener, in_capture_phase);
+	if (meta->events)
+		meta->events->event_dispatcher.DetachEvent(id, listener, in_capture_phase);
 }
 
 void Element::RemoveEventListener(EventId id, EventListener* listener, bool in_capture_phase)
 {
-	meta->event_dispatcher.DetachEvent(id, listener, in_capture_phase);
+	if (meta->events)
+		meta->events->event_dispatcher.DetachEvent(id, listener, in_capture_phase);
 }
 
 bool Element::DispatchEvent(const String& type, const Dictionary& parameters)
@@ -1529,22 +1699,47 @@ void Element::QuerySelectorAll(ElementList& elements, const String& selectors)
 
 EventDispatcher* Element::GetEventDispatcher() const
 {
-	return &meta->event_dispatcher;
+	return &GetOrCreateEventMeta(meta, const_cast<Element*>(this)).event_dispatcher;
+}
+
+EventDispatcher* Element::FindEventDispatcher() const
+{
+	return meta->events ? &meta->events->event_dispatcher : nullptr;
 }
 
 String Element::GetEventDispatcherSummary() const
 {
-	return meta->event_dispatcher.ToString();
+	return meta->events ? meta->events->event_dispatcher.ToString() : String();
 }
 
 ElementDecoration* Element::GetElementDecoration() const
 {
-	return &meta->decoration;
+	if (!meta->decoration)
+		meta->decoration = MakeUnique<ElementDecoration>(const_cast<Element*>(this));
+	return meta->decoration.get();
 }
 
 ElementScroll* Element::GetElementScroll() const
 {
-	return &meta->scroll;
+	if (!meta->scroll)
+		meta->scroll = MakeUnique<ElementScroll>(const_cast<Element*>(this));
+	return meta->scroll.get();
+}
+
+ElementScroll* Element::FindElementScroll() const
+{
+	return meta->scroll.get();
+}
+
+ElementMemoryUsage Element::GetMemoryUsage() const
+{
+	ElementMemoryUsage usage;
+	usage.element = sizeof(Element);
+	usage.meta = sizeof(ElementMeta);
+	usage.event_dispatcher = (meta->events ? sizeof(ElementEventMeta) : 0);
+	usage.decoration = (meta->decoration ? sizeof(ElementDecoration) : 0);
+	usage.scroll = (meta->scroll ? sizeof(ElementScroll) : 0);
+	return usage;
 }
 
 DataModel* Element::GetDataModel() const
@@ -1574,6 +1769,11 @@ void Element::OnUpdate() {}
 
 void Element::OnRender() {}
 
+bool Element::GetRenderBounds(Rectanglef& /*bounds*/)
+{
+	return false;
+}
+
 void Element::OnResize() {}
 
 void Element::OnLayout() {}
@@ -1607,8 +1807,9 @@ void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 		{
 			static constexpr bool IN_CAPTURE_PHASE = false;
 
-			auto& attribute_event_listeners = meta->attribute_event_listeners;
-			auto& event_dispatcher = meta->event_dispatcher;
+			ElementEventMeta& events = GetOrCreateEventMeta(meta, this);
+			auto& attribute_event_listeners = events.attribute_event_listeners;
+			auto& event_dispatcher = events.event_dispatcher;
 			const auto event_id = EventSpecificationInterface::GetIdOrInsert(attribute.substr(2));
 			const auto remove_event_listener_if_exists = [&attribute_event_listeners, &event_dispatcher, event_id]() {
 				const auto listener_it = attribute_event_listeners.find(event_id);
@@ -1662,33 +1863,28 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		changed_properties.Contains(PropertyId::Left)      //
 	);
 
-	// See if the document layout needs to be updated.
-	if (!IsLayoutDirty())
+	// Force a relayout if any of the changed properties require it. This is done even if the document layout is already dirty, so that any cached
+	// intrinsic sizes of this element and its ancestors are invalidated.
+	const PropertyIdSet changed_properties_forcing_layout = (changed_properties & StyleSheetSpecification::GetRegisteredPropertiesForcingLayout());
+
+	if (!changed_properties_forcing_layout.Empty())
+	{
+		DirtyLayout();
+	}
+	else if (top_right_bottom_left_changed && !IsLayoutDirty())
 	{
-		// Force a relayout if any of the changed properties require it.
-		const PropertyIdSet changed_properties_forcing_layout =
-			(changed_properties & StyleSheetSpecification::GetRegisteredPropertiesForcingLayout());
+		// Normally, the position properties only affect the position of the element and not the layout. Thus, these properties are not registered
+		// as affecting layout. However, when absolutely positioned elements with both left & right, or top & bottom are set to definite values,
+		// they affect the size of the element and thereby also the layout. This layout-dirtying condition needs to be registered manually.
+		using namespace Style;
+		const ComputedValues& computed = GetComputedValues();
+		const bool absolutely_positioned = (computed.position() == Position::Absolute || computed.position() == Position::Fixed);
+		const bool sized_width = (computed.width().type == Width::Auto && computed.left().type != Left::Auto && computed.right().type != Right::Auto);
+		const bool sized_height =
+			(computed.height().type == Height::Auto && computed.top().type != Top::Auto && computed.bottom().type != Bottom::Auto);
 
-		if (!changed_properties_forcing_layout.Empty())
-		{
+		if (absolutely_positioned && (sized_width || sized_height))
 			DirtyLayout();
-		}
-		else if (top_right_bottom_left_changed)
-		{
-			// Normally, the position properties only affect the position of the element and not the layout. Thus, these properties are not registered
-			// as affecting layout. However, when absolutely positioned elements with both left & right, or top & bottom are set to definite values,
-			// they affect the size of the element and thereby also the layout. This layout-dirtying condition needs to be registered manually.
-			using namespace Style;
-			const ComputedValues& computed = GetComputedValues();
-			const bool absolutely_positioned = (computed.position() == Position::Absolute || computed.position() == Position::Fixed);
-			const bool sized_width =
-				(computed.width().type == Width::Auto && computed.left().type != Left::Auto && computed.right().type != Right::Auto);
-			const bool sized_height =
-				(computed.height().type == Height::Auto && computed.top().type != Top::Auto && computed.bottom().type != Bottom::Auto);
-
-			if (absolutely_positioned && (sized_width || sized_height))
-				DirtyLayout();
-		}
 	}
 
 	// Update the position.
@@ -1793,7 +1989,9 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 	// Dirty the decoration if it's changed.
 	if (border_radius_changed || changed_properties.Contains(PropertyId::Decorator))
 	{
-		meta->decoration.DirtyDecorators();
+		// Decorations are only created once the element is given a decorator.
+		if (meta->decoration || meta->computed_values.has_decorator())
+			GetElementDecoration()->DirtyDecorators();
 	}
 
 	// Dirty the decoration data when its visual looks may have changed.
@@ -1801,7 +1999,8 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		changed_properties.Contains(PropertyId::Opacity) || //
 		changed_properties.Contains(PropertyId::ImageColor))
 	{
-		meta->decoration.DirtyDecoratorsData();
+		if (meta->decoration)
+			meta->decoration->DirtyDecoratorsData();
 	}
 
 	// Check for `perspective' and `perspective-origin' changes
@@ -1841,6 +2040,13 @@ void Element::OnChildRemove(Element* /*child*/) {}
 
 void Element::DirtyLayout()
 {
+	// The intrinsic sizes of any ancestor may depend on our layout, so all of them must be measured again.
+	for (Element* element = this; element; element = element->parent)
+	{
+		element->max_content_width_valid = false;
+		element->content_height_valid = false;
+	}
+
 	if (Element* document = GetOwnerDocument())
 		document->DirtyLayout();
 }
@@ -2036,6 +2242,9 @@ void Element::SetParent(Element* _parent)
 
 void Element::DirtyAbsoluteOffset()
 {
+	// The offset parent may have changed, which also affects the scroll translation of this element and its descendants.
+	DirtyScrollTranslations();
+
 	if (!absolute_offset_dirty)
 		DirtyAbsoluteOffsetRecursive();
 }
@@ -2330,6 +2539,9 @@ void Element::UpdateDefinition()
 		// combinators, but those are handled during the DirtyDefinition call.
 		dirty_child_definitions = true;
 
+		FrameStatisticsCollector::Timer timer(&FrameStatistics::definition_time);
+		FrameStatisticsCollector::Count(&FrameStatistics::definitions_updated);
+		FrameStatisticsCollector::RecordElement(this, &ElementFrameStatistics::definition_updated);
 		GetStyle()->UpdateDefinition();
 	}
 
@@ -2654,6 +2866,11 @@ void Element::DirtyTransformState(bool perspective_dirty, bool transform_dirty)
 
 void Element::UpdateTransformState()
 {
+	// Transforms are resolved in absolute coordinates. Scrolling does not visit descendants, thus changes to our offset due to scrolling of
+	// any ancestor must be detected here.
+	if (transform_state && !dirty_transform && transform_state->GetReferenceOffset() != GetAbsoluteOffset(BoxArea::Border))
+		DirtyTransformState(true, true);
+
 	if (!dirty_perspective && !dirty_transform)
 		return;
 
@@ -2804,11 +3021,15 @@ void Element::UpdateTransformState()
 	{
 		transform_state.reset();
 	}
+
+	if (transform_state)
+		transform_state->SetReferenceOffset(pos);
 }
 
 void Element::OnStyleSheetChangeRecursive()
 {
-	GetElementDecoration()->DirtyDecorators();
+	if (meta->decoration)
+		meta->decoration->DirtyDecorators();
 
 	OnStyleSheetChange();
 
@@ -2820,7 +3041,8 @@ void Element::OnStyleSheetChangeRecursive()
 
 void Element::OnDpRatioChangeRecursive()
 {
-	GetElementDecoration()->DirtyDecorators();
+	if (meta->decoration)
+		meta->decoration->DirtyDecorators();
 	GetStyle()->DirtyPropertiesWithUnits(Unit::DP_SCALABLE_LENGTH);
 
 	OnDpRatioChange();
@@ -0,0 +1,148 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "ElementArena.h"
+#include "../../Include/RmlUi/Core/Debug.h"
+
+namespace Rml {
+
+struct ElementArena::Chunk {
+	Chunk* next;
+};
+
+struct ElementArena::Header {
+	ElementArena* arena;
+};
+
+static constexpr size_t AlignUp(size_t size, size_t alignment)
+{
+	return (size + alignment - 1) & ~(alignment - 1);
+}
+
+static ElementArena* active_arena = nullptr;
+
+ElementArena* ElementArena::Create()
+{
+	return new ElementArena();
+}
+
+void ElementArena::Release()
+{
+	RemoveReference();
+}
+
+ElementArena::Scope::Scope(ElementArena* arena) : previous(active_arena)
+{
+	active_arena = arena;
+}
+
+ElementArena::Scope::~Scope()
+{
+	active_arena = previous;
+}
+
+ElementArena* ElementArena::GetActive()
+{
+	return active_arena;
+}
+
+size_t ElementArena::GetReservedSize() const
+{
+	return reserved_size;
+}
+
+int ElementArena::GetNumAllocations() const
+{
+	return num_references - 1;
+}
+
+ElementArena::~ElementArena()
+{
+	RMLUI_ASSERT(num_references == 0);
+	RMLUI_ASSERT(active_arena != this);
+
+	Chunk* chunk = chunks;
+	while (chunk)
+	{
+		Chunk* next = chunk->next;
+		delete[] reinterpret_cast<unsigned char*>(chunk);
+		chunk = next;
+	}
+}
+
+void* ElementArena::Allocate(size_t size)
+{
+	constexpr size_t header_size = AlignUp(sizeof(Header), alignment);
+	const size_t allocation_size = header_size + AlignUp(size, alignment);
+
+	if (!chunk_cursor || allocation_size > size_t(chunk_end - chunk_cursor))
+	{
+		// Oversized allocations get a chunk of their own, the current chunk can still be used for the next allocations.
+		constexpr size_t chunk_header_size = AlignUp(sizeof(Chunk), alignment);
+		const size_t new_chunk_size = (allocation_size > chunk_size - chunk_header_size ? chunk_header_size + allocation_size : chunk_size);
+
+		Chunk* chunk = new (new unsigned char[new_chunk_size]) Chunk{chunks};
+		chunks = chunk;
+		reserved_size += new_chunk_size;
+
+		unsigned char* begin = reinterpret_cast<unsigned char*>(chunk) + chunk_header_size;
+		if (new_chunk_size == chunk_size)
+		{
+			chunk_cursor = begin;
+			chunk_end = reinterpret_cast<unsigned char*>(chunk) + chunk_size;
+		}
+		else
+		{
+			Header* header = new (begin) Header{this};
+			num_references += 1;
+			return reinterpret_cast<unsigned char*>(header) + header_size;
+		}
+	}
+
+	Header* header = new (chunk_cursor) Header{this};
+	chunk_cursor += allocation_size;
+	num_references += 1;
+	return reinterpret_cast<unsigned char*>(header) + header_size;
+}
+
+void ElementArena::Deallocate(void* ptr)
+{
+	constexpr size_t header_size = AlignUp(sizeof(Header), alignment);
+	Header* header = reinterpret_cast<Header*>(static_cast<unsigned char*>(ptr) - header_size);
+	header->arena->RemoveReference();
+}
+
+void ElementArena::RemoveReference()
+{
+	RMLUI_ASSERT(num_references > 0);
+	num_references -= 1;
+	if (num_references == 0)
+		delete this;
+}
+
+} // namespace Rml
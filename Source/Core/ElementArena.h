@@ -0,0 +1,112 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_ELEMENTARENA_H
+#define RMLUI_CORE_ELEMENTARENA_H
+
+#include "../../Include/RmlUi/Core/Traits.h"
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace Rml {
+
+/**
+    A monotonic arena backing the elements of a single document, and their components.
+
+    Memory is handed out linearly from large chunks and never reused, instead all chunks are freed in one step when the arena is
+    released by its document and every allocation has been deallocated. Elements moved out of the document keep the arena alive until
+    they are destroyed as well.
+ */
+
+class ElementArena : NonCopyMoveable {
+public:
+	// Creates a new arena, owned by the caller until released.
+	static ElementArena* Create();
+	// Releases the owner's reference to the arena. The memory is freed once all allocations are deallocated too.
+	void Release();
+
+	// Makes the given arena active while in scope, or deactivates any arena if nullptr.
+	class Scope : NonCopyMoveable {
+	public:
+		explicit Scope(ElementArena* arena);
+		~Scope();
+
+	private:
+		ElementArena* previous;
+	};
+
+	// Returns the arena that elements should currently be allocated from, or nullptr if none.
+	static ElementArena* GetActive();
+
+	template <typename T, typename... Args>
+	T* AllocateAndConstruct(Args&&... args)
+	{
+		static_assert(alignof(T) <= alignment, "Type is over-aligned for the element arena.");
+		return new (Allocate(sizeof(T))) T(std::forward<Args>(args)...);
+	}
+	template <typename T>
+	static void DestroyAndDeallocate(T* object)
+	{
+		object->~T();
+		Deallocate(object);
+	}
+
+	// Returns memory prefixed with a header pointing back to this arena, used to find the arena on deallocation.
+	void* Allocate(size_t size);
+	// Releases memory allocated from any arena. The memory is only reclaimed once its whole arena is freed.
+	static void Deallocate(void* ptr);
+
+	// Returns the number of bytes reserved by the arena.
+	size_t GetReservedSize() const;
+	// Returns the number of live allocations from the arena.
+	int GetNumAllocations() const;
+
+private:
+	struct Chunk;
+	struct Header;
+
+	static constexpr size_t alignment = alignof(std::max_align_t);
+	static constexpr size_t chunk_size = 64 * 1024;
+
+	ElementArena() = default;
+	~ElementArena();
+
+	void RemoveReference();
+
+	Chunk* chunks = nullptr;
+	unsigned char* chunk_cursor = nullptr;
+	unsigned char* chunk_end = nullptr;
+	size_t reserved_size = 0;
+
+	// The owner reference plus one reference for every live allocation.
+	int num_references = 1;
+};
+
+} // namespace Rml
+#endif
@@ -31,6 +31,7 @@
 #include "../../Include/RmlUi/Core/ComputedValues.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/GeometryUtilities.h"
+#include "FrameStatisticsCollector.h"
 
 namespace Rml {
 
@@ -40,6 +41,8 @@ void ElementBackgroundBorder::Render(Element* element)
 {
 	if (background_dirty || border_dirty)
 	{
+		FrameStatisticsCollector::Timer timer(&FrameStatistics::geometry_time);
+		FrameStatisticsCollector::RecordElement(element, &ElementFrameStatistics::geometry_generated);
 		GenerateGeometry(element);
 
 		background_dirty = false;
@@ -34,6 +34,7 @@
 #include "../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
+#include "FrameStatisticsCollector.h"
 
 namespace Rml {
 
@@ -48,6 +49,7 @@ void ElementDecoration::InstanceDecorators()
 {
 	if (decorators_dirty)
 	{
+		FrameStatisticsCollector::Timer timer(&FrameStatistics::decorator_time);
 		decorators_dirty = false;
 		decorators_data_dirty = true;
 		ReloadDecorators();
@@ -107,7 +109,10 @@ void ElementDecoration::ReloadDecoratorsData()
 {
 	if (decorators_data_dirty)
 	{
+		FrameStatisticsCollector::Timer timer(&FrameStatistics::geometry_time);
 		decorators_data_dirty = false;
+		if (!decorators.empty())
+			FrameStatisticsCollector::RecordElement(element, &ElementFrameStatistics::geometry_generated);
 
 		for (DecoratorHandle& decorator : decorators)
 		{
@@ -35,13 +35,16 @@
 #include "../../Include/RmlUi/Core/StyleSheet.h"
 #include "../../Include/RmlUi/Core/StyleSheetContainer.h"
 #include "DocumentHeader.h"
+#include "ElementArena.h"
 #include "ElementStyle.h"
 #include "EventDispatcher.h"
+#include "FrameStatisticsCollector.h"
 #include "Layout/LayoutEngine.h"
 #include "StreamFile.h"
 #include "StyleSheetFactory.h"
 #include "Template.h"
 #include "TemplateCache.h"
+#include "TextBatcher.h"
 #include "XMLParseTools.h"
 
 namespace Rml {
@@ -49,6 +52,7 @@ namespace Rml {
 ElementDocument::ElementDocument(const String& tag) : Element(tag)
 {
 	context = nullptr;
+	arena = nullptr;
 
 	modal = false;
 	layout_dirty = true;
@@ -61,7 +65,12 @@ ElementDocument::ElementDocument(const String& tag) : Element(tag)
 	SetProperty(PropertyId::Position, Property(Style::Position::Absolute));
 }
 
-ElementDocument::~ElementDocument() {}
+ElementDocument::~ElementDocument()
+{
+	// The arena is kept alive by any remaining elements allocated from it, such as our own children which are destroyed after this.
+	if (arena)
+		arena->Release();
+}
 
 void ElementDocument::ProcessHeader(const DocumentHeader* document_header)
 {
@@ -397,6 +406,7 @@ void ElementDocument::UpdateLayout()
 	{
 		RMLUI_ZoneScoped;
 		RMLUI_ZoneText(source_url.c_str(), source_url.size());
+		FrameStatisticsCollector::Count(&FrameStatistics::layout_passes);
 
 		Vector2f containing_block(0, 0);
 		if (GetParentNode() != nullptr)
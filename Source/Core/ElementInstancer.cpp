@@ -28,6 +28,7 @@
 
 #include "../../Include/RmlUi/Core/ElementInstancer.h"
 #include "../../Include/RmlUi/Core/ElementText.h"
+#include "ElementArena.h"
 #include "Pool.h"
 #include "XMLParseTools.h"
 
@@ -38,8 +39,49 @@ ElementInstancer::~ElementInstancer() {}
 static Pool<Element> pool_element(200, true);
 static Pool<ElementText> pool_text_default(200, true);
 
+/**
+    Instances elements from the active document arena, and releases them back to it. Elements are only instanced through this instancer
+    directly when they are cloned, in which case the clone is allocated from the heap if no arena is active.
+ */
+template <typename T>
+class ElementInstancerArena final : public ElementInstancer {
+public:
+	// Returns a new element allocated from the active arena, or nullptr if no arena is active.
+	ElementPtr InstanceFromActiveArena(const String& tag)
+	{
+		ElementArena* arena = ElementArena::GetActive();
+		if (!arena)
+			return nullptr;
+
+		T* ptr = arena->AllocateAndConstruct<T>(tag);
+		ptr->SetInstancer(this);
+		return ElementPtr(static_cast<Element*>(ptr));
+	}
+
+	ElementPtr InstanceElement(Element* parent, const String& tag, const XMLAttributes& attributes) override
+	{
+		if (ElementPtr element = InstanceFromActiveArena(tag))
+			return element;
+
+		ElementPtr element = heap_instancer.InstanceElement(parent, tag, attributes);
+		element->SetInstancer(&heap_instancer);
+		return element;
+	}
+
+	void ReleaseElement(Element* element) override { ElementArena::DestroyAndDeallocate(static_cast<T*>(element)); }
+
+private:
+	ElementInstancerGeneric<T> heap_instancer;
+};
+
+static ElementInstancerArena<Element> arena_instancer_element;
+static ElementInstancerArena<ElementText> arena_instancer_text;
+
 ElementPtr ElementInstancerElement::InstanceElement(Element* /*parent*/, const String& tag, const XMLAttributes& /*attributes*/)
 {
+	if (ElementPtr element = arena_instancer_element.InstanceFromActiveArena(tag))
+		return element;
+
 	Element* ptr = pool_element.AllocateAndConstruct(tag);
 	return ElementPtr(ptr);
 }
@@ -65,6 +107,9 @@ ElementInstancerElement::~ElementInstancerElement()
 
 ElementPtr ElementInstancerText::InstanceElement(Element* /*parent*/, const String& tag, const XMLAttributes& /*attributes*/)
 {
+	if (ElementPtr element = arena_instancer_text.InstanceFromActiveArena(tag))
+		return element;
+
 	ElementText* ptr = pool_text_default.AllocateAndConstruct(tag);
 	return ElementPtr(static_cast<Element*>(ptr));
 }
@@ -44,8 +44,10 @@
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/TransformPrimitive.h"
 #include "ComputeProperty.h"
+#include "ComputedValuesCache.h"
 #include "ElementDecoration.h"
 #include "ElementDefinition.h"
+#include "FrameStatisticsCollector.h"
 #include "PropertiesIterator.h"
 #include <algorithm>
 
@@ -515,6 +517,20 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 
 	RMLUI_ZoneScopedC(0xFF7F50);
 
+	// Siblings with the same definition and no inline properties compute identical values, in that case share them when available.
+	ComputedValuesCache* cache = nullptr;
+	if (definition && inline_properties.GetNumProperties() == 0)
+		cache = ComputedValuesCache::GetActive(element->GetParentNode());
+
+	if (cache)
+	{
+		if (const Style::ComputedValues* shared_values = cache->Find(definition.get()))
+		{
+			ShareValues(values, *shared_values);
+			return PropagateDirtyProperties();
+		}
+	}
+
 	// Generally, this is how it works:
 	//   1. Assign default values (clears any removed properties)
 	//   2. Inherit inheritable values from parent
@@ -890,7 +906,42 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 			GetFontEngineInterface()->GetFontFaceHandle(values.font_family(), values.font_style(), values.font_weight(), (int)values.font_size()));
 	}
 
-	// Next, pass inheritable dirty properties onto our children
+	if (cache)
+		cache->Insert(definition.get(), values);
+
+	return PropagateDirtyProperties();
+}
+
+void ElementStyle::ShareValues(Style::ComputedValues& values, const Style::ComputedValues& shared_values)
+{
+	FrameStatisticsCollector::Count(&FrameStatistics::computed_values_shared);
+
+	const float font_size_before = values.font_size();
+	const Style::LineHeight line_height_before = values.line_height();
+
+	values.CopyNonInherited(shared_values);
+	values.CopyInherited(shared_values);
+
+	// Dirty the same dependent properties as when computing the values, so that the element and its children are notified of the changes.
+	if (font_size_before != values.font_size())
+	{
+		dirty_properties.Insert(PropertyId::LineHeight);
+
+		for (auto it = Iterate(); !it.AtEnd(); ++it)
+		{
+			auto name_property_pair = *it;
+			if (name_property_pair.second.unit == Unit::EM)
+				dirty_properties.Insert(name_property_pair.first);
+		}
+	}
+
+	if (line_height_before.value != values.line_height().value || line_height_before.inherit_value != values.line_height().inherit_value)
+		dirty_properties.Insert(PropertyId::VerticalAlign);
+}
+
+PropertyIdSet ElementStyle::PropagateDirtyProperties()
+{
+	// Pass inheritable dirty properties onto our children
 	PropertyIdSet dirty_inherited_properties = (dirty_properties & StyleSheetSpecification::GetRegisteredInheritedProperties());
 
 	if (!dirty_inherited_properties.Empty())
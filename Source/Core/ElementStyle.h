@@ -147,6 +147,11 @@ private:
 	// Sets a list of properties as dirty.
 	void DirtyProperties(const PropertyIdSet& properties);
 
+	// Assigns the values computed for a sibling with identical style inputs, and dirties any dependent properties.
+	void ShareValues(Style::ComputedValues& values, const Style::ComputedValues& shared_values);
+	// Dirties inherited properties on our children, then clears and returns the dirty properties.
+	PropertyIdSet PropagateDirtyProperties();
+
 	static const Property* GetLocalProperty(PropertyId id, const PropertyDictionary& inline_properties, const ElementDefinition* definition);
 	static const Property* GetProperty(PropertyId id, const Element* element, const PropertyDictionary& inline_properties,
 		const ElementDefinition* definition);
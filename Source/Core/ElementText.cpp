@@ -39,6 +39,9 @@
 #include "ComputeProperty.h"
 #include "ElementDefinition.h"
 #include "ElementStyle.h"
+#include "FrameStatisticsCollector.h"
+#include "TextBatcher.h"
+#include "TransformState.h"
 
 namespace Rml {
 
@@ -46,6 +49,10 @@ static bool BuildToken(String& token, const char*& token_begin, const char* stri
 	bool break_at_endline, Style::TextTransform text_transformation, bool decode_escape_characters);
 static bool LastToken(const char* token_begin, const char* string_end, bool collapse_white_space, bool break_at_endline);
 
+// Geometry revisions are unique across all text elements, so that the text batcher never confuses the geometry of a new element for an old one.
+// The counter is wide enough to never wrap around in practice.
+static uint64_t next_geometry_revision = 1;
+
 void LogMissingFontFace(Element* element)
 {
 	const String font_family_property = element->GetProperty<String>("font-family");
@@ -66,9 +73,9 @@ void LogMissingFontFace(Element* element)
 }
 
 ElementText::ElementText(const String& tag) :
-	Element(tag), colour(255, 255, 255), opacity(1), font_handle_version(0), geometry_dirty(true), dirty_layout_on_change(true),
+	Element(tag), colour(255, 255, 255), opacity(1), font_handle_version(0), geometry_revision(0), geometry_dirty(true), dirty_layout_on_change(true),
 	generated_decoration(Style::TextDecoration::None), decoration_property(Style::TextDecoration::None), font_effects_dirty(true),
-	font_effects_handle(0)
+	font_effects_handle(0), geometry_bounds(Rectanglef::MakeInvalid())
 {}
 
 ElementText::~ElementText() {}
@@ -110,8 +117,14 @@ void ElementText::OnRender()
 	}
 
 	// Regenerate the geometry if the colour or font configuration has altered.
+	bool geometry_changed = false;
 	if (geometry_dirty)
+	{
+		FrameStatisticsCollector::Timer timer(&FrameStatistics::geometry_time);
+		FrameStatisticsCollector::RecordElement(this, &ElementFrameStatistics::geometry_generated);
 		GenerateGeometry(font_face_handle);
+		geometry_changed = true;
+	}
 
 	// Regenerate text decoration if necessary.
 	if (decoration_property != generated_decoration)
@@ -131,46 +144,51 @@ void ElementText::OnRender()
 		}
 
 		generated_decoration = decoration_property;
+		geometry_changed = true;
+	}
+
+	if (geometry_changed)
+	{
+		UpdateGeometryBounds();
+		geometry_revision = next_geometry_revision++;
 	}
 
 	const Vector2f translation = GetAbsoluteOffset();
 
-	bool render = true;
-	Vector2i clip_origin;
-	Vector2i clip_dimensions;
-	if (GetContext()->GetActiveClipRegion(clip_origin, clip_dimensions))
+	if (TextBatcher* text_batcher = GetTextBatcher())
 	{
-		const FontMetrics& font_metrics = GetFontEngineInterface()->GetFontMetrics(GetFontFaceHandle());
-		float clip_top = (float)clip_origin.y;
-		float clip_left = (float)clip_origin.x;
-		float clip_right = (float)(clip_origin.x + clip_dimensions.x);
-		float clip_bottom = (float)(clip_origin.y + clip_dimensions.y);
-		float ascent = font_metrics.ascent;
-		float descent = font_metrics.descent;
-
-		render = false;
-		for (const Line& line : lines)
-		{
-			float x_left = translation.x + line.position.x;
-			float x_right = x_left + line.width;
-			float y = translation.y + line.position.y;
-			float y_top = y - ascent;
-			float y_bottom = y + descent;
-
-			render = !(x_left > clip_right || x_right < clip_left || y_top > clip_bottom || y_bottom < clip_top);
-			if (render)
-				break;
-		}
-	}
+		for (size_t i = 0; i < geometry.size(); ++i)
+			text_batcher->Render(geometry[i], geometry_revision, translation);
 
-	if (render)
+		if (decoration)
+			text_batcher->Render(*decoration, geometry_revision, translation);
+	}
+	else
 	{
 		for (size_t i = 0; i < geometry.size(); ++i)
 			geometry[i].Render(translation);
+
+		if (decoration)
+			decoration->Render(translation);
 	}
+}
 
-	if (decoration)
-		decoration->Render(translation);
+TextBatcher* ElementText::GetTextBatcher()
+{
+	ElementDocument* document = GetOwnerDocument();
+	Context* context = GetContext();
+	if (!document || !context || !context->IsTextBatchingEnabled())
+		return nullptr;
+
+	// The transform is applied to each draw call by the render interface, thus transformed text is rendered separately.
+	const TransformState* transform_state = GetTransformState();
+	if (transform_state && transform_state->GetTransform())
+		return nullptr;
+
+	if (!document->text_batcher)
+		document->text_batcher = MakeUnique<TextBatcher>();
+
+	return document->text_batcher.get();
 }
 
 bool ElementText::GenerateLine(String& line, int& line_length, float& line_width, int line_begin, float maximum_line_width, float right_spacing_width,
@@ -299,12 +317,10 @@ bool ElementText::GenerateLine(String& line, int& line_length, float& line_width
 
 void ElementText::ClearLines()
 {
-	// Clear the rendering information.
-	for (size_t i = 0; i < geometry.size(); ++i)
-		geometry[i].Release(true);
-
+	// The old geometry is released when regenerated during rendering, this way no render calls are made during layout.
 	lines.clear();
 	generated_decoration = Style::TextDecoration::None;
+	geometry_dirty = true;
 }
 
 void ElementText::AddLine(Vector2f line_position, String line)
@@ -441,6 +457,38 @@ bool ElementText::UpdateFontEffects()
 	return false;
 }
 
+bool ElementText::GetRenderBounds(Rectanglef& bounds)
+{
+	// The bounds are only known once the current geometry has been generated, which happens during OnRender.
+	if (geometry_dirty || font_effects_dirty || decoration_property != generated_decoration || !geometry_bounds.Valid())
+		return false;
+
+	const Vector2f translation = GetAbsoluteOffset();
+	bounds = Rectanglef::FromCorners(geometry_bounds.TopLeft() + translation, geometry_bounds.BottomRight() + translation);
+	return true;
+}
+
+void ElementText::UpdateGeometryBounds()
+{
+	geometry_bounds = Rectanglef::MakeInvalid();
+
+	auto JoinVertices = [this](Geometry& geometry_item) {
+		for (const Vertex& vertex : geometry_item.GetVertices())
+		{
+			if (geometry_bounds.Valid())
+				geometry_bounds.Join(vertex.position);
+			else
+				geometry_bounds = Rectanglef::FromPosition(vertex.position);
+		}
+	};
+
+	for (Geometry& geometry_item : geometry)
+		JoinVertices(geometry_item);
+
+	if (decoration)
+		JoinVertices(*decoration);
+}
+
 void ElementText::GenerateGeometry(const FontFaceHandle font_face_handle)
 {
 	RMLUI_ZoneScopedC(0xD2691E);
@@ -40,6 +40,7 @@
 #include "ElementStyle.h"
 #include "Layout/LayoutDetails.h"
 #include "Layout/LayoutEngine.h"
+#include "TextBatcher.h"
 #include "TransformState.h"
 #include <limits>
 
@@ -52,8 +53,11 @@ static void SetBox(Element* element)
 	RMLUI_ASSERT(parent != nullptr);
 
 	Vector2f containing_block = parent->GetBox().GetSize();
-	containing_block.x -= parent->GetElementScroll()->GetScrollbarSize(ElementScroll::VERTICAL);
-	containing_block.y -= parent->GetElementScroll()->GetScrollbarSize(ElementScroll::HORIZONTAL);
+	if (ElementScroll* parent_scroll = parent->FindElementScroll())
+	{
+		containing_block.x -= parent_scroll->GetScrollbarSize(ElementScroll::VERTICAL);
+		containing_block.y -= parent_scroll->GetScrollbarSize(ElementScroll::HORIZONTAL);
+	}
 
 	Box box;
 	LayoutDetails::BuildBox(box, containing_block, element);
@@ -272,6 +276,9 @@ void ElementUtilities::ApplyActiveClipRegion(Context* context)
 	Vector2i dimensions;
 	bool clip_enabled = context->GetActiveClipRegion(origin, dimensions);
 
+	// Batched text is rendered with the clipping region it was submitted under.
+	TextBatcher::Flush();
+
 	render_interface->EnableScissorRegion(clip_enabled);
 	if (clip_enabled)
 	{
@@ -332,6 +339,7 @@ bool ElementUtilities::ApplyTransform(Element& element)
 		// Do a deep comparison as well to avoid submitting a new transform which is equal.
 		if (!old_transform_ptr || !new_transform_ptr || (old_transform_value != *new_transform_ptr))
 		{
+			TextBatcher::Flush();
 			render_interface->SetTransform(new_transform_ptr);
 
 			if (new_transform_ptr)
@@ -89,6 +89,12 @@ void ElementImage::OnRender()
 	geometry.Render(GetAbsoluteOffset(BoxArea::Content).Round());
 }
 
+bool ElementImage::GetRenderBounds(Rectanglef& bounds)
+{
+	bounds = Rectanglef::FromPositionSize(GetAbsoluteOffset(BoxArea::Content).Round(), GetBox().GetSize(BoxArea::Content).Round());
+	return true;
+}
+
 void ElementImage::OnAttributeChange(const ElementAttributes& changed_attributes)
 {
 	// Call through to the base element's OnAttributeChange().
@@ -77,6 +77,8 @@ public:
 protected:
 	/// Renders the image.
 	void OnRender() override;
+	/// The image is rendered within the content box.
+	bool GetRenderBounds(Rectanglef& bounds) override;
 
 	/// Regenerates the element's geometry.
 	void OnResize() override;
@@ -125,6 +125,7 @@ WidgetTextInput::WidgetTextInput(ElementFormControl* _parent) :
 	parent->AddEventListener(EventId::Mousedown, this, true);
 	parent->AddEventListener(EventId::Dblclick, this, true);
 	parent->AddEventListener(EventId::Drag, this, true);
+	parent->AddEventListener(EventId::Scroll, this, true);
 
 	ElementPtr unique_text = Factory::InstanceElement(parent, "#text", "#text", XMLAttributes());
 	text_element = rmlui_dynamic_cast<ElementText*>(unique_text.get());
@@ -158,6 +159,10 @@ WidgetTextInput::WidgetTextInput(ElementFormControl* _parent) :
 
 	max_length = -1;
 
+	placed_lines_begin = 0;
+	placed_lines_end = 0;
+	vertical_scrollbar_used = false;
+
 	selection_anchor_index = 0;
 	selection_begin_index = 0;
 	selection_length = 0;
@@ -176,6 +181,7 @@ WidgetTextInput::~WidgetTextInput()
 	parent->RemoveEventListener(EventId::Mousedown, this, true);
 	parent->RemoveEventListener(EventId::Dblclick, this, true);
 	parent->RemoveEventListener(EventId::Drag, this, true);
+	parent->RemoveEventListener(EventId::Scroll, this, true);
 
 	// This widget might be parented by an input element, which may now be constructing a completely different type.
 	// Thus, remove all properties set by this widget so they don't affect the new type.
@@ -389,6 +395,14 @@ void WidgetTextInput::DispatchChangeEvent(bool linebreak)
 
 void WidgetTextInput::ProcessEvent(Event& event)
 {
+	// Scrolling may reveal lines not yet placed in the text elements, also when the element is disabled.
+	if (event == EventId::Scroll)
+	{
+		if (event.GetTargetElement() == parent)
+			UpdateVisibleLines(false);
+		return;
+	}
+
 	if (parent->IsDisabled())
 		return;
 
@@ -909,21 +923,9 @@ int WidgetTextInput::CalculateLineIndex(float position) const
 	return Math::Clamp(line_index, 0, (int)(lines.size() - 1));
 }
 
-float WidgetTextInput::GetAlignmentSpecificTextOffset(const char* p_begin, int line_index) const
+float WidgetTextInput::GetAlignmentSpecificTextOffset(int line_index) const
 {
-	const float client_width = parent->GetClientWidth();
-	const float total_width = (float)ElementUtilities::GetStringWidth(text_element, String(p_begin, lines[line_index].editable_length));
-	auto text_align = GetElement()->GetComputedValues().text_align();
-
-	// offset position depending on text align
-	switch (text_align)
-	{
-	case Style::TextAlign::Right: return Math::Max(0.0f, (client_width - total_width));
-	case Style::TextAlign::Center: return Math::Max(0.0f, ((client_width - total_width) / 2));
-	default: break;
-	}
-
-	return 0;
+	return lines[line_index].alignment_offset;
 }
 
 int WidgetTextInput::CalculateCharacterIndex(int line_index, float position)
@@ -935,7 +937,7 @@ int WidgetTextInput::CalculateCharacterIndex(int line_index, float position)
 
 	const char* p_begin = GetValue().data() + lines[line_index].value_offset;
 
-	position -= GetAlignmentSpecificTextOffset(p_begin, line_index);
+	position -= GetAlignmentSpecificTextOffset(line_index);
 
 	for (auto it = StringIteratorU8(p_begin, p_begin, p_begin + lines[line_index].editable_length); it;)
 	{
@@ -1021,13 +1023,17 @@ void WidgetTextInput::FormatElement()
 	else
 		scroll->DisableScrollbar(ElementScroll::HORIZONTAL);
 
-	if (y_overflow_property == Overflow::Scroll)
+	// Assume that an automatic vertical scrollbar is still needed if it was used last time, then we usually only need a single formatting round.
+	const bool expect_vertical_scrollbar = (y_overflow_property == Overflow::Auto && vertical_scrollbar_used);
+
+	if (y_overflow_property == Overflow::Scroll || expect_vertical_scrollbar)
 		scroll->EnableScrollbar(ElementScroll::VERTICAL, width);
 	else
 		scroll->DisableScrollbar(ElementScroll::VERTICAL);
 
 	// If the formatting produces scrollbars we need to format again later, this constraint enables early exit for the first formatting round.
-	const float formatting_height_constraint = (y_overflow_property == Overflow::Auto ? parent->GetClientHeight() : FLT_MAX);
+	const float formatting_height_constraint =
+		(y_overflow_property == Overflow::Auto && !expect_vertical_scrollbar ? parent->GetClientHeight() : FLT_MAX);
 
 	// Format the text and determine its total area.
 	Vector2f content_area = FormatText(formatting_height_constraint);
@@ -1036,16 +1042,23 @@ void WidgetTextInput::FormatElement()
 	if (!word_wrap && x_overflow_property == Overflow::Auto && content_area.x > parent->GetClientWidth())
 		scroll->EnableScrollbar(ElementScroll::HORIZONTAL, width);
 
-	// Now check for vertical overflow. If we do turn on the scrollbar, this will cause a reflow.
-	if (y_overflow_property == Overflow::Auto && content_area.y > parent->GetClientHeight())
+	// Now check for vertical overflow. If we do turn on or off the scrollbar, this will cause a reflow.
+	const bool vertical_overflow = (content_area.y > parent->GetClientHeight());
+	if (y_overflow_property == Overflow::Auto && vertical_overflow != expect_vertical_scrollbar)
 	{
-		scroll->EnableScrollbar(ElementScroll::VERTICAL, width);
+		if (vertical_overflow)
+			scroll->EnableScrollbar(ElementScroll::VERTICAL, width);
+		else
+			scroll->DisableScrollbar(ElementScroll::VERTICAL);
+
 		content_area = FormatText();
 
 		if (!word_wrap && x_overflow_property == Overflow::Auto && content_area.x > parent->GetClientWidth())
 			scroll->EnableScrollbar(ElementScroll::HORIZONTAL, width);
 	}
 
+	vertical_scrollbar_used = (y_overflow_property == Overflow::Auto && vertical_overflow);
+
 	parent->SetScrollableOverflowRectangle(content_area);
 	scroll->FormatScrollbars();
 }
@@ -1058,77 +1071,123 @@ Vector2f WidgetTextInput::FormatText(float height_constraint)
 	if (!font_handle)
 		return content_area;
 
-	// Clear the old lines, and all the lines in the text elements.
-	lines.clear();
-	text_element->ClearLines();
-	selected_text_element->ClearLines();
+	const float client_width = parent->GetClientWidth();
+	if (client_width <= 0.f)
+	{
+		lines.clear();
+		lines.push_back(Line{});
+		layout_cache.valid = false;
+		UpdateVisibleLines(true);
+		return content_area;
+	}
 
-	// Clear the selection background geometry, and get the vertices and indices so the new geo can
-	// be generated.
-	selection_geometry.Release(true);
-	Vector<Vertex>& selection_vertices = selection_geometry.GetVertices();
-	Vector<int>& selection_indices = selection_geometry.GetIndices();
+	LayoutLines(client_width, height_constraint);
 
-	// Determine the line-height of the text element.
+	// Clamp the cursor to a valid range.
+	absolute_cursor_index = Math::Min(absolute_cursor_index, (int)GetValue().size());
+
+	// Grow the content area width-wise to the longest line, and push the height out.
+	for (const Line& line : lines)
+		content_area.x = Math::Max(content_area.x, line.width + cursor_size.x);
+	content_area.y = float(lines.size()) * parent->GetLineHeight();
+
+	UpdateVisibleLines(true);
+
+	return content_area;
+}
+
+void WidgetTextInput::LayoutLines(const float client_width, const float height_constraint)
+{
+	const String& value = GetValue();
+	const FontFaceHandle font_handle = parent->GetFontFaceHandle();
 	const float line_height = parent->GetLineHeight();
-	const float font_baseline = GetFontEngineInterface()->GetFontMetrics(font_handle).ascent;
-	// When the selection contains endlines we expand the selection area by this width.
-	const int endline_selection_width = int(0.4f * parent->GetComputedValues().font_size());
+	const float available_width = client_width - cursor_size.x;
+	const Style::TextAlign text_align = GetElement()->GetComputedValues().text_align();
 
-	const float client_width = parent->GetClientWidth();
-	int line_begin = 0;
-	Vector2f line_position(0, font_baseline);
-	bool last_line = false;
+	LayoutCache& cache = layout_cache;
+	if (!cache.valid || cache.font_handle != font_handle || cache.client_width != client_width || cache.available_width != available_width ||
+		cache.text_align != text_align)
+	{
+		lines.clear();
+		cache.complete = false;
+		cache.value.clear();
+	}
+
+	if (cache.complete && cache.value == value)
+		return;
 
-	auto text_align = GetElement()->GetComputedValues().text_align();
+	// Find the range of the value that changed since the previous layout. The common suffix can only be used if the previous layout was complete.
+	const int old_size = (int)cache.value.size();
+	const int new_size = (int)value.size();
+	const int max_common_size = Math::Min(old_size, new_size);
 
-	struct Segment {
-		Vector2f position;
-		int width;
-		String content;
-		bool selected;
-		int line_index;
-	};
+	int prefix_size = 0;
+	while (prefix_size < max_common_size && value[prefix_size] == cache.value[prefix_size])
+		prefix_size += 1;
 
-	Vector<Segment> segments;
+	int suffix_size = 0;
+	if (cache.complete)
+	{
+		while (suffix_size < max_common_size - prefix_size && value[new_size - 1 - suffix_size] == cache.value[old_size - 1 - suffix_size])
+			suffix_size += 1;
+	}
 
-	// Keep generating lines until all the text content is placed.
-	do
+	const int size_difference = new_size - old_size;
+	const int changed_end = new_size - suffix_size;
+
+	auto EndsParagraph = [](const String& text, const Line& line) { return line.size > 0 && text[line.value_offset + line.size - 1] == '\n'; };
+
+	// Keep all the paragraphs located entirely before the change, the words in a paragraph can only wrap based on content within that paragraph.
+	int num_reused_front_lines = 0;
+	for (int i = 0; i < (int)lines.size(); i++)
 	{
-		if (client_width <= 0.f)
-		{
-			lines.push_back(Line{});
+		if (lines[i].value_offset + lines[i].size > prefix_size)
 			break;
-		}
+		if (EndsParagraph(cache.value, lines[i]))
+			num_reused_front_lines = i + 1;
+	}
 
+	LineList previous_lines = std::move(lines);
+	lines.clear();
+	lines.insert(lines.end(), std::make_move_iterator(previous_lines.begin()), std::make_move_iterator(previous_lines.begin() + num_reused_front_lines));
+
+	const bool previous_layout_complete = cache.complete;
+	int line_begin = (lines.empty() ? 0 : lines.back().value_offset + lines.back().size);
+	int previous_line_index = num_reused_front_lines;
+	bool last_line = false;
+
+	cache.complete = false;
+
+	// Keep generating lines until all the text content is placed, or until we reach a paragraph that is unchanged since the previous layout.
+	do
+	{
 		Line line = {};
 		line.value_offset = line_begin;
 		float line_width;
 		String line_content;
 
 		// Generate the next line.
-		last_line = text_element->GenerateLine(line_content, line.size, line_width, line_begin, client_width - cursor_size.x, 0, false, false, false);
+		last_line = text_element->GenerateLine(line_content, line.size, line_width, line_begin, available_width, 0, false, false, false);
 
 		// If this line terminates in a soft-return (word wrap), then the line may be leaving a space or two behind as an orphan. If so, we must
 		// append the orphan onto the line even though it will push the line outside of the input field's bounds.
 		String orphan;
 		if (!last_line && (line_content.empty() || line_content.back() != '\n'))
 		{
-			const String& text = GetValue();
 			for (int i = 1; i >= 0; --i)
 			{
 				int index = line_begin + line.size + i;
-				if (index >= (int)text.size())
+				if (index >= (int)value.size())
 					continue;
 
-				if (text[index] != ' ')
+				if (value[index] != ' ')
 				{
 					orphan.clear();
 					continue;
 				}
 
 				int next_index = index + 1;
-				if (!orphan.empty() || next_index >= (int)text.size() || text[next_index] != ' ')
+				if (!orphan.empty() || next_index >= (int)value.size() || value[next_index] != ' ')
 					orphan += ' ';
 			}
 		}
@@ -1147,103 +1206,168 @@ Vector2f WidgetTextInput::FormatText(float height_constraint)
 			line_width -= ElementUtilities::GetStringWidth(text_element, " ");
 		}
 
-		// Now that we have the string of characters appearing on the new line, we split it into
-		// three parts; the unselected text appearing before any selected text on the line, the
-		// selected text on the line, and any unselected text after the selection.
-		String pre_selection, selection, post_selection;
-		GetLineSelection(pre_selection, selection, post_selection, line_content, line_begin);
-
-		// The pre-selected text is placed, if there is any (if the selection starts on or before
-		// the beginning of this line, then this will be empty).
-		if (!pre_selection.empty())
-		{
-			const int width = ElementUtilities::GetStringWidth(text_element, pre_selection);
-			segments.push_back({line_position, width, pre_selection, false, (int)lines.size()});
-			line_position.x += width;
-		}
-
-		// Return the extra kerning that would result in joining two strings.
-		auto GetKerningBetween = [this](const String& left, const String& right) -> float {
-			if (left.empty() || right.empty())
-				return 0.0f;
-			// We could join the whole string, and compare the result of the joined width to the individual widths of each string. Instead, we take
-			// the two neighboring characters from each string and compare the string width with and without kerning, which should be much faster.
-			const Character left_back = StringUtilities::ToCharacter(StringUtilities::SeekBackwardUTF8(&left.back(), &left.front()));
-			const String right_front_u8 =
-				right.substr(0, size_t(StringUtilities::SeekForwardUTF8(right.c_str() + 1, right.c_str() + right.size()) - right.c_str()));
-			const int width_kerning = ElementUtilities::GetStringWidth(text_element, right_front_u8, left_back);
-			const int width_no_kerning = ElementUtilities::GetStringWidth(text_element, right_front_u8, Character::Null);
-			return float(width_kerning - width_no_kerning);
-		};
-
 		// Check if the editable length needs to be truncated to dodge a trailing endline.
 		line.editable_length = (int)line_content.size();
 		if (!line_content.empty() && line_content.back() == '\n')
 			line.editable_length -= 1;
 
-		// If there is any selected text on this line, place it in the selected text element and
-		// generate the geometry for its background.
-		if (!selection.empty())
+		// Offset the line position depending on text alignment.
+		line.alignment_offset = 0.f;
+		if (text_align == Style::TextAlign::Right || text_align == Style::TextAlign::Center)
 		{
-			line_position.x += GetKerningBetween(pre_selection, selection);
-			const int selection_width = ElementUtilities::GetStringWidth(selected_text_element, selection);
-			segments.push_back({line_position, selection_width, selection, true, (int)lines.size()});
+			const float total_width = (float)ElementUtilities::GetStringWidth(text_element, String(value.data() + line_begin, line.editable_length));
+			line.alignment_offset = Math::Max(0.0f, client_width - total_width);
+			if (text_align == Style::TextAlign::Center)
+				line.alignment_offset *= 0.5f;
+		}
 
-			line_position.x += selection_width;
+		line.content = std::move(line_content);
+		line.width = line_width;
+
+		// Update variables for the next line.
+		line_begin += line.size;
+
+		const bool ends_paragraph = EndsParagraph(value, line);
+		lines.push_back(std::move(line));
+
+		if (last_line)
+		{
+			cache.complete = true;
+			break;
 		}
 
-		// If there is any unselected text after the selection on this line, place it in the
-		// standard text element after the selected text.
-		if (!post_selection.empty())
+		// Past the change, the remaining lines can be reused from the previous layout once we reach the beginning of one of its paragraphs.
+		if (previous_layout_complete && ends_paragraph && line_begin >= changed_end)
 		{
-			line_position.x += GetKerningBetween(selection, post_selection);
-			const int width = ElementUtilities::GetStringWidth(text_element, post_selection);
-			segments.push_back({line_position, width, post_selection, false, (int)lines.size()});
+			while (previous_line_index < (int)previous_lines.size() && previous_lines[previous_line_index].value_offset + size_difference < line_begin)
+				previous_line_index += 1;
+
+			if (previous_line_index < (int)previous_lines.size())
+			{
+				const int previous_offset = previous_lines[previous_line_index].value_offset;
+				if (previous_offset + size_difference == line_begin && (previous_offset == 0 || cache.value[previous_offset - 1] == '\n'))
+				{
+					for (auto it = previous_lines.begin() + previous_line_index; it != previous_lines.end(); ++it)
+					{
+						it->value_offset += size_difference;
+						lines.push_back(std::move(*it));
+					}
+					cache.complete = true;
+					break;
+				}
+			}
 		}
 
-		// Update variables for the next line.
-		line_begin += line.size;
-		line_position.x = 0;
-		line_position.y += line_height;
+	} while (float(lines.size()) * line_height <= height_constraint);
 
-		// Grow the content area width-wise if this line is the longest so far, and push the height out.
-		content_area.x = Math::Max(content_area.x, line_width + cursor_size.x);
-		content_area.y = line_position.y - font_baseline;
+	cache.valid = true;
+	cache.value = value;
+	cache.font_handle = font_handle;
+	cache.client_width = client_width;
+	cache.available_width = available_width;
+	cache.text_align = text_align;
+}
 
-		// Finally, push the new line into our array of lines.
-		lines.push_back(std::move(line));
+void WidgetTextInput::UpdateVisibleLines(bool force)
+{
+	const float line_height = parent->GetLineHeight();
+	const float client_height = parent->GetClientHeight();
+	const float scroll_top = parent->GetScrollTop();
 
-	} while (!last_line && content_area.y <= height_constraint);
+	const int visible_lines_begin = (line_height > 0.f ? int(scroll_top / line_height) : 0);
+	const int visible_lines_end = (line_height > 0.f ? int((scroll_top + client_height) / line_height) + 1 : (int)lines.size());
 
-	// Clamp the cursor to a valid range.
-	absolute_cursor_index = Math::Min(absolute_cursor_index, (int)GetValue().size());
+	if (!force && visible_lines_begin >= placed_lines_begin && visible_lines_end <= placed_lines_end)
+		return;
+
+	// Place an additional page of lines above and below the visible lines.
+	const int page_size = Math::Max(visible_lines_end - visible_lines_begin, 1);
+	placed_lines_begin = visible_lines_begin - page_size;
+	placed_lines_end = visible_lines_end + page_size;
+
+	text_element->ClearLines();
+	selected_text_element->ClearLines();
+
+	// Clear the selection background geometry, and get the vertices and indices so the new geo can
+	// be generated.
+	selection_geometry.Release(true);
+	Vector<Vertex>& selection_vertices = selection_geometry.GetVertices();
+	Vector<int>& selection_indices = selection_geometry.GetIndices();
+
+	const FontFaceHandle font_handle = parent->GetFontFaceHandle();
+	if (!font_handle)
+		return;
+
+	const float font_baseline = GetFontEngineInterface()->GetFontMetrics(font_handle).ascent;
+	// When the selection contains endlines we expand the selection area by this width.
+	const int endline_selection_width = int(0.4f * parent->GetComputedValues().font_size());
 
-	// Transform segments according to text alignment
-	for (auto& it : segments)
+	// Return the extra kerning that would result in joining two strings.
+	auto GetKerningBetween = [this](const String& left, const String& right) -> float {
+		if (left.empty() || right.empty())
+			return 0.0f;
+		// We could join the whole string, and compare the result of the joined width to the individual widths of each string. Instead, we take
+		// the two neighboring characters from each string and compare the string width with and without kerning, which should be much faster.
+		const Character left_back = StringUtilities::ToCharacter(StringUtilities::SeekBackwardUTF8(&left.back(), &left.front()));
+		const String right_front_u8 =
+			right.substr(0, size_t(StringUtilities::SeekForwardUTF8(right.c_str() + 1, right.c_str() + right.size()) - right.c_str()));
+		const int width_kerning = ElementUtilities::GetStringWidth(text_element, right_front_u8, left_back);
+		const int width_no_kerning = ElementUtilities::GetStringWidth(text_element, right_front_u8, Character::Null);
+		return float(width_kerning - width_no_kerning);
+	};
+
+	const int lines_begin = Math::Clamp(placed_lines_begin, 0, (int)lines.size());
+	const int lines_end = Math::Clamp(placed_lines_end, 0, (int)lines.size());
+
+	for (int line_index = lines_begin; line_index < lines_end; line_index++)
 	{
-		auto const& line = lines[it.line_index];
-		const char* p_begin = GetValue().data() + line.value_offset;
-		float offset = GetAlignmentSpecificTextOffset(p_begin, it.line_index);
+		const Line& line = lines[line_index];
+		Vector2f line_position(line.alignment_offset, font_baseline + float(line_index) * line_height);
 
-		it.position.x += offset;
+		// Now that we have the string of characters appearing on the line, we split it into three parts; the unselected text appearing before
+		// any selected text on the line, the selected text on the line, and any unselected text after the selection.
+		String pre_selection, selection, post_selection;
+		GetLineSelection(pre_selection, selection, post_selection, line.content, line.value_offset);
 
-		if (it.selected)
+		// The pre-selected text is placed, if there is any (if the selection starts on or before
+		// the beginning of this line, then this will be empty).
+		if (!pre_selection.empty())
 		{
-			const bool selection_contains_endline = (selection_begin_index + selection_length > line_begin + lines[it.line_index].editable_length);
-			const Vector2f selection_size(float(it.width + (selection_contains_endline ? endline_selection_width : 0)), line_height);
+			text_element->AddLine(line_position, pre_selection);
+
+			// The width is only needed for placing any selected text that follows.
+			if (!selection.empty() || !post_selection.empty())
+				line_position.x += ElementUtilities::GetStringWidth(text_element, pre_selection);
+		}
+
+		// If there is any selected text on this line, place it in the selected text element and
+		// generate the geometry for its background.
+		if (!selection.empty())
+		{
+			line_position.x += GetKerningBetween(pre_selection, selection);
+			const int selection_width = ElementUtilities::GetStringWidth(selected_text_element, selection);
+
+			const bool selection_contains_endline = (selection_begin_index + selection_length > line.value_offset + line.editable_length);
+			const Vector2f selection_size(float(selection_width + (selection_contains_endline ? endline_selection_width : 0)), line_height);
 
 			selection_vertices.resize(selection_vertices.size() + 4);
 			selection_indices.resize(selection_indices.size() + 6);
 			GeometryUtilities::GenerateQuad(&selection_vertices[selection_vertices.size() - 4], &selection_indices[selection_indices.size() - 6],
-				it.position - Vector2f(0, font_baseline), selection_size, selection_colour, (int)selection_vertices.size() - 4);
+				line_position - Vector2f(0, font_baseline), selection_size, selection_colour, (int)selection_vertices.size() - 4);
+
+			selected_text_element->AddLine(line_position, selection);
 
-			selected_text_element->AddLine(it.position, it.content);
+			line_position.x += selection_width;
 		}
-		else
-			text_element->AddLine(it.position, it.content);
-	}
 
-	return content_area;
+		// If there is any unselected text after the selection on this line, place it in the
+		// standard text element after the selected text.
+		if (!post_selection.empty())
+		{
+			line_position.x += GetKerningBetween(selection, post_selection);
+			text_element->AddLine(line_position, post_selection);
+		}
+	}
 }
 
 void WidgetTextInput::GenerateCursor()
@@ -1274,6 +1398,7 @@ void WidgetTextInput::GenerateCursor()
 void WidgetTextInput::ForceFormattingOnNextLayout()
 {
 	force_formatting_on_next_layout = true;
+	layout_cache.valid = false;
 }
 
 void WidgetTextInput::UpdateCursorPosition(bool update_ideal_cursor_position)
@@ -1290,7 +1415,7 @@ void WidgetTextInput::UpdateCursorPosition(bool update_ideal_cursor_position)
 	cursor_position.x = (float)ElementUtilities::GetStringWidth(text_element, String(p_begin, cursor_character_index));
 	cursor_position.y = -1.f + (float)cursor_line_index * text_element->GetLineHeight();
 
-	cursor_position.x += GetAlignmentSpecificTextOffset(p_begin, cursor_line_index);
+	cursor_position.x += GetAlignmentSpecificTextOffset(cursor_line_index);
 
 	if (update_ideal_cursor_position)
 		ideal_cursor_position = cursor_position.x;
@@ -31,6 +31,7 @@
 
 #include "../../../Include/RmlUi/Core/EventListener.h"
 #include "../../../Include/RmlUi/Core/Geometry.h"
+#include "../../../Include/RmlUi/Core/StyleTypes.h"
 #include "../../../Include/RmlUi/Core/Vertex.h"
 #include <float.h>
 
@@ -95,7 +96,7 @@ public:
 protected:
 	enum class CursorMovement { Begin = -4, BeginLine = -3, PreviousWord = -2, Left = -1, Right = 1, NextWord = 2, EndLine = 3, End = 4 };
 
-	float GetAlignmentSpecificTextOffset(const char* p_begin, int line_index) const;
+	float GetAlignmentSpecificTextOffset(int line_index) const;
 
 	/// Processes the "keydown" and "textinput" event to write to the input field, and the "focus" and
 	/// "blur" to set the state of the cursor.
@@ -174,6 +175,13 @@ private:
 	/// @param[in] height_constraint Abort formatting when the formatted size grows larger than this height.
 	/// @return The content area of the element.
 	Vector2f FormatText(float height_constraint = FLT_MAX);
+	/// Lays out the text into lines. Only the paragraphs affected by changes to the value since the previous layout are reformatted.
+	/// @param[in] client_width The width available to the text.
+	/// @param[in] height_constraint Abort formatting when the formatted size grows larger than this height.
+	void LayoutLines(float client_width, float height_constraint);
+	/// Places the lines located in or near the visible scroll window into the text elements, and generates the selection geometry.
+	/// @param[in] force Regenerate the lines even if the scroll window is still covered by the currently placed lines.
+	void UpdateVisibleLines(bool force);
 
 	/// Updates the position to render the cursor.
 	/// @param[in] update_ideal_cursor_position Generally should be true on horizontal movement and false on vertical movement.
@@ -208,6 +216,24 @@ private:
 		int size;
 		// The length of the editable characters on the line (excluding any trailing endline).
 		int editable_length;
+		// The displayed contents of the line.
+		String content;
+		// The width of the displayed contents.
+		float width;
+		// The horizontal offset of the line resulting from text alignment.
+		float alignment_offset;
+	};
+
+	// The value and parameters of the previous layout, so that subsequent layouts can reuse any lines not affected by changes to the value.
+	struct LayoutCache {
+		bool valid = false;
+		// True if the lines cover the whole value, false if formatting was aborted due to the height constraint.
+		bool complete = false;
+		String value;
+		FontFaceHandle font_handle = 0;
+		float client_width = 0;
+		float available_width = 0;
+		Style::TextAlign text_align = Style::TextAlign::Left;
 	};
 
 	ElementFormControl* parent;
@@ -219,6 +245,13 @@ private:
 
 	using LineList = Vector<Line>;
 	LineList lines;
+	LayoutCache layout_cache;
+
+	// The range of lines placed in the text elements, extending beyond the visible lines so that smaller scrolls don't need new lines.
+	int placed_lines_begin;
+	int placed_lines_end;
+	// True if the vertical scrollbar was needed during the previous formatting.
+	bool vertical_scrollbar_used;
 
 	// Length in number of characters.
 	int max_length;
@@ -56,13 +56,32 @@ struct CompareIdPhase {
 	}
 };
 
+// The total number of listeners attached to each event id, across all dispatchers.
+static Vector<int> listener_counts;
+
+// Detaches the listeners of all descendants, skipping over elements without a dispatcher.
+static void DetachDescendantEvents(Element* element)
+{
+	for (int i = 0; i < element->GetNumChildren(true); ++i)
+	{
+		Element* child = element->GetChild(i);
+		if (EventDispatcher* dispatcher = child->FindEventDispatcher())
+			dispatcher->DetachAllEvents();
+		else
+			DetachDescendantEvents(child);
+	}
+}
+
 EventDispatcher::EventDispatcher(Element* _element) : element(_element) {}
 
 EventDispatcher::~EventDispatcher()
 {
 	// Detach from all event dispatchers
 	for (const auto& event : listeners)
+	{
+		AddListenerCount(event.id, -1);
 		event.listener->OnDetach(element);
+	}
 }
 
 void EventDispatcher::AttachEvent(const EventId id, EventListener* listener, const bool in_capture_phase)
@@ -75,6 +94,7 @@ void EventDispatcher::AttachEvent(const EventId id, EventListener* listener, con
 	if (matching_entry_it == range.second)
 	{
 		listeners.emplace(range.second, entry);
+		AddListenerCount(id, 1);
 		listener->OnAttach(element);
 	}
 }
@@ -85,6 +105,7 @@ void EventDispatcher::DetachEvent(const EventId id, EventListener* listener, con
 	if (listenerIt != listeners.cend())
 	{
 		listeners.erase(listenerIt);
+		AddListenerCount(id, -1);
 		listener->OnDetach(element);
 	}
 }
@@ -92,12 +113,14 @@ void EventDispatcher::DetachEvent(const EventId id, EventListener* listener, con
 void EventDispatcher::DetachAllEvents()
 {
 	for (const auto& event : listeners)
+	{
+		AddListenerCount(event.id, -1);
 		event.listener->OnDetach(element);
+	}
 
 	listeners.clear();
 
-	for (int i = 0; i < element->GetNumChildren(true); ++i)
-		element->GetChild(i)->GetEventDispatcher()->DetachAllEvents();
+	DetachDescendantEvents(element);
 }
 
 /*
@@ -126,14 +149,53 @@ struct CollectedListener {
 	bool operator<(const CollectedListener& other) const { return sort < other.sort; }
 };
 
+/*
+    DispatchBuffers
+
+    Scratch buffers for collecting listeners and elements during dispatch, reused between events to avoid allocations. Events may be
+    dispatched recursively from within listeners, thus we keep one set of buffers for each level of recursion.
+*/
+struct DispatchBuffers {
+	Vector<CollectedListener> listeners;
+	Vector<ObserverPtr<Element>> default_action_elements;
+};
+
+static Vector<UniquePtr<DispatchBuffers>> dispatch_buffers;
+static int dispatch_depth = 0;
+
+class DispatchBuffersScope : NonCopyMoveable {
+public:
+	DispatchBuffersScope()
+	{
+		if (dispatch_depth >= (int)dispatch_buffers.size())
+			dispatch_buffers.push_back(MakeUnique<DispatchBuffers>());
+		buffers = dispatch_buffers[dispatch_depth].get();
+		dispatch_depth += 1;
+	}
+	~DispatchBuffersScope()
+	{
+		// Clear the buffers so that we don't hold on to any observers, while keeping the allocated capacity.
+		buffers->listeners.clear();
+		buffers->default_action_elements.clear();
+		dispatch_depth -= 1;
+	}
+
+	DispatchBuffers* buffers;
+};
+
 bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, const String& type, const Dictionary& parameters,
 	const bool interruptible, const bool bubbles, const DefaultActionPhase default_action_phase)
 {
 	RMLUI_ASSERTMSG(!((int)default_action_phase & (int)EventPhase::Capture),
 		"We assume here that the default action phases cannot include capture phase.");
 
-	Vector<CollectedListener> listeners;
-	Vector<ObserverPtr<Element>> default_action_elements;
+	// Skip walking the tree entirely when there is nothing to execute.
+	if (default_action_phase == DefaultActionPhase::None && !HasListeners(id))
+		return true;
+
+	DispatchBuffersScope scope;
+	Vector<CollectedListener>& listeners = scope.buffers->listeners;
+	Vector<ObserverPtr<Element>>& default_action_elements = scope.buffers->default_action_elements;
 
 	const EventPhase phases_to_execute = EventPhase((int)EventPhase::Capture | (int)EventPhase::Target | (bubbles ? (int)EventPhase::Bubble : 0));
 
@@ -142,8 +204,8 @@ bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, c
 	Element* walk_element = target_element;
 	while (walk_element)
 	{
-		EventDispatcher* dispatcher = walk_element->GetEventDispatcher();
-		dispatcher->CollectListeners(dom_distance_from_target, id, phases_to_execute, listeners);
+		if (EventDispatcher* dispatcher = walk_element->FindEventDispatcher())
+			dispatcher->CollectListeners(dom_distance_from_target, id, phases_to_execute, listeners);
 
 		if (dom_distance_from_target == 0)
 		{
@@ -248,6 +310,19 @@ void EventDispatcher::CollectListeners(int dom_distance_from_target, const Event
 	}
 }
 
+bool EventDispatcher::HasListeners(const EventId id)
+{
+	return (size_t)id < listener_counts.size() && listener_counts[(size_t)id] > 0;
+}
+
+void EventDispatcher::AddListenerCount(const EventId id, const int count)
+{
+	if ((size_t)id >= listener_counts.size())
+		listener_counts.resize((size_t)id + 1, 0);
+	listener_counts[(size_t)id] += count;
+	RMLUI_ASSERT(listener_counts[(size_t)id] >= 0);
+}
+
 String EventDispatcher::ToString() const
 {
 	String result;
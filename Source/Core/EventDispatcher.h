@@ -91,6 +91,9 @@ public:
 	static bool DispatchEvent(Element* target_element, EventId id, const String& type, const Dictionary& parameters, bool interruptible, bool bubbles,
 		DefaultActionPhase default_action_phase);
 
+	/// Returns true if any element has a listener attached to the given event id.
+	static bool HasListeners(EventId id);
+
 	/// Returns event types with number of listeners for debugging.
 	/// @return Summary of attached listeners.
 	String ToString() const;
@@ -105,6 +108,9 @@ private:
 
 	// Collect all the listeners from this dispatcher that are allowed to execute given the input arguments.
 	void CollectListeners(int dom_distance_from_target, EventId event_id, EventPhase phases_to_execute, Vector<CollectedListener>& collect_listeners);
+
+	// Keep track of the total number of listeners attached to each event id.
+	static void AddListenerCount(EventId id, int count);
 };
 
 } // namespace Rml
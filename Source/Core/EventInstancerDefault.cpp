@@ -33,16 +33,37 @@ namespace Rml {
 
 EventInstancerDefault::EventInstancerDefault() {}
 
-EventInstancerDefault::~EventInstancerDefault() {}
+EventInstancerDefault::~EventInstancerDefault()
+{
+	for (Event* event : event_pool)
+		delete event;
+}
 
 EventPtr EventInstancerDefault::InstanceEvent(Element* target, EventId id, const String& type, const Dictionary& parameters, bool interruptible)
 {
+	if (!event_pool.empty())
+	{
+		Event* event = event_pool.back();
+		event_pool.pop_back();
+		event->Initialize(target, id, type, parameters, interruptible);
+		return EventPtr(event);
+	}
+
 	return EventPtr(new Event(target, id, type, parameters, interruptible));
 }
 
 void EventInstancerDefault::ReleaseEvent(Event* event)
 {
-	delete event;
+	if (event_pool.size() < max_pooled_events)
+	{
+		if (event_pool.capacity() == 0)
+			event_pool.reserve(max_pooled_events);
+		event_pool.push_back(event);
+	}
+	else
+	{
+		delete event;
+	}
 }
 
 void EventInstancerDefault::Release()
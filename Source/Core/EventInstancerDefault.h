@@ -58,6 +58,12 @@ public:
 
 	/// Releases this event instancer.
 	void Release() override;
+
+private:
+	// Released events are kept here for reuse, which avoids allocating a new event for every dispatch. Events may be
+	// dispatched recursively, thus we may need a few of them at once.
+	static constexpr size_t max_pooled_events = 8;
+	Vector<Event*> event_pool;
 };
 
 } // namespace Rml
@@ -54,6 +54,7 @@
 #include "DecoratorTiledHorizontalInstancer.h"
 #include "DecoratorTiledImageInstancer.h"
 #include "DecoratorTiledVerticalInstancer.h"
+#include "ElementArena.h"
 #include "ElementHandle.h"
 #include "Elements/ElementImage.h"
 #include "Elements/ElementLabel.h"
@@ -462,6 +463,12 @@ ElementPtr Factory::InstanceDocumentStream(Context* context, Stream* stream, con
 
 	document->context = context;
 
+	if (context && context->AreDocumentArenasEnabled())
+		document->arena = ElementArena::Create();
+
+	// Allocate the document's elements from its arena while parsing, any elements created later are allocated individually.
+	ElementArena::Scope arena_scope(document->arena);
+
 	XMLParser parser(element.get());
 	parser.Parse(stream);
 
@@ -66,4 +66,16 @@ bool FileInterface::LoadFile(const String& path, String& out_data)
 	return true;
 }
 
+bool FileInterface::SaveFile(const String& /*path*/, const String& /*data*/)
+{
+	return false;
+}
+
+bool FileInterface::MapFile(const String& /*path*/, const byte*& /*out_data*/, size_t& /*out_size*/)
+{
+	return false;
+}
+
+void FileInterface::UnmapFile(const byte* /*data*/, size_t /*size*/) {}
+
 } // namespace Rml
@@ -30,6 +30,15 @@
 
 #ifndef RMLUI_NO_FILE_INTERFACE_DEFAULT
 
+	#ifdef RMLUI_PLATFORM_WIN32
+		#include <windows.h>
+	#else
+		#include <fcntl.h>
+		#include <sys/mman.h>
+		#include <sys/stat.h>
+		#include <unistd.h>
+	#endif
+
 namespace Rml {
 
 FileInterfaceDefault::~FileInterfaceDefault() {}
@@ -59,5 +68,82 @@ size_t FileInterfaceDefault::Tell(FileHandle file)
 	return ftell((FILE*)file);
 }
 
+bool FileInterfaceDefault::SaveFile(const String& path, const String& data)
+{
+	FILE* fp = fopen(path.c_str(), "wb");
+	if (!fp)
+		return false;
+
+	const size_t written_size = fwrite(data.data(), 1, data.size(), fp);
+	const bool close_success = (fclose(fp) == 0);
+
+	return written_size == data.size() && close_success;
+}
+
+	#ifdef RMLUI_PLATFORM_WIN32
+bool FileInterfaceDefault::MapFile(const String& path, const byte*& out_data, size_t& out_size)
+{
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER file_size = {};
+	if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart <= 0)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	// The view keeps the mapping and the file open, thus the handles can be closed immediately.
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	if (!mapping)
+		return false;
+
+	const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (!view)
+		return false;
+
+	out_data = (const byte*)view;
+	out_size = (size_t)file_size.QuadPart;
+	return true;
+}
+
+void FileInterfaceDefault::UnmapFile(const byte* data, size_t /*size*/)
+{
+	UnmapViewOfFile(data);
+}
+	#else
+bool FileInterfaceDefault::MapFile(const String& path, const byte*& out_data, size_t& out_size)
+{
+	const int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+		return false;
+
+	struct stat file_stat = {};
+	if (fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0)
+	{
+		close(fd);
+		return false;
+	}
+
+	// The mapping keeps the file open, thus the descriptor can be closed immediately.
+	void* address = mmap(nullptr, (size_t)file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (address == MAP_FAILED)
+		return false;
+
+	out_data = (const byte*)address;
+	out_size = (size_t)file_stat.st_size;
+	return true;
+}
+
+void FileInterfaceDefault::UnmapFile(const byte* data, size_t size)
+{
+	munmap((void*)data, size);
+}
+	#endif
+
 } // namespace Rml
 #endif /*RMLUI_NO_FILE_INTERFACE_DEFAULT*/
@@ -70,6 +70,23 @@ public:
 	/// @param file The handle of the file to be queried.
 	/// @return The number of bytes from the origin of the file.
 	size_t Tell(FileHandle file) override;
+
+	/// Saves data to a file, replacing its contents if it already exists.
+	/// @param path The path of the file to save.
+	/// @param data The data to write to the file.
+	/// @return True on success.
+	bool SaveFile(const String& path, const String& data) override;
+
+	/// Maps a file into memory for reading, using the memory-mapping functions of the operating system.
+	/// @param path The path of the file to map.
+	/// @param out_data The start of the mapped file contents.
+	/// @param out_size The size of the mapped file contents in bytes.
+	/// @return True on success.
+	bool MapFile(const String& path, const byte*& out_data, size_t& out_size) override;
+	/// Releases a file mapping previously created through MapFile().
+	/// @param data The start of the mapped file contents.
+	/// @param size The size of the mapped file contents in bytes.
+	void UnmapFile(const byte* data, size_t size) override;
 };
 
 } // namespace Rml
@@ -0,0 +1,105 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "FontCache.h"
+#include "../../../Include/RmlUi/Core/Core.h"
+#include "../../../Include/RmlUi/Core/FileInterface.h"
+#include <string.h>
+
+namespace Rml {
+
+// Identifies cache files, increment the version whenever the format of any cache file changes.
+static const char cache_file_magic[4] = {'R', 'M', 'F', 'C'};
+static constexpr uint32_t cache_file_version = 1;
+
+static String GetCachePath(const String& file_name)
+{
+	const String& directory = GetFontCacheDirectory();
+	const char last = directory.back();
+	if (last == '/' || last == '\\')
+		return directory + file_name;
+	return directory + '/' + file_name;
+}
+
+bool FontCache::IsEnabled()
+{
+	return !GetFontCacheDirectory().empty();
+}
+
+bool FontCache::Load(const String& file_name, String& out_data)
+{
+	if (!IsEnabled())
+		return false;
+
+	String file_data;
+	if (!GetFileInterface()->LoadFile(GetCachePath(file_name), file_data))
+		return false;
+
+	constexpr size_t header_size = sizeof(cache_file_magic) + sizeof(cache_file_version);
+	if (file_data.size() < header_size || memcmp(file_data.data(), cache_file_magic, sizeof(cache_file_magic)) != 0)
+		return false;
+
+	uint32_t version = 0;
+	memcpy(&version, file_data.data() + sizeof(cache_file_magic), sizeof(version));
+	if (version != cache_file_version)
+		return false;
+
+	out_data = file_data.substr(header_size);
+	return true;
+}
+
+bool FontCache::Save(const String& file_name, const String& data)
+{
+	if (!IsEnabled())
+		return false;
+
+	String file_data;
+	file_data.reserve(sizeof(cache_file_magic) + sizeof(cache_file_version) + data.size());
+	file_data.append(cache_file_magic, sizeof(cache_file_magic));
+	file_data.append((const char*)&cache_file_version, sizeof(cache_file_version));
+	file_data += data;
+
+	return GetFileInterface()->SaveFile(GetCachePath(file_name), file_data);
+}
+
+void FontCache::Writer::WriteBytes(const void* bytes, size_t size)
+{
+	data.append((const char*)bytes, size);
+}
+
+bool FontCache::Reader::ReadBytes(void* bytes, size_t size)
+{
+	if (size > data.size() - position)
+		return false;
+
+	memcpy(bytes, data.data() + position, size);
+	position += size;
+	return true;
+}
+
+} // namespace Rml
@@ -0,0 +1,86 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTCACHE_H
+#define RMLUI_CORE_FONTENGINEDEFAULT_FONTCACHE_H
+
+#include "../../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+    Reads and writes the files of the persistent font cache, located in the directory set by Rml::SetFontCacheDirectory().
+ */
+
+namespace FontCache {
+
+	// Returns true if the persistent font cache is enabled.
+	bool IsEnabled();
+
+	// Loads the data of the given cache file, returns false if it does not exist or was written in an incompatible format.
+	bool Load(const String& file_name, String& out_data);
+
+	// Saves the data to the given cache file, returns false if the file could not be written.
+	bool Save(const String& file_name, const String& data);
+
+	// Appends binary values to the data of a cache file.
+	class Writer {
+	public:
+		explicit Writer(String& data) : data(data) {}
+
+		template <typename T>
+		void Write(const T& value)
+		{
+			WriteBytes(&value, sizeof(T));
+		}
+		void WriteBytes(const void* bytes, size_t size);
+
+	private:
+		String& data;
+	};
+
+	// Reads binary values from the data of a cache file, every read fails once the end of the data is reached.
+	class Reader {
+	public:
+		explicit Reader(const String& data) : data(data) {}
+
+		template <typename T>
+		bool Read(T& value)
+		{
+			return ReadBytes(&value, sizeof(T));
+		}
+		bool ReadBytes(void* bytes, size_t size);
+
+	private:
+		const String& data;
+		size_t position = 0;
+	};
+
+} // namespace FontCache
+} // namespace Rml
+#endif
@@ -0,0 +1,233 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "FontDistanceField.h"
+#include "../../../Include/RmlUi/Core/Math.h"
+#include <algorithm>
+
+namespace Rml {
+
+static constexpr float Infinity = 1e20f;
+
+static byte EncodeDistance(float distance)
+{
+	return byte(Math::Clamp(128.f + distance * (127.f / float(FontDistanceField::Spread)) + 0.5f, 0.f, 255.f));
+}
+
+static float DecodeDistance(float value)
+{
+	return (value - 128.f) * (float(FontDistanceField::Spread) / 127.f);
+}
+
+// Squared distance transform of a one-dimensional sampled function, by finding the lower envelope of the parabolas rooted at each sample, see
+// Felzenszwalb and Huttenlocher, "Distance Transforms of Sampled Functions". The 'vertices' and 'boundaries' scratch buffers must hold n and
+// n + 1 elements, respectively.
+static void TransformSquared1D(const float* f, float* out_distances, int n, int* vertices, float* boundaries)
+{
+	auto Intersection = [f](int q, int p) { return ((f[q] + float(q * q)) - (f[p] + float(p * p))) / float(2 * q - 2 * p); };
+
+	int k = 0;
+	vertices[0] = 0;
+	boundaries[0] = -Infinity;
+	boundaries[1] = Infinity;
+
+	for (int q = 1; q < n; q++)
+	{
+		float s = Intersection(q, vertices[k]);
+		while (s <= boundaries[k])
+		{
+			k--;
+			s = Intersection(q, vertices[k]);
+		}
+
+		k++;
+		vertices[k] = q;
+		boundaries[k] = s;
+		boundaries[k + 1] = Infinity;
+	}
+
+	k = 0;
+	for (int q = 0; q < n; q++)
+	{
+		while (boundaries[k + 1] < float(q))
+			k++;
+
+		const float offset = float(q - vertices[k]);
+		out_distances[q] = offset * offset + f[vertices[k]];
+	}
+}
+
+// Replaces each value of the grid, being zero at the seed pixels and infinity elsewhere, by the squared distance to the nearest seed pixel.
+static void TransformSquared(Vector<float>& grid, Vector2i dimensions)
+{
+	const int max_dimension = Math::Max(dimensions.x, dimensions.y);
+	Vector<float> f(max_dimension), distances(max_dimension), boundaries(max_dimension + 1);
+	Vector<int> vertices(max_dimension);
+
+	for (int x = 0; x < dimensions.x; x++)
+	{
+		for (int y = 0; y < dimensions.y; y++)
+			f[y] = grid[y * dimensions.x + x];
+
+		TransformSquared1D(f.data(), distances.data(), dimensions.y, vertices.data(), boundaries.data());
+
+		for (int y = 0; y < dimensions.y; y++)
+			grid[y * dimensions.x + x] = distances[y];
+	}
+
+	for (int y = 0; y < dimensions.y; y++)
+	{
+		float* row = grid.data() + y * dimensions.x;
+		TransformSquared1D(row, distances.data(), dimensions.x, vertices.data(), boundaries.data());
+		std::copy(distances.begin(), distances.begin() + dimensions.x, row);
+	}
+}
+
+// Bilinear sampling of an A8 bitmap at the given pixel coordinates, with clamp-to-edge addressing.
+static float SampleBitmap(const byte* data, Vector2i dimensions, Vector2f position)
+{
+	const float x_floor = Math::RoundDown(position.x);
+	const float y_floor = Math::RoundDown(position.y);
+	const float tx = position.x - x_floor;
+	const float ty = position.y - y_floor;
+
+	const int x0 = Math::Clamp(int(x_floor), 0, dimensions.x - 1);
+	const int x1 = Math::Clamp(int(x_floor) + 1, 0, dimensions.x - 1);
+	const int y0 = Math::Clamp(int(y_floor), 0, dimensions.y - 1);
+	const int y1 = Math::Clamp(int(y_floor) + 1, 0, dimensions.y - 1);
+
+	const float top = float(data[y0 * dimensions.x + x0]) * (1.f - tx) + float(data[y0 * dimensions.x + x1]) * tx;
+	const float bottom = float(data[y1 * dimensions.x + x0]) * (1.f - tx) + float(data[y1 * dimensions.x + x1]) * tx;
+	return top * (1.f - ty) + bottom * ty;
+}
+
+void FontDistanceField::Generate(FontGlyph& glyph)
+{
+	RMLUI_ASSERT(glyph.color_format == ColorFormat::A8);
+
+	const Vector2i bitmap_dimensions = glyph.bitmap_dimensions;
+	if (!glyph.bitmap_data || bitmap_dimensions.x <= 0 || bitmap_dimensions.y <= 0)
+		return;
+
+	const Vector2i dimensions = bitmap_dimensions + Vector2i(2 * Spread);
+	const int num_pixels = dimensions.x * dimensions.y;
+
+	// Pixels at least half covered are considered inside the glyph. Find the squared distance from every pixel to the nearest pixel inside the
+	// glyph, and to the nearest pixel outside of it.
+	Vector<byte> coverage(num_pixels, 0);
+	Vector<float> distances_to_inside(num_pixels, Infinity);
+	Vector<float> distances_to_outside(num_pixels, 0.f);
+
+	for (int y = 0; y < bitmap_dimensions.y; y++)
+	{
+		for (int x = 0; x < bitmap_dimensions.x; x++)
+		{
+			const int index = (y + Spread) * dimensions.x + (x + Spread);
+			coverage[index] = glyph.bitmap_data[y * bitmap_dimensions.x + x];
+			if (coverage[index] >= 128)
+			{
+				distances_to_inside[index] = 0.f;
+				distances_to_outside[index] = Infinity;
+			}
+		}
+	}
+
+	TransformSquared(distances_to_inside, dimensions);
+	TransformSquared(distances_to_outside, dimensions);
+
+	UniquePtr<byte[]> data(new byte[num_pixels]);
+	for (int i = 0; i < num_pixels; i++)
+	{
+		// The edge passes through partially covered pixels, approximate their distance by their coverage. Other pixels are half a pixel closer to
+		// the edge than to the center of the nearest pixel on its other side.
+		float distance = 0.f;
+		if (coverage[i] > 0 && coverage[i] < 255)
+			distance = float(coverage[i]) * (1.f / 255.f) - 0.5f;
+		else if (coverage[i] == 255)
+			distance = Math::SquareRoot(distances_to_outside[i]) - 0.5f;
+		else
+			distance = 0.5f - Math::SquareRoot(distances_to_inside[i]);
+
+		data[i] = EncodeDistance(distance);
+	}
+
+	glyph.bitmap_owned_data = std::move(data);
+	glyph.bitmap_data = glyph.bitmap_owned_data.get();
+	glyph.bitmap_dimensions = dimensions;
+	glyph.bearing += Vector2i(-Spread, Spread);
+}
+
+void FontDistanceField::GenerateCoverage(const FontGlyph& source, float scale, FontGlyph& glyph)
+{
+	glyph.bitmap_owned_data.reset();
+	glyph.bitmap_data = nullptr;
+	glyph.bitmap_dimensions = Vector2i(0, 0);
+	glyph.color_format = ColorFormat::A8;
+
+	if (!source.bitmap_data || source.bitmap_dimensions.x <= 0 || source.bitmap_dimensions.y <= 0 || scale <= 0.f)
+		return;
+
+	// Find the pixels covered by the scaled source bitmap, relative to the pen position.
+	const Vector2f source_origin(float(source.bearing.x), float(-source.bearing.y));
+	const Vector2f top_left = source_origin * scale;
+	const Vector2f bottom_right = (source_origin + Vector2f(source.bitmap_dimensions)) * scale;
+	const Vector2i begin(Math::RoundDownToInteger(top_left.x), Math::RoundDownToInteger(top_left.y));
+	const Vector2i end(Math::RoundUpToInteger(bottom_right.x), Math::RoundUpToInteger(bottom_right.y));
+	const Vector2i dimensions = end - begin;
+
+	UniquePtr<byte[]> data(new byte[dimensions.x * dimensions.y]);
+	for (int y = 0; y < dimensions.y; y++)
+	{
+		for (int x = 0; x < dimensions.x; x++)
+		{
+			// Sample the distance field at the center of the pixel, and cover the pixel by how far inside the glyph its center lies.
+			const Vector2f pixel_center = Vector2f(begin + Vector2i(x, y)) + Vector2f(0.5f);
+			const Vector2f position = pixel_center / scale - source_origin - Vector2f(0.5f);
+			const float distance = DecodeDistance(SampleBitmap(source.bitmap_data, source.bitmap_dimensions, position)) * scale;
+			data[y * dimensions.x + x] = byte(Math::Clamp(distance + 0.5f, 0.f, 1.f) * 255.f + 0.5f);
+		}
+	}
+
+	glyph.bitmap_owned_data = std::move(data);
+	glyph.bitmap_data = glyph.bitmap_owned_data.get();
+	glyph.bitmap_dimensions = dimensions;
+	glyph.bearing = Vector2i(begin.x, -begin.y);
+}
+
+void FontDistanceField::ConvertToCoverage(byte* data, Vector2i dimensions)
+{
+	const int num_pixels = dimensions.x * dimensions.y;
+	for (int i = 0; i < num_pixels; i++)
+	{
+		byte& alpha = data[4 * i + 3];
+		const float distance = DecodeDistance(float(alpha));
+		alpha = byte(Math::Clamp(distance + 0.5f, 0.f, 1.f) * 255.f + 0.5f);
+	}
+}
+
+} // namespace Rml
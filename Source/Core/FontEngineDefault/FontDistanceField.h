@@ -0,0 +1,61 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTDISTANCEFIELD_H
+#define RMLUI_CORE_FONTENGINEDEFAULT_FONTDISTANCEFIELD_H
+
+#include "../../../Include/RmlUi/Core/FontGlyph.h"
+
+namespace Rml {
+
+/**
+    Generates the signed distance fields used to render the glyphs of a font face at any size, see Rml::SetFontDistanceFieldRendering().
+ */
+
+namespace FontDistanceField {
+
+	// The font size at which glyph outlines are rasterized before being converted to distance fields.
+	constexpr int ReferenceSize = 48;
+	// The largest distance from the glyph edge encoded in the distance field, in pixels at the reference size.
+	constexpr int Spread = 6;
+
+	// Converts the coverage bitmap of an A8 glyph into a distance field, padding the bitmap by the spread on all sides. Distances are encoded in
+	// the range [0, 255], with the glyph edge at 128 and larger values inside the glyph.
+	void Generate(FontGlyph& glyph);
+
+	// Reconstructs the coverage bitmap of a distance-field glyph scaled to a new size, such as for font effects. Sets the bitmap and bearing of the
+	// destination glyph, leaving its other metrics unchanged.
+	void GenerateCoverage(const FontGlyph& source, float scale, FontGlyph& glyph);
+
+	// Converts the alpha channel of an RGBA8 distance-field texture into coverage at the reference size, used when distance-field textures are not
+	// supported by the render interface.
+	void ConvertToCoverage(byte* data, Vector2i dimensions);
+
+} // namespace FontDistanceField
+} // namespace Rml
+#endif
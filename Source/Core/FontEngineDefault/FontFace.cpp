@@ -27,8 +27,12 @@
  */
 
 #include "FontFace.h"
+#include "../../../Include/RmlUi/Core/Core.h"
 #include "../../../Include/RmlUi/Core/Log.h"
+#include "FontCache.h"
+#include "FontDistanceField.h"
 #include "FontFaceHandleDefault.h"
+#include "FontGlyphAtlas.h"
 #include "FreeTypeInterface.h"
 
 namespace Rml {
@@ -42,6 +46,12 @@ FontFace::FontFace(FontFaceHandleFreetype _face, Style::FontStyle _style, Style:
 
 FontFace::~FontFace()
 {
+	// The handles must be released before the face they were created from, and before the distance-field source and glyph atlas they may
+	// render from.
+	handles.clear();
+	distance_field_source.reset();
+	glyph_atlas.reset();
+
 	if (face)
 		FreeType::ReleaseFace(face);
 }
@@ -69,9 +79,35 @@ FontFaceHandleDefault* FontFace::GetHandle(int size, bool load_default_glyphs)
 		return nullptr;
 	}
 
-	// Construct and initialise the new handle.
+	// Hashing the face data takes some time, only do it when the persistent cache is actually used.
+	const bool use_cache = FontCache::IsEnabled();
+	if (use_cache && cache_key.empty())
+		cache_key = FreeType::GetFaceCacheKey(face);
+
+	// All sizes of the face pack their glyphs into the same atlas.
+	if (!glyph_atlas)
+	{
+		String family;
+		FreeType::GetFaceStyle(face, &family, nullptr, nullptr);
+		glyph_atlas = MakeUnique<FontGlyphAtlas>(family);
+	}
+
+	// Construct and initialise the new handle. When rendering from distance fields, only the shared source handle uses the cache, since the
+	// handles of each size do not rasterize outlines themselves.
 	auto handle = MakeUnique<FontFaceHandleDefault>();
-	if (!handle->Initialize(face, size, load_default_glyphs))
+	FontFaceHandleDefault* source = (GetFontDistanceFieldRendering() ? GetDistanceFieldSource() : nullptr);
+	bool initialized = false;
+	if (source)
+	{
+		const auto glyph_mode = FontFaceHandleDefault::GlyphMode::DistanceField;
+		initialized = handle->Initialize(face, glyph_atlas.get(), String(), size, load_default_glyphs, glyph_mode, source);
+	}
+	else
+	{
+		initialized = handle->Initialize(face, glyph_atlas.get(), use_cache ? cache_key : String(), size, load_default_glyphs);
+	}
+
+	if (!initialized)
 	{
 		handles[size] = nullptr;
 		return nullptr;
@@ -88,6 +124,27 @@ FontFaceHandleDefault* FontFace::GetHandle(int size, bool load_default_glyphs)
 void FontFace::ReleaseFontResources()
 {
 	HandleMap().swap(handles);
+	distance_field_source.reset();
+	glyph_atlas.reset();
+}
+
+FontFaceHandleDefault* FontFace::GetDistanceFieldSource()
+{
+	if (distance_field_source)
+		return distance_field_source.get();
+
+	const String source_cache_key = (FontCache::IsEnabled() && !cache_key.empty() ? cache_key + "-sdf" : String());
+
+	auto source = MakeUnique<FontFaceHandleDefault>();
+	if (!source->Initialize(face, nullptr, source_cache_key, FontDistanceField::ReferenceSize, true,
+			FontFaceHandleDefault::GlyphMode::DistanceFieldSource))
+	{
+		Log::Message(Log::LT_WARNING, "Could not create distance fields for the font face, falling back to rendering glyph bitmaps.");
+		return nullptr;
+	}
+
+	distance_field_source = std::move(source);
+	return distance_field_source.get();
 }
 
 } // namespace Rml
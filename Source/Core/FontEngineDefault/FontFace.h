@@ -35,6 +35,7 @@
 namespace Rml {
 
 class FontFaceHandleDefault;
+class FontGlyphAtlas;
 
 /**
     @author Peter Curry
@@ -58,6 +59,9 @@ public:
 	void ReleaseFontResources();
 
 private:
+	// Returns the handle providing the distance fields shared by all sizes of this face, creating it if needed.
+	FontFaceHandleDefault* GetDistanceFieldSource();
+
 	Style::FontStyle style;
 	Style::FontWeight weight;
 
@@ -65,7 +69,16 @@ private:
 	using HandleMap = UnorderedMap<int, UniquePtr<FontFaceHandleDefault>>;
 	HandleMap handles;
 
+	// Renders the glyph outlines used by the other handles when rendering text from distance fields, created when first needed.
+	UniquePtr<FontFaceHandleDefault> distance_field_source;
+
+	// Packs the glyph bitmaps of all the handles into shared textures, created when first needed.
+	UniquePtr<FontGlyphAtlas> glyph_atlas;
+
 	FontFaceHandleFreetype face;
+
+	// Identifies the face in the persistent font cache, generated when first needed.
+	String cache_key;
 };
 
 } // namespace Rml
@@ -27,42 +27,90 @@
  */
 
 #include "FontFaceHandleDefault.h"
+#include "../../../Include/RmlUi/Core/Log.h"
 #include "../../../Include/RmlUi/Core/StringUtilities.h"
 #include "../TextureLayout.h"
+#include "FontCache.h"
+#include "FontDistanceField.h"
 #include "FontFaceLayer.h"
+#include "FontGlyphAtlas.h"
 #include "FontProvider.h"
 #include "FreeTypeInterface.h"
 #include <algorithm>
+#include <limits>
 
 namespace Rml {
 
 static constexpr char32_t KerningCache_AsciiSubsetBegin = 32;
 static constexpr char32_t KerningCache_AsciiSubsetLast = 126;
+static constexpr int KerningCache_AsciiSubsetSize = int(KerningCache_AsciiSubsetLast - KerningCache_AsciiSubsetBegin + 1);
+static constexpr int16_t KerningCache_Unknown = std::numeric_limits<int16_t>::min();
 
 FontFaceHandleDefault::FontFaceHandleDefault()
 {
 	base_layer = nullptr;
 	metrics = {};
 	ft_face = 0;
+	ft_size = 0;
 }
 
 FontFaceHandleDefault::~FontFaceHandleDefault()
 {
 	glyphs.clear();
 	layers.clear();
+	FreeType::ReleaseSize(ft_size);
 }
 
-bool FontFaceHandleDefault::Initialize(FontFaceHandleFreetype face, int font_size, bool load_default_glyphs)
+bool FontFaceHandleDefault::Initialize(FontFaceHandleFreetype face, FontGlyphAtlas* _glyph_atlas, const String& face_cache_key, int font_size,
+	bool load_default_glyphs, GlyphMode _glyph_mode, FontFaceHandleDefault* _distance_field_source)
 {
 	ft_face = face;
+	glyph_mode = _glyph_mode;
+	distance_field_source = (glyph_mode == GlyphMode::DistanceField ? _distance_field_source : nullptr);
+	RMLUI_ASSERT(glyph_mode != GlyphMode::DistanceField || distance_field_source);
+
+	if (!face_cache_key.empty())
+		cache_key = CreateString(face_cache_key.size() + 16, "%s-%dpx", face_cache_key.c_str(), font_size);
 
 	RMLUI_ASSERTMSG(layer_configurations.empty(), "Initialize must only be called once.");
 
-	if (!FreeType::InitialiseFaceHandle(ft_face, font_size, glyphs, metrics, load_default_glyphs))
+	ft_size = FreeType::CreateSize(ft_face, font_size, metrics);
+	if (!ft_size)
 		return false;
 
-	has_kerning = FreeType::HasKerning(ft_face);
-	FillKerningPairCache();
+	if (load_default_glyphs)
+	{
+		glyphs.reserve(128);
+		glyph_data.reserve(128);
+
+		// Add the ASCII characters now, preferably from the persistent cache. Other characters are added later as needed.
+		if (!LoadCachedGlyphs())
+		{
+			for (char32_t character = 32; character <= 126; ++character)
+				AppendGlyph(Character(character));
+
+			SaveCachedGlyphs();
+		}
+	}
+
+	// The distance-field source only provides glyphs to other handles, which do their own layout and handle unknown characters.
+	if (glyph_mode != GlyphMode::DistanceFieldSource)
+	{
+		// Add a replacement glyph for rendering unknown characters.
+		FontGlyph replacement_glyph;
+		FreeType::BuildReplacementGlyph(font_size, replacement_glyph);
+		replacement_glyph_index = InsertGlyph(Character::Replacement, std::move(replacement_glyph), 0);
+
+		has_kerning = FreeType::HasKerning(ft_face);
+	}
+
+	// Pack our glyphs into the atlas shared by all sizes of the face, the atlas is generated when the layers are first updated.
+	if (_glyph_atlas)
+	{
+		glyph_atlas = _glyph_atlas;
+		glyph_atlas_member = glyph_atlas->AddHandle(this);
+		glyph_atlas_layer = glyph_atlas->GetLayer(glyph_atlas_member);
+	}
 
 	// Generate the default layer and layer configuration.
 	base_layer = GetOrCreateLayer(nullptr);
@@ -71,37 +119,48 @@ bool FontFaceHandleDefault::Initialize(FontFaceHandleFreetype face, int font_siz
 	return true;
 }
 
+FontFaceHandleDefault::GlyphMode FontFaceHandleDefault::GetGlyphMode() const
+{
+	return glyph_mode;
+}
+
 const FontMetrics& FontFaceHandleDefault::GetFontMetrics() const
 {
 	return metrics;
 }
 
-const FontGlyphMap& FontFaceHandleDefault::GetGlyphs() const
+const FontGlyphList& FontFaceHandleDefault::GetGlyphs() const
 {
 	return glyphs;
 }
 
-int FontFaceHandleDefault::GetStringWidth(const String& string, float letter_spacing, Character prior_character)
+uint32_t FontFaceHandleDefault::GetFreeTypeGlyphIndex(int glyph_index) const
 {
-	int width = 0;
-	for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
-	{
-		Character character = *it_string;
-
-		const FontGlyph* glyph = GetOrAppendGlyph(character);
-		if (!glyph)
-			continue;
+	RMLUI_ASSERT(glyph_index >= 0 && glyph_index < (int)glyph_data.size());
+	return glyph_data[glyph_index].ft_glyph_index;
+}
 
-		// Adjust the cursor for the kerning between this character and the previous one.
-		width += GetKerning(prior_character, character);
+int FontFaceHandleDefault::GetDistanceFieldGlyphIndex(int glyph_index) const
+{
+	RMLUI_ASSERT(glyph_index >= 0 && glyph_index < (int)glyph_data.size());
+	return glyph_data[glyph_index].distance_field_glyph_index;
+}
 
-		// Adjust the cursor for this character's advance.
-		width += glyph->advance;
-		width += (int)letter_spacing;
+const String& FontFaceHandleDefault::GetCacheKey() const
+{
+	return cache_key;
+}
 
-		prior_character = character;
-	}
+String FontFaceHandleDefault::GetDescription() const
+{
+	String family;
+	FreeType::GetFaceStyle(ft_face, &family, nullptr, nullptr);
+	return CreateString(family.size() + 32, "%s %dpx", family.c_str(), metrics.size);
+}
 
+int FontFaceHandleDefault::GetStringWidth(const String& string, float letter_spacing, Character prior_character)
+{
+	const int width = GenerateGlyphRun(string, letter_spacing, prior_character);
 	return Math::Max(width, 0);
 }
 
@@ -185,19 +244,23 @@ bool FontFaceHandleDefault::GenerateLayerTexture(UniquePtr<const byte[]>& textur
 		return false;
 	}
 
-	return it->layer->GenerateTexture(texture_data, texture_dimensions, texture_id, glyphs);
+	return it->layer->GenerateTexture(texture_data, texture_dimensions, texture_id, this);
 }
 
 int FontFaceHandleDefault::GenerateString(GeometryList& geometry, const String& string, const Vector2f position, const Colourb colour,
 	const float opacity, const float letter_spacing, const int layer_configuration_index)
 {
 	int geometry_index = 0;
-	int line_width = 0;
 
 	RMLUI_ASSERT(layer_configuration_index >= 0);
 	RMLUI_ASSERT(layer_configuration_index < (int)layer_configurations.size());
 
+	// Convert the string to glyphs once for all the layers. This may load new glyphs, thus do it before the layers are updated.
+	const int line_width = GenerateGlyphRun(string, letter_spacing, Character::Null);
+
 	UpdateLayersOnDirty();
+	if (distance_field_source)
+		distance_field_source->UpdateLayersOnDirty();
 
 	// Fetch the requested configuration and generate the geometry for each one.
 	const LayerConfiguration& layer_configuration = layer_configurations[layer_configuration_index];
@@ -221,7 +284,13 @@ int FontFaceHandleDefault::GenerateString(GeometryList& geometry, const String&
 				layer_colour.alpha = byte(opacity * float(layer_colour.alpha));
 		}
 
-		const int num_textures = layer->GetNumTextures();
+		// Glyphs rendered from distance fields are not part of our base layer, they use the textures of the distance-field source instead.
+		if (layer == base_layer && distance_field_source)
+			GenerateDistanceFieldGeometry(geometry, geometry_index, position, layer_colour);
+
+		// The glyphs of the base layer are rendered from the glyph atlas when we have one.
+		FontFaceLayer* texture_layer = (layer == base_layer && glyph_atlas_layer ? glyph_atlas_layer : layer);
+		const int num_textures = texture_layer->GetNumTextures();
 
 		if (num_textures == 0)
 			continue;
@@ -234,34 +303,18 @@ int FontFaceHandleDefault::GenerateString(GeometryList& geometry, const String&
 
 		// Bind the textures to the geometries.
 		for (int tex_index = 0; tex_index < num_textures; ++tex_index)
-			geometry[geometry_index + tex_index].SetTexture(layer->GetTexture(tex_index));
+			geometry[geometry_index + tex_index].SetTexture(texture_layer->GetTexture(tex_index));
 
-		line_width = 0;
-		Character prior_character = Character::Null;
+		geometry[geometry_index].GetIndices().reserve(glyph_run.size() * 6);
+		geometry[geometry_index].GetVertices().reserve(glyph_run.size() * 4);
 
-		geometry[geometry_index].GetIndices().reserve(string.size() * 6);
-		geometry[geometry_index].GetVertices().reserve(string.size() * 4);
-
-		for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
+		for (const GlyphRunItem& item : glyph_run)
 		{
-			Character character = *it_string;
-
-			const FontGlyph* glyph = GetOrAppendGlyph(character);
-			if (!glyph)
-				continue;
-
-			// Adjust the cursor for the kerning between this character and the previous one.
-			line_width += GetKerning(prior_character, character);
-
 			// Use white vertex colors on RGB glyphs.
 			const Colourb glyph_color =
-				(layer == base_layer && glyph->color_format == ColorFormat::RGBA8 ? Colourb(255, layer_colour.alpha) : layer_colour);
+				(layer == base_layer && glyphs[item.glyph_index].color_format == ColorFormat::RGBA8 ? Colourb(255, layer_colour.alpha) : layer_colour);
 
-			layer->GenerateGeometry(&geometry[geometry_index], character, Vector2f(position.x + line_width, position.y), glyph_color);
-
-			line_width += glyph->advance;
-			line_width += (int)letter_spacing;
-			prior_character = character;
+			texture_layer->GenerateGeometry(&geometry[geometry_index], item.glyph_index, position + Vector2f(item.offset), glyph_color);
 		}
 
 		geometry_index += num_textures;
@@ -277,6 +330,19 @@ bool FontFaceHandleDefault::UpdateLayersOnDirty()
 {
 	bool result = false;
 
+	// Our new glyphs need to be packed into the glyph atlas. Our atlas layer may also have changed while packing the glyphs of other sizes.
+	bool glyph_atlas_changed = false;
+	if (glyph_atlas)
+	{
+		if (is_layers_dirty)
+			glyph_atlas->SetDirty();
+		glyph_atlas->UpdateOnDirty();
+
+		const int atlas_layer_version = glyph_atlas->GetVersion(glyph_atlas_member);
+		glyph_atlas_changed = (glyph_atlas_version != atlas_layer_version);
+		glyph_atlas_version = atlas_layer_version;
+	}
+
 	// If we are dirty, regenerate all the layers and increment the version
 	if (is_layers_dirty && base_layer)
 	{
@@ -293,131 +359,452 @@ bool FontFaceHandleDefault::UpdateLayersOnDirty()
 
 		result = true;
 	}
+	else if (glyph_atlas_changed)
+	{
+		// Only the layers cloned from the glyph atlas need to be updated, the other layers keep their own textures.
+		for (auto& pair : layers)
+		{
+			if (pair.font_effect && !pair.font_effect->HasUniqueTexture() && !distance_field_source)
+				GenerateLayer(pair.layer.get());
+		}
+
+		result = true;
+	}
 
 	return result;
 }
 
+void FontFaceHandleDefault::GenerateDistanceFieldGeometry(GeometryList& geometry, int& geometry_index, const Vector2f position, const Colourb colour)
+{
+	FontFaceLayer* source_layer = distance_field_source->base_layer;
+	const int num_textures = source_layer->GetNumTextures();
+	if (num_textures == 0)
+		return;
+
+	if ((int)geometry.size() < geometry_index + num_textures)
+		geometry.resize(geometry_index + num_textures);
+
+	for (int tex_index = 0; tex_index < num_textures; ++tex_index)
+		geometry[geometry_index + tex_index].SetTexture(source_layer->GetTexture(tex_index));
+
+	const float scale = GetDistanceFieldScale();
+	for (const GlyphRunItem& item : glyph_run)
+	{
+		const int distance_field_glyph_index = glyph_data[item.glyph_index].distance_field_glyph_index;
+		if (distance_field_glyph_index >= 0)
+		{
+			const Vector2f glyph_position = position + Vector2f(item.offset);
+			source_layer->GenerateScaledGeometry(&geometry[geometry_index], distance_field_glyph_index, glyph_position, colour, scale);
+		}
+	}
+
+	geometry_index += num_textures;
+}
+
 int FontFaceHandleDefault::GetVersion() const
+{
+	return version + (glyph_atlas ? glyph_atlas->GetVersion(glyph_atlas_member) : 0) + (distance_field_source ? distance_field_source->version : 0);
+}
+
+int FontFaceHandleDefault::GetLayerVersion() const
 {
 	return version;
 }
 
-bool FontFaceHandleDefault::AppendGlyph(Character character)
+int FontFaceHandleDefault::AppendGlyph(Character character)
 {
-	bool result = FreeType::AppendGlyph(ft_face, metrics.size, character, glyphs);
-	return result;
+	const uint32_t ft_glyph_index = FreeType::GetGlyphIndex(ft_face, character);
+	if (ft_glyph_index == 0)
+		return -1;
+
+	auto it = ft_glyph_indices.find(ft_glyph_index);
+	if (it != ft_glyph_indices.end())
+	{
+		SetCharacterGlyphIndex(character, it->second);
+		return it->second;
+	}
+
+	return AppendGlyph(character, ft_glyph_index);
 }
 
-void FontFaceHandleDefault::FillKerningPairCache()
+int FontFaceHandleDefault::AppendGlyph(Character character, uint32_t ft_glyph_index)
 {
-	if (!has_kerning)
-		return;
+	// Outlines are rendered from the distance-field source when we have one, then we only need their metrics.
+	FontGlyph glyph;
+	if (!FreeType::BuildGlyph(ft_size, ft_glyph_index, character, glyph, glyph_mode != GlyphMode::DistanceField))
+		return -1;
+
+	int distance_field_glyph_index = -1;
+
+	if (glyph_mode == GlyphMode::DistanceFieldSource)
+	{
+		// Only coverage bitmaps can be converted, other glyphs such as color bitmaps are rasterized by the handles using them.
+		if (glyph.color_format != ColorFormat::A8)
+			return -1;
+
+		FontDistanceField::Generate(glyph);
+	}
+	else if (glyph_mode == GlyphMode::DistanceField && !glyph.bitmap_data)
+	{
+		distance_field_glyph_index = distance_field_source->GetOrAppendFreeTypeGlyph(ft_glyph_index);
+		if (distance_field_glyph_index < 0 && !FreeType::BuildGlyph(ft_size, ft_glyph_index, character, glyph))
+			return -1;
+	}
+
+	return InsertGlyph(character, std::move(glyph), ft_glyph_index, distance_field_glyph_index);
+}
+
+int FontFaceHandleDefault::InsertGlyph(Character character, FontGlyph&& glyph, uint32_t ft_glyph_index, int distance_field_glyph_index)
+{
+	const int glyph_index = (int)glyphs.size();
+	glyphs.push_back(std::move(glyph));
+	glyph_data.push_back(GlyphData{character, ft_glyph_index, distance_field_glyph_index});
+
+	if (character != Character::Null)
+		SetCharacterGlyphIndex(character, glyph_index);
+	if (ft_glyph_index != 0)
+		ft_glyph_indices.emplace(ft_glyph_index, glyph_index);
 
-	for (char32_t i = KerningCache_AsciiSubsetBegin; i <= KerningCache_AsciiSubsetLast; i++)
+	return glyph_index;
+}
+
+void FontFaceHandleDefault::SetCharacterGlyphIndex(Character character, int glyph_index)
+{
+	const char32_t code = char32_t(character);
+	if (code < char32_t(NumGlyphPages * GlyphPageSize))
 	{
-		for (char32_t j = KerningCache_AsciiSubsetBegin; j <= KerningCache_AsciiSubsetLast; j++)
+		UniquePtr<GlyphPage>& page = glyph_pages[code / GlyphPageSize];
+		if (!page)
 		{
-			const bool first_iteration = (i == KerningCache_AsciiSubsetBegin && j == KerningCache_AsciiSubsetBegin);
-
-			// Fetch the kerning from the font face. Submit zero font size on subsequent iterations for performance reasons.
-			const int kerning = FreeType::GetKerning(ft_face, first_iteration ? metrics.size : 0, Character(i), Character(j));
-			if (kerning != 0)
-			{
-				kerning_pair_cache.emplace(AsciiPair((i << 8) | j), KerningIntType(kerning));
-			}
+			page = MakeUnique<GlyphPage>();
+			page->fill(-1);
 		}
+		(*page)[code % GlyphPageSize] = glyph_index;
+	}
+	else
+	{
+		supplementary_glyph_indices[character] = glyph_index;
 	}
 }
 
-int FontFaceHandleDefault::GetKerning(Character lhs, Character rhs) const
+FontGlyph FontFaceHandleDefault::CopyGlyph(int glyph_index) const
 {
-	static_assert(' ' == 32, "Only ASCII/UTF8 character set supported.");
+	FontGlyph glyph = glyphs[glyph_index].WeakCopy();
 
-	// Check if we have no kerning, or if we are have a control character.
-	if (!has_kerning || char32_t(lhs) < ' ' || char32_t(rhs) < ' ')
-		return 0;
+	const int distance_field_glyph_index = glyph_data[glyph_index].distance_field_glyph_index;
+	if (distance_field_glyph_index >= 0)
+		FontDistanceField::GenerateCoverage(distance_field_source->glyphs[distance_field_glyph_index], GetDistanceFieldScale(), glyph);
 
-	// See if the kerning pair has been cached.
-	const bool lhs_in_cache = (char32_t(lhs) >= KerningCache_AsciiSubsetBegin && char32_t(lhs) <= KerningCache_AsciiSubsetLast);
-	const bool rhs_in_cache = (char32_t(rhs) >= KerningCache_AsciiSubsetBegin && char32_t(rhs) <= KerningCache_AsciiSubsetLast);
+	return glyph;
+}
 
-	if (lhs_in_cache && rhs_in_cache)
+void FontFaceHandleDefault::GenerateDistanceFieldCoverage()
+{
+	const float scale = GetDistanceFieldScale();
+
+	for (size_t i = 0; i < glyphs.size(); i++)
 	{
-		const auto it = kerning_pair_cache.find(AsciiPair((int(lhs) << 8) | int(rhs)));
+		const int distance_field_glyph_index = glyph_data[i].distance_field_glyph_index;
+		if (distance_field_glyph_index >= 0 && !glyphs[i].bitmap_data)
+			FontDistanceField::GenerateCoverage(distance_field_source->glyphs[distance_field_glyph_index], scale, glyphs[i]);
+	}
+}
+
+float FontFaceHandleDefault::GetDistanceFieldScale() const
+{
+	RMLUI_ASSERT(distance_field_source);
+	return float(metrics.size) / float(distance_field_source->metrics.size);
+}
 
-		if (it != kerning_pair_cache.end())
+int FontFaceHandleDefault::FindGlyphIndex(Character character) const
+{
+	const char32_t code = char32_t(character);
+	if (code < char32_t(NumGlyphPages * GlyphPageSize))
+	{
+		const GlyphPage* page = glyph_pages[code / GlyphPageSize].get();
+		return page ? (*page)[code % GlyphPageSize] : -1;
+	}
+
+	auto it = supplementary_glyph_indices.find(character);
+	return it != supplementary_glyph_indices.end() ? it->second : -1;
+}
+
+bool FontFaceHandleDefault::LoadCachedGlyphs()
+{
+	String data;
+	if (cache_key.empty() || !FontCache::Load(cache_key + ".glyphs", data))
+		return false;
+
+	FontCache::Reader reader(data);
+	uint32_t num_glyphs = 0;
+	if (!reader.Read(num_glyphs))
+		return false;
+
+	// Read all the glyphs before inserting any of them, so that we can fall back to building the glyphs if the file is damaged.
+	FontGlyphList loaded_glyphs(num_glyphs);
+	Vector<GlyphData> loaded_glyph_data(num_glyphs);
+
+	for (uint32_t i = 0; i < num_glyphs; i++)
+	{
+		FontGlyph& glyph = loaded_glyphs[i];
+		GlyphData& data_entry = loaded_glyph_data[i];
+		byte color_format = 0;
+
+		if (!reader.Read(data_entry.character) || !reader.Read(data_entry.ft_glyph_index) || !reader.Read(glyph.dimensions) ||
+			!reader.Read(glyph.bearing) || !reader.Read(glyph.advance) || !reader.Read(glyph.bitmap_dimensions) || !reader.Read(color_format))
+			return false;
+
+		glyph.color_format = (ColorFormat)color_format;
+
+		const Vector2i bitmap_dimensions = glyph.bitmap_dimensions;
+		const bool valid_format = (glyph.color_format == ColorFormat::A8 || glyph.color_format == ColorFormat::RGBA8);
+		if (data_entry.ft_glyph_index == 0 || bitmap_dimensions.x < 0 || bitmap_dimensions.y < 0 || !valid_format)
+			return false;
+
+		const size_t num_bytes = size_t(bitmap_dimensions.x) * size_t(bitmap_dimensions.y) * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1);
+		if (num_bytes > 0)
 		{
-			return it->second;
+			glyph.bitmap_owned_data.reset(new byte[num_bytes]);
+			glyph.bitmap_data = glyph.bitmap_owned_data.get();
+			if (!reader.ReadBytes(glyph.bitmap_owned_data.get(), num_bytes))
+				return false;
+		}
+	}
+
+	for (uint32_t i = 0; i < num_glyphs; i++)
+		InsertGlyph(loaded_glyph_data[i].character, std::move(loaded_glyphs[i]), loaded_glyph_data[i].ft_glyph_index);
+
+	return true;
+}
+
+void FontFaceHandleDefault::SaveCachedGlyphs() const
+{
+	if (cache_key.empty())
+		return;
+
+	String data;
+	FontCache::Writer writer(data);
+
+	// Glyphs copied from fallback faces and the replacement glyph are not part of our face, leave them out.
+	auto is_own_glyph = [](const GlyphData& entry) { return entry.ft_glyph_index != 0; };
+	const uint32_t num_glyphs = (uint32_t)std::count_if(glyph_data.begin(), glyph_data.end(), is_own_glyph);
+	writer.Write(num_glyphs);
+
+	for (size_t i = 0; i < glyphs.size(); i++)
+	{
+		const FontGlyph& glyph = glyphs[i];
+		const GlyphData& data_entry = glyph_data[i];
+		if (data_entry.ft_glyph_index == 0)
+			continue;
+
+		writer.Write(data_entry.character);
+		writer.Write(data_entry.ft_glyph_index);
+		writer.Write(glyph.dimensions);
+		writer.Write(glyph.bearing);
+		writer.Write(glyph.advance);
+		writer.Write(glyph.bitmap_dimensions);
+		writer.Write((byte)glyph.color_format);
+
+		if (glyph.bitmap_data)
+		{
+			const int bytes_per_pixel = (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1);
+			writer.WriteBytes(glyph.bitmap_data, size_t(glyph.bitmap_dimensions.x) * size_t(glyph.bitmap_dimensions.y) * bytes_per_pixel);
 		}
+	}
 
+	if (!FontCache::Save(cache_key + ".glyphs", data))
+		Log::Message(Log::LT_WARNING, "Could not save glyphs of font face '%s' to the font cache.", GetDescription().c_str());
+}
+
+int FontFaceHandleDefault::GetKerning(int lhs_glyph_index, int rhs_glyph_index)
+{
+	// Check if we have no kerning, or if we are missing any of the glyphs.
+	if (!has_kerning || lhs_glyph_index < 0 || rhs_glyph_index < 0)
 		return 0;
+
+	const GlyphData& lhs = glyph_data[lhs_glyph_index];
+	const GlyphData& rhs = glyph_data[rhs_glyph_index];
+
+	// See if the kerning pair has been cached.
+	const char32_t lhs_code = char32_t(lhs.character);
+	const char32_t rhs_code = char32_t(rhs.character);
+	const bool lhs_in_cache = (lhs_code >= KerningCache_AsciiSubsetBegin && lhs_code <= KerningCache_AsciiSubsetLast);
+	const bool rhs_in_cache = (rhs_code >= KerningCache_AsciiSubsetBegin && rhs_code <= KerningCache_AsciiSubsetLast);
+
+	// Glyphs from fallback faces have no kerning with our glyphs.
+	const bool has_glyphs = (lhs.ft_glyph_index != 0 && rhs.ft_glyph_index != 0);
+
+	if (lhs_in_cache && rhs_in_cache)
+	{
+		if (kerning_pair_cache.empty())
+			kerning_pair_cache.resize(KerningCache_AsciiSubsetSize * KerningCache_AsciiSubsetSize, KerningCache_Unknown);
+
+		const int lhs_cache_index = int(lhs_code - KerningCache_AsciiSubsetBegin);
+		const int rhs_cache_index = int(rhs_code - KerningCache_AsciiSubsetBegin);
+		KerningIntType& kerning = kerning_pair_cache[lhs_cache_index * KerningCache_AsciiSubsetSize + rhs_cache_index];
+		if (kerning == KerningCache_Unknown)
+			kerning = KerningIntType(has_glyphs ? FreeType::GetKerning(ft_size, lhs.ft_glyph_index, rhs.ft_glyph_index) : 0);
+
+		return kerning;
 	}
 
+	if (!has_glyphs)
+		return 0;
+
 	// Fetch it from the font face instead.
-	const int result = FreeType::GetKerning(ft_face, metrics.size, lhs, rhs);
+	const int result = FreeType::GetKerning(ft_size, lhs.ft_glyph_index, rhs.ft_glyph_index);
 	return result;
 }
 
-const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, bool look_in_fallback_fonts)
+int FontFaceHandleDefault::GetOrAppendGlyph(Character character, bool look_in_fallback_fonts)
 {
 	// Don't try to render control characters
 	if ((char32_t)character < (char32_t)' ')
-		return nullptr;
+		return -1;
 
-	auto it_glyph = glyphs.find(character);
-	if (it_glyph == glyphs.end())
+	int glyph_index = FindGlyphIndex(character);
+	if (glyph_index >= 0)
+		return glyph_index;
+
+	glyph_index = AppendGlyph(character);
+	if (glyph_index >= 0)
 	{
-		bool result = AppendGlyph(character);
+		is_layers_dirty = true;
+		return glyph_index;
+	}
 
-		if (result)
-		{
-			it_glyph = glyphs.find(character);
-			if (it_glyph == glyphs.end())
-			{
-				RMLUI_ERROR;
-				return nullptr;
-			}
+	if (!look_in_fallback_fonts)
+		return -1;
+
+	// Only the fallback faces containing the character are considered, so that handles are not created for faces that cannot provide it.
+	for (int i = FontProvider::FindFallbackFontFace(character); i >= 0; i = FontProvider::FindFallbackFontFace(character, i + 1))
+	{
+		FontFaceHandleDefault* fallback_face = FontProvider::GetFallbackFontFace(i, metrics.size);
+		if (!fallback_face || fallback_face == this)
+			continue;
 
+		const int fallback_glyph_index = fallback_face->GetOrAppendGlyph(character, false);
+		if (fallback_glyph_index >= 0)
+		{
+			// Insert the new glyph into our own set of glyphs
 			is_layers_dirty = true;
+			return InsertGlyph(character, fallback_face->CopyGlyph(fallback_glyph_index), 0);
 		}
-		else if (look_in_fallback_fonts)
+	}
+
+	// If we still have not found a glyph, use the replacement character.
+	return replacement_glyph_index;
+}
+
+int FontFaceHandleDefault::GetOrAppendFreeTypeGlyph(uint32_t ft_glyph_index)
+{
+	auto it = ft_glyph_indices.find(ft_glyph_index);
+	if (it != ft_glyph_indices.end())
+		return it->second;
+
+	const int glyph_index = AppendGlyph(Character::Null, ft_glyph_index);
+	if (glyph_index >= 0)
+		is_layers_dirty = true;
+
+	return glyph_index;
+}
+
+int FontFaceHandleDefault::GenerateGlyphRun(const String& string, float letter_spacing, Character prior_character)
+{
+	glyph_run.clear();
+
+	// The shaper positions the glyphs itself, including kerning, ligatures, and complex scripts. The distance-field source never renders text.
+	if (FreeType::HasShaper() && glyph_mode != GlyphMode::DistanceFieldSource)
+		return GenerateShapedGlyphRun(string, letter_spacing, prior_character);
+
+	int width = 0;
+	int prior_glyph_index = (prior_character == Character::Null ? -1 : GetOrAppendGlyph(prior_character));
+
+	for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
+	{
+		const int glyph_index = GetOrAppendGlyph(*it_string);
+		if (glyph_index < 0)
+			continue;
+
+		// Adjust the cursor for the kerning between this character and the previous one.
+		width += GetKerning(prior_glyph_index, glyph_index);
+
+		glyph_run.push_back(GlyphRunItem{glyph_index, Vector2i(width, 0)});
+
+		// Adjust the cursor for this character's advance.
+		width += glyphs[glyph_index].advance;
+		width += (int)letter_spacing;
+
+		prior_glyph_index = glyph_index;
+	}
+
+	return width;
+}
+
+int FontFaceHandleDefault::GenerateShapedGlyphRun(const String& string, float letter_spacing, Character prior_character)
+{
+	const ShapedRun& run = GetShapedRun(string, prior_character);
+
+	int width = 0;
+	for (size_t i = 0; i < run.size(); i++)
+	{
+		const ShapedRunItem& item = run[i];
+		if (item.glyph_index >= 0)
+			glyph_run.push_back(GlyphRunItem{item.glyph_index, Vector2i(width, 0) + item.offset});
+
+		width += item.advance;
+
+		// Letter spacing is added after each cluster rather than each glyph, so that combining marks stay attached to their base character.
+		if (i + 1 == run.size() || run[i + 1].cluster != item.cluster)
+			width += (int)letter_spacing;
+	}
+
+	return width;
+}
+
+const FontFaceHandleDefault::ShapedRun& FontFaceHandleDefault::GetShapedRun(const String& string, Character prior_character)
+{
+	// Strings shaped in the context of a prior character rarely repeat, only cache those without.
+	const bool use_cache = (prior_character == Character::Null);
+	if (use_cache)
+	{
+		auto it = shaped_run_cache.find(string);
+		if (it != shaped_run_cache.end())
+			return it->second;
+	}
+
+	FreeType::ShapeString(ft_size, string, prior_character, shaped_glyphs);
+
+	shaped_run.clear();
+	shaped_run.reserve(shaped_glyphs.size());
+
+	for (const ShapedGlyph& shaped_glyph : shaped_glyphs)
+	{
+		ShapedRunItem item = {-1, shaped_glyph.cluster, shaped_glyph.advance, shaped_glyph.offset};
+
+		if (shaped_glyph.glyph_index != 0)
 		{
-			const int num_fallback_faces = FontProvider::CountFallbackFontFaces();
-			for (int i = 0; i < num_fallback_faces; i++)
-			{
-				FontFaceHandleDefault* fallback_face = FontProvider::GetFallbackFontFace(i, metrics.size);
-				if (!fallback_face || fallback_face == this)
-					continue;
-
-				const FontGlyph* glyph = fallback_face->GetOrAppendGlyph(character, false);
-				if (glyph)
-				{
-					// Insert the new glyph into our own set of glyphs
-					auto pair = glyphs.emplace(character, glyph->WeakCopy());
-					it_glyph = pair.first;
-					if (pair.second)
-						is_layers_dirty = true;
-					break;
-				}
-			}
-
-			// If we still have not found a glyph, use the replacement character.
-			if (it_glyph == glyphs.end())
-			{
-				character = Character::Replacement;
-				it_glyph = glyphs.find(character);
-				if (it_glyph == glyphs.end())
-					return nullptr;
-			}
+			item.glyph_index = GetOrAppendFreeTypeGlyph(shaped_glyph.glyph_index);
 		}
 		else
 		{
-			return nullptr;
+			// Characters missing from our face are looked up in the fallback faces, and placed using the advance of the glyph found there.
+			const Character character = StringUtilities::ToCharacter(string.data() + shaped_glyph.cluster);
+			item.glyph_index = GetOrAppendGlyph(character);
+			item.advance = (item.glyph_index >= 0 ? glyphs[item.glyph_index].advance : 0);
+			item.offset = Vector2i(0);
 		}
+
+		shaped_run.push_back(item);
 	}
 
-	const FontGlyph* glyph = &it_glyph->second;
-	return glyph;
+	if (!use_cache)
+		return shaped_run;
+
+	if (shaped_run_cache.size() >= MaxShapedRunCacheSize)
+		shaped_run_cache.clear();
+
+	return shaped_run_cache.emplace(string, shaped_run).first->second;
 }
 
 FontFaceLayer* FontFaceHandleDefault::GetOrCreateLayer(const SharedPtr<const FontEffect>& font_effect)
@@ -448,7 +835,8 @@ bool FontFaceHandleDefault::GenerateLayer(FontFaceLayer* layer)
 
 	if (!font_effect)
 	{
-		result = layer->Generate(this);
+		// The base glyphs are packed into the glyph atlas instead when we have one.
+		result = (glyph_atlas_layer ? true : layer->Generate(this));
 	}
 	else
 	{
@@ -458,9 +846,13 @@ bool FontFaceHandleDefault::GenerateLayer(FontFaceLayer* layer)
 		String generation_key;
 		size_t fingerprint = font_effect->GetFingerprint();
 
-		if (!font_effect->HasUniqueTexture())
+		// Glyphs rendered from distance fields are not part of the base layer, build the effects from their coverage instead.
+		if (distance_field_source)
+			GenerateDistanceFieldCoverage();
+
+		if (!font_effect->HasUniqueTexture() && !distance_field_source)
 		{
-			clone = base_layer;
+			clone = (glyph_atlas_layer ? glyph_atlas_layer : base_layer);
 			clone_glyph_origins = false;
 		}
 		else
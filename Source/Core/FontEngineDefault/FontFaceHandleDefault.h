@@ -40,6 +40,7 @@
 namespace Rml {
 
 class FontFaceLayer;
+class FontGlyphAtlas;
 
 /**
     @author Peter Curry
@@ -50,11 +51,45 @@ public:
 	FontFaceHandleDefault();
 	~FontFaceHandleDefault();
 
-	bool Initialize(FontFaceHandleFreetype face, int font_size, bool load_default_glyphs);
+	/// Determines how the glyphs of the handle are rendered.
+	enum class GlyphMode {
+		// Glyphs are rasterized at the size of the handle.
+		Bitmap,
+		// Glyph outlines are converted to distance fields at the reference size, to be rendered by other handles of the same face.
+		DistanceFieldSource,
+		// Glyph outlines are rendered from the distance fields of the source handle, other glyphs such as color bitmaps are rasterized.
+		DistanceField,
+	};
+
+	/// Initializes the handle for the face at the given size.
+	/// @param[in] face The FreeType face to render glyphs from.
+	/// @param[in] glyph_atlas The atlas shared by the sizes of the face to pack our glyph bitmaps into, or nullptr to generate our own textures.
+	/// @param[in] face_cache_key The key of the face in the persistent font cache, or empty to not use the cache.
+	/// @param[in] font_size The font size of the handle, in pixels.
+	/// @param[in] load_default_glyphs True to load the default set of glyphs (ASCII range).
+	/// @param[in] glyph_mode How the glyphs of the handle are rendered.
+	/// @param[in] distance_field_source The handle providing the distance fields of the face, only used in the distance-field glyph mode.
+	bool Initialize(FontFaceHandleFreetype face, FontGlyphAtlas* glyph_atlas, const String& face_cache_key, int font_size, bool load_default_glyphs,
+		GlyphMode glyph_mode = GlyphMode::Bitmap, FontFaceHandleDefault* distance_field_source = nullptr);
+
+	GlyphMode GetGlyphMode() const;
 
 	const FontMetrics& GetFontMetrics() const;
 
-	const FontGlyphMap& GetGlyphs() const;
+	/// Returns the glyphs loaded in this handle, indexed by their glyph index.
+	const FontGlyphList& GetGlyphs() const;
+
+	/// Returns the index of the glyph in our own FreeType face, or zero if it was copied from a fallback face or is the replacement glyph.
+	uint32_t GetFreeTypeGlyphIndex(int glyph_index) const;
+
+	/// Returns the index of the glyph in the distance-field source handle this glyph is rendered from, or -1 if it is rendered from its own bitmap.
+	int GetDistanceFieldGlyphIndex(int glyph_index) const;
+
+	/// Returns the key identifying this face and size in the persistent font cache, or an empty string if the cache is not used.
+	const String& GetCacheKey() const;
+
+	/// Returns a human-readable description of the font face and size, such as for naming the handle's textures.
+	String GetDescription() const;
 
 	/// Returns the width a string will take up if rendered with this handle.
 	/// @param[in] string The string to measure.
@@ -87,26 +122,76 @@ public:
 	int GenerateString(GeometryList& geometry, const String& string, Vector2f position, Colourb colour, float opacity, float letter_spacing,
 		int layer_configuration = 0);
 
-	/// Version is changed whenever the layers are dirtied, requiring regeneration of string geometry.
+	/// Version is changed whenever the layers are dirtied, requiring regeneration of string geometry. This includes the glyph atlas and the
+	/// layers of the distance-field source handle.
 	int GetVersion() const;
+	/// Version is changed whenever the layers of this handle are dirtied, invalidating the textures generated by previous layers.
+	int GetLayerVersion() const;
 
 private:
-	// Build and append glyph to 'glyphs'
-	bool AppendGlyph(Character character);
+	// Build and append the glyph of the given character from our own font face, returns its glyph index or -1 if not available in the face. The
+	// character is mapped to an already loaded glyph if another character or the text shaper has loaded the same glyph from the face.
+	int AppendGlyph(Character character);
+	// Build and append the glyph with the given index in our own font face, the character is null for glyphs only loaded by the text shaper.
+	int AppendGlyph(Character character, uint32_t ft_glyph_index);
+
+	// Insert a glyph representing the character, returns its glyph index.
+	int InsertGlyph(Character character, FontGlyph&& glyph, uint32_t ft_glyph_index, int distance_field_glyph_index = -1);
 
-	// Build a kerning cache for common characters.
-	void FillKerningPairCache();
+	// Map the character to the given glyph index for later lookups.
+	void SetCharacterGlyphIndex(Character character, int glyph_index);
 
-	// Return the kerning for a character pair.
-	int GetKerning(Character lhs, Character rhs) const;
+	// Returns a copy of the glyph for use by another handle of the same size, which may not render from our distance-field source.
+	FontGlyph CopyGlyph(int glyph_index) const;
+
+	// Generate coverage bitmaps for the glyphs rendered from the distance-field source, needed to generate font effects.
+	void GenerateDistanceFieldCoverage();
+
+	// Returns the scale from the distance-field source to our size.
+	float GetDistanceFieldScale() const;
+
+	// Returns the glyph index of an already loaded character, or -1 if not loaded.
+	int FindGlyphIndex(Character character) const;
+
+	// Insert the default glyphs from the persistent font cache, returns false if they are not cached.
+	bool LoadCachedGlyphs();
+	// Save all glyphs built from our own face to the persistent font cache.
+	void SaveCachedGlyphs() const;
+
+	// Return the kerning for a pair of glyph indices.
+	int GetKerning(int lhs_glyph_index, int rhs_glyph_index);
 
 	/// Retrieve a glyph from the given code point, building and appending a new glyph if not already built.
-	/// @param[in-out] character  The character, can be changed e.g. to the replacement character if no glyph is found.
+	/// @param[in] character  The character to look up.
 	/// @param[in] look_in_fallback_fonts  Look for the glyph in fallback fonts if not found locally, adding it to our glyphs.
-	/// @return The font glyph for the returned code point.
-	const FontGlyph* GetOrAppendGlyph(Character& character, bool look_in_fallback_fonts = true);
+	/// @return The glyph index for the character, which may be the replacement glyph if not found. Negative if no glyph should be rendered.
+	int GetOrAppendGlyph(Character character, bool look_in_fallback_fonts = true);
+
+	// Retrieve a glyph from its index in our own font face, building and appending a new glyph if not already built. Returns -1 if not available.
+	int GetOrAppendFreeTypeGlyph(uint32_t ft_glyph_index);
+
+	// Convert a string to glyph indices and their offsets, returns the total width.
+	int GenerateGlyphRun(const String& string, float letter_spacing, Character prior_character);
+
+	// Convert a string to glyph indices and their offsets using the text shaper, returns the total width.
+	int GenerateShapedGlyphRun(const String& string, float letter_spacing, Character prior_character);
 
-	// Regenerate layers if dirty, such as after adding new glyphs.
+	struct ShapedRunItem {
+		// The glyph index in this handle, or -1 if the glyph should not be rendered.
+		int glyph_index;
+		uint32_t cluster;
+		int advance;
+		Vector2i offset;
+	};
+	using ShapedRun = Vector<ShapedRunItem>;
+
+	// Returns the string shaped into glyphs of this handle, from the cache if available.
+	const ShapedRun& GetShapedRun(const String& string, Character prior_character);
+
+	// Generate the geometry of the glyphs rendered from the distance-field source, using the textures of its base layer.
+	void GenerateDistanceFieldGeometry(GeometryList& geometry, int& geometry_index, Vector2f position, Colourb colour);
+
+	// Regenerate layers if dirty, such as after adding new glyphs, or if the glyph atlas was regenerated.
 	bool UpdateLayersOnDirty();
 
 	// Create a new layer from the given font effect if it does not already exist.
@@ -115,7 +200,44 @@ private:
 	// (Re-)generate a layer in this font face handle.
 	bool GenerateLayer(FontFaceLayer* layer);
 
-	FontGlyphMap glyphs;
+	// Glyphs and the per-glyph data below are indexed by glyph index, and are only ever appended to.
+	FontGlyphList glyphs;
+
+	struct GlyphData {
+		Character character;
+		// The glyph index in our own FreeType face, or zero for glyphs copied from fallback faces.
+		uint32_t ft_glyph_index;
+		// The glyph index in the distance-field source handle, or -1 if the glyph is rendered from its own bitmap.
+		int distance_field_glyph_index;
+	};
+	Vector<GlyphData> glyph_data;
+
+	// Direct-mapped lookup of glyph indices for characters in the basic multilingual plane, split into pages allocated on demand. Negative
+	// entries are not yet loaded. Characters outside this plane are looked up in the map.
+	static constexpr int GlyphPageSize = 256;
+	static constexpr int NumGlyphPages = 0x10000 / GlyphPageSize;
+	using GlyphPage = Array<int, GlyphPageSize>;
+	Array<UniquePtr<GlyphPage>, NumGlyphPages> glyph_pages;
+	UnorderedMap<Character, int> supplementary_glyph_indices;
+
+	// Lookup of glyph indices from their index in our own FreeType face.
+	UnorderedMap<uint32_t, int> ft_glyph_indices;
+
+	int replacement_glyph_index = -1;
+
+	// Scratch buffer of glyph indices and their offsets, reused between calls to avoid allocations.
+	struct GlyphRunItem {
+		int glyph_index;
+		Vector2i offset;
+	};
+	Vector<GlyphRunItem> glyph_run;
+
+	// Strings shaped without a prior character, keyed by the string. The cache is cleared when it grows too large.
+	static constexpr size_t MaxShapedRunCacheSize = 1024;
+	UnorderedMap<String, ShapedRun> shaped_run_cache;
+	// Scratch buffers for shaping strings that are not cached.
+	Vector<ShapedGlyph> shaped_glyphs;
+	ShapedRun shaped_run;
 
 	struct EffectLayerPair {
 		const FontEffect* font_effect;
@@ -132,11 +254,10 @@ private:
 	// Each font layer that generated geometry or textures, indexed by the font-effect's fingerprint key.
 	FontLayerCache layer_cache;
 
-	// Pre-cache kerning pairs for some ascii subset of all characters.
-	using AsciiPair = uint16_t;
+	// Cache kerning pairs for some ascii subset of all characters, as a dense table of all such pairs. The table is allocated when kerning is
+	// first needed, and each pair is looked up the first time it is used.
 	using KerningIntType = int16_t;
-	using KerningPairs = UnorderedMap<AsciiPair, KerningIntType>;
-	KerningPairs kerning_pair_cache;
+	Vector<KerningIntType> kerning_pair_cache;
 
 	bool has_kerning = false;
 	bool is_layers_dirty = false;
@@ -147,7 +268,19 @@ private:
 
 	FontMetrics metrics;
 
+	String cache_key;
+
+	GlyphMode glyph_mode = GlyphMode::Bitmap;
+	FontFaceHandleDefault* distance_field_source = nullptr;
+
+	// The atlas our glyph bitmaps are packed into, and the layer of the atlas our base layer is rendered from instead.
+	FontGlyphAtlas* glyph_atlas = nullptr;
+	int glyph_atlas_member = -1;
+	FontFaceLayer* glyph_atlas_layer = nullptr;
+	int glyph_atlas_version = 0;
+
 	FontFaceHandleFreetype ft_face;
+	FontSizeHandleFreetype ft_size;
 };
 
 } // namespace Rml
@@ -29,11 +29,65 @@
 #include "FontFaceLayer.h"
 #include "../../../Include/RmlUi/Core/Log.h"
 #include "../../../Include/RmlUi/Core/RenderInterface.h"
+#include "../../../Include/RmlUi/Core/StringUtilities.h"
+#include "FontCache.h"
+#include "FontDistanceField.h"
 #include "FontFaceHandleDefault.h"
 #include <string.h>
 
 namespace Rml {
 
+// Copies an RGBA bitmap between two buffers of the given strides.
+static void CopyBitmap(byte* destination, int destination_stride, const byte* source, int source_stride, Vector2i dimensions)
+{
+	for (int y = 0; y < dimensions.y; y++)
+		memcpy(destination + y * destination_stride, source + y * source_stride, size_t(dimensions.x) * 4);
+}
+
+// The effect bitmap file stores each bitmap with its glyph index and dimensions, followed by its RGBA data.
+static void LoadEffectBitmaps(const String& file_name, FontFaceLayer::EffectBitmapMap& out_bitmaps)
+{
+	String data;
+	if (!FontCache::Load(file_name, data))
+		return;
+
+	FontCache::Reader reader(data);
+	uint32_t num_bitmaps = 0;
+	if (!reader.Read(num_bitmaps))
+		return;
+
+	for (uint32_t i = 0; i < num_bitmaps; i++)
+	{
+		uint32_t ft_glyph_index = 0;
+		FontFaceLayer::EffectBitmap bitmap;
+		if (!reader.Read(ft_glyph_index) || !reader.Read(bitmap.dimensions) || bitmap.dimensions.x < 0 || bitmap.dimensions.y < 0)
+			break;
+
+		bitmap.data.resize(size_t(bitmap.dimensions.x) * size_t(bitmap.dimensions.y) * 4);
+		if (!reader.ReadBytes(bitmap.data.data(), bitmap.data.size()))
+			break;
+
+		out_bitmaps[ft_glyph_index] = std::move(bitmap);
+	}
+}
+
+static void SaveEffectBitmaps(const String& file_name, const FontFaceLayer::EffectBitmapMap& bitmaps)
+{
+	String data;
+	FontCache::Writer writer(data);
+
+	writer.Write((uint32_t)bitmaps.size());
+	for (const auto& pair : bitmaps)
+	{
+		writer.Write(pair.first);
+		writer.Write(pair.second.dimensions);
+		writer.WriteBytes(pair.second.data.data(), pair.second.data.size());
+	}
+
+	if (!FontCache::Save(file_name, data))
+		Log::Message(Log::LT_WARNING, "Could not save font effect to the font cache file '%s'.", file_name.c_str());
+}
+
 FontFaceLayer::FontFaceLayer(const SharedPtr<const FontEffect>& _effect) : colour(255, 255, 255)
 {
 	effect = _effect;
@@ -41,7 +95,11 @@ FontFaceLayer::FontFaceLayer(const SharedPtr<const FontEffect>& _effect) : colou
 		colour = effect->GetColour();
 }
 
-FontFaceLayer::~FontFaceLayer() {}
+FontFaceLayer::~FontFaceLayer()
+{
+	if (cached_bitmaps_dirty)
+		SaveEffectBitmaps(cache_file_name, cached_bitmaps);
+}
 
 bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone, bool clone_glyph_origins)
 {
@@ -50,17 +108,17 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 		// @performance: We could be much smarter about this, e.g. such as adding new glyphs to the existing texture layout and textures.
 		// Right now we re-generate the whole thing, including textures.
 		texture_layout = TextureLayout{};
-		character_boxes.clear();
+		glyph_boxes.clear();
 		textures.clear();
 	}
 
-	const FontGlyphMap& glyphs = handle->GetGlyphs();
+	const FontGlyphList& glyphs = handle->GetGlyphs();
 
 	// Generate the new layout.
 	if (clone)
 	{
 		// Clone the geometry and textures from the clone layer.
-		character_boxes = clone->character_boxes;
+		glyph_boxes = clone->glyph_boxes;
 
 		// Copy the cloned layer's textures.
 		for (size_t i = 0; i < clone->textures.size(); ++i)
@@ -69,20 +127,13 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 		// Request the effect (if we have one) and adjust the origins as appropriate.
 		if (effect && !clone_glyph_origins)
 		{
-			for (auto& pair : glyphs)
+			// The clone may have fewer glyphs if the layers have been dirtied in FontHandleDefault. We will probably be regenerated soon, just
+			// skip the remaining glyphs for now.
+			const int num_glyphs = Math::Min((int)glyphs.size(), (int)glyph_boxes.size());
+			for (int glyph_index = 0; glyph_index < num_glyphs; glyph_index++)
 			{
-				Character character = pair.first;
-				const FontGlyph& glyph = pair.second;
-
-				auto it = character_boxes.find(character);
-				if (it == character_boxes.end())
-				{
-					// This can happen if the layers have been dirtied in FontHandleDefault. We will
-					// probably be regenerated soon, just skip the character for now.
-					continue;
-				}
-
-				TextureBox& box = it->second;
+				const FontGlyph& glyph = glyphs[glyph_index];
+				TextureBox& box = glyph_boxes[glyph_index];
 
 				Vector2i glyph_origin = Vector2i(box.origin);
 				Vector2i glyph_dimensions = Vector2i(box.dimensions);
@@ -97,11 +148,14 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 	else
 	{
 		// Initialise the texture layout for the glyphs.
-		character_boxes.reserve(glyphs.size());
-		for (auto& pair : glyphs)
+		glyph_boxes.resize(glyphs.size());
+		for (int glyph_index = 0; glyph_index < (int)glyphs.size(); glyph_index++)
 		{
-			Character character = pair.first;
-			const FontGlyph& glyph = pair.second;
+			// Glyphs rendered from distance fields use the textures of the distance-field source instead of the base layer.
+			if (!effect && handle->GetDistanceFieldGlyphIndex(glyph_index) >= 0)
+				continue;
+
+			const FontGlyph& glyph = glyphs[glyph_index];
 
 			Vector2i glyph_origin(0, 0);
 			Vector2i glyph_dimensions = glyph.bitmap_dimensions;
@@ -119,10 +173,10 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 
 			RMLUI_ASSERT(box.dimensions.x >= 0 && box.dimensions.y >= 0);
 
-			character_boxes[character] = box;
+			glyph_boxes[glyph_index] = box;
 
-			// Add the character's dimensions into the texture layout engine.
-			texture_layout.AddRectangle((int)character, glyph_dimensions);
+			// Add the glyph's dimensions into the texture layout engine.
+			texture_layout.AddRectangle(glyph_index, glyph_dimensions);
 		}
 
 		constexpr int max_texture_dimensions = 1024;
@@ -138,9 +192,7 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 		{
 			TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
 			const TextureLayoutTexture& texture = texture_layout.GetTexture(rectangle.GetTextureIndex());
-			Character character = (Character)rectangle.GetId();
-			RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
-			TextureBox& box = character_boxes[character];
+			TextureBox& box = glyph_boxes[rectangle.GetId()];
 
 			// Set the character's texture index.
 			box.texture_index = rectangle.GetTextureIndex();
@@ -153,25 +205,43 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 		}
 
 		const FontEffect* effect_ptr = effect.get();
-		const int handle_version = handle->GetVersion();
+		const int handle_version = handle->GetLayerVersion();
+		const bool distance_field = (!effect_ptr && handle->GetGlyphMode() == FontFaceHandleDefault::GlyphMode::DistanceFieldSource);
+
+		// Name the textures after the font face, so that they can be identified in the texture database.
+		const String texture_source =
+			"font-face-layer: " + handle->GetDescription() + (effect_ptr ? " (effect)" : (distance_field ? " (distance field)" : ""));
 
 		// Generate the textures.
 		for (int i = 0; i < texture_layout.GetNumTextures(); ++i)
 		{
 			const int texture_id = i;
 
-			TextureCallback texture_callback = [handle, effect_ptr, texture_id, handle_version](RenderInterface* render_interface,
+			TextureCallback texture_callback = [handle, effect_ptr, texture_id, handle_version, distance_field](RenderInterface* render_interface,
 												   const String& /*name*/, TextureHandle& out_texture_handle, Vector2i& out_dimensions) -> bool {
 				UniquePtr<const byte[]> data;
 				if (!handle->GenerateLayerTexture(data, out_dimensions, effect_ptr, texture_id, handle_version) || !data)
 					return false;
+				if (distance_field)
+				{
+					if (render_interface->GenerateDistanceFieldTexture(out_texture_handle, data.get(), out_dimensions))
+						return true;
+
+					// Fall back to the glyph coverage at the reference size, which appears blurred or jagged when scaled to other sizes.
+					Log::Message(Log::LT_WARNING, "Render interface does not support distance-field textures, text may appear blurred.");
+					const size_t num_bytes = size_t(out_dimensions.x) * size_t(out_dimensions.y) * 4;
+					UniquePtr<byte[]> coverage_data(new byte[num_bytes]);
+					memcpy(coverage_data.get(), data.get(), num_bytes);
+					FontDistanceField::ConvertToCoverage(coverage_data.get(), out_dimensions);
+					return render_interface->GenerateTexture(out_texture_handle, coverage_data.get(), out_dimensions);
+				}
 				if (!render_interface->GenerateTexture(out_texture_handle, data.get(), out_dimensions))
 					return false;
 				return true;
 			};
 
 			Texture texture;
-			texture.Set("font-face-layer", texture_callback);
+			texture.Set(texture_source, texture_callback);
 			textures.push_back(texture);
 		}
 	}
@@ -179,11 +249,23 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 	return true;
 }
 
-bool FontFaceLayer::GenerateTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontGlyphMap& glyphs)
+bool FontFaceLayer::GenerateTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, int texture_id,
+	const FontFaceHandleDefault* handle)
 {
 	if (texture_id < 0 || texture_id > texture_layout.GetNumTextures())
 		return false;
 
+	const FontGlyphList& glyphs = handle->GetGlyphs();
+
+	// Effect bitmaps of glyphs from our own face can be reused from the persistent font cache, where they are identified by their FreeType index.
+	if (effect && !cached_bitmaps_loaded && !handle->GetCacheKey().empty())
+	{
+		cache_file_name = CreateString(handle->GetCacheKey().size() + 32, "%s-%016llx.effect", handle->GetCacheKey().c_str(),
+			(unsigned long long)effect->GetFingerprint());
+		LoadEffectBitmaps(cache_file_name, cached_bitmaps);
+		cached_bitmaps_loaded = true;
+	}
+
 	// Generate the texture data.
 	texture_data = texture_layout.GetTexture(texture_id).AllocateTexture();
 	texture_dimensions = texture_layout.GetTexture(texture_id).GetDimensions();
@@ -191,60 +273,82 @@ bool FontFaceLayer::GenerateTexture(UniquePtr<const byte[]>& texture_data, Vecto
 	for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
 	{
 		TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
-		Character character = (Character)rectangle.GetId();
-		RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
+		const int glyph_index = rectangle.GetId();
+		RMLUI_ASSERT(glyph_index >= 0 && glyph_index < (int)glyph_boxes.size());
 
-		TextureBox& box = character_boxes[character];
+		const TextureBox& box = glyph_boxes[glyph_index];
 
-		if (box.texture_index != texture_id)
+		if (box.texture_index != texture_id || glyph_index >= (int)glyphs.size())
 			continue;
 
-		auto it = glyphs.find((Character)rectangle.GetId());
-		if (it == glyphs.end())
-			continue;
-
-		const FontGlyph& glyph = it->second;
+		const FontGlyph& glyph = glyphs[glyph_index];
 
-		if (effect == nullptr)
+		if (effect == nullptr || !effect->HasUniqueTexture())
 		{
-			// Copy the glyph's bitmap data into its allocated texture.
-			if (glyph.bitmap_data)
+			// Copy the glyph's bitmap data into its allocated texture. Effects without a unique texture only offset the glyphs, and are usually
+			// cloned from the base layer instead.
+			CopyGlyphBitmap(rectangle.GetTextureData(), rectangle.GetTextureStride(), glyph);
+		}
+		else
+		{
+			const Vector2i dimensions(box.dimensions);
+			const int stride = rectangle.GetTextureStride();
+			const uint32_t ft_glyph_index = (cache_file_name.empty() ? 0 : handle->GetFreeTypeGlyphIndex(glyph_index));
+			auto it_cached = (ft_glyph_index != 0 ? cached_bitmaps.find(ft_glyph_index) : cached_bitmaps.end());
+
+			if (it_cached != cached_bitmaps.end() && it_cached->second.dimensions == dimensions)
+			{
+				CopyBitmap(rectangle.GetTextureData(), stride, it_cached->second.data.data(), dimensions.x * 4, dimensions);
+			}
+			else
 			{
-				byte* destination = rectangle.GetTextureData();
-				const byte* source = glyph.bitmap_data;
-				const int num_bytes_per_line = glyph.bitmap_dimensions.x * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1);
+				effect->GenerateGlyphTexture(rectangle.GetTextureData(), dimensions, stride, glyph);
 
-				for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
+				if (ft_glyph_index != 0)
 				{
-					switch (glyph.color_format)
-					{
-					case ColorFormat::A8:
-					{
-						for (int k = 0; k < num_bytes_per_line; ++k)
-							destination[k * 4 + 3] = source[k];
-					}
-					break;
-					case ColorFormat::RGBA8:
-					{
-						memcpy(destination, source, num_bytes_per_line);
-					}
-					break;
-					}
-
-					destination += rectangle.GetTextureStride();
-					source += num_bytes_per_line;
+					EffectBitmap& bitmap = cached_bitmaps[ft_glyph_index];
+					bitmap.dimensions = dimensions;
+					bitmap.data.resize(size_t(dimensions.x) * size_t(dimensions.y) * 4);
+					CopyBitmap(bitmap.data.data(), dimensions.x * 4, rectangle.GetTextureData(), stride, dimensions);
+					cached_bitmaps_dirty = true;
 				}
 			}
 		}
-		else
-		{
-			effect->GenerateGlyphTexture(rectangle.GetTextureData(), Vector2i(box.dimensions), rectangle.GetTextureStride(), glyph);
-		}
 	}
 
 	return true;
 }
 
+void FontFaceLayer::CopyGlyphBitmap(byte* destination, const int destination_stride, const FontGlyph& glyph)
+{
+	if (!glyph.bitmap_data)
+		return;
+
+	const byte* source = glyph.bitmap_data;
+	const int num_bytes_per_line = glyph.bitmap_dimensions.x * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1);
+
+	for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
+	{
+		switch (glyph.color_format)
+		{
+		case ColorFormat::A8:
+		{
+			for (int k = 0; k < num_bytes_per_line; ++k)
+				destination[k * 4 + 3] = source[k];
+		}
+		break;
+		case ColorFormat::RGBA8:
+		{
+			memcpy(destination, source, num_bytes_per_line);
+		}
+		break;
+		}
+
+		destination += destination_stride;
+		source += num_bytes_per_line;
+	}
+}
+
 const FontEffect* FontFaceLayer::GetFontEffect() const
 {
 	return effect.get();
@@ -34,6 +34,7 @@
 #include "../../../Include/RmlUi/Core/GeometryUtilities.h"
 #include "../../../Include/RmlUi/Core/Texture.h"
 #include "../TextureLayout.h"
+#include "FontTypes.h"
 
 namespace Rml {
 
@@ -63,21 +64,21 @@ public:
 	/// @param[out] texture_data The pointer to be set to the generated texture data.
 	/// @param[out] texture_dimensions The dimensions of the texture.
 	/// @param[in] texture_id The index of the texture within the layer to generate.
-	/// @param[in] glyphs The glyphs required by the font face handle.
-	bool GenerateTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontGlyphMap& glyphs);
+	/// @param[in] handle The handle owning this layer.
+	bool GenerateTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontFaceHandleDefault* handle);
 
 	/// Generates the geometry required to render a single character.
 	/// @param[out] geometry An array of geometries this layer will write to. It must be at least as big as the number of textures in this layer.
-	/// @param[in] character_code The character to generate geometry for.
+	/// @param[in] glyph_index The index of the glyph to generate geometry for.
 	/// @param[in] position The position of the baseline.
 	/// @param[in] colour The colour of the string.
-	inline void GenerateGeometry(Geometry* geometry, const Character character_code, const Vector2f position, const Colourb colour) const
+	inline void GenerateGeometry(Geometry* geometry, const int glyph_index, const Vector2f position, const Colourb colour) const
 	{
-		auto it = character_boxes.find(character_code);
-		if (it == character_boxes.end())
+		// Glyphs may have been added since the layer was generated, skip them until it is regenerated.
+		if (glyph_index >= (int)glyph_boxes.size())
 			return;
 
-		const TextureBox& box = it->second;
+		const TextureBox& box = glyph_boxes[glyph_index];
 
 		if (box.texture_index < 0)
 			return;
@@ -93,6 +94,34 @@ public:
 			box.dimensions, colour, box.texcoords[0], box.texcoords[1], (int)character_vertices.size() - 4);
 	}
 
+	/// Generates the geometry required to render a single character, scaled from the size the layer was generated at.
+	/// @param[out] geometry An array of geometries this layer will write to. It must be at least as big as the number of textures in this layer.
+	/// @param[in] glyph_index The index of the glyph to generate geometry for.
+	/// @param[in] position The position of the baseline.
+	/// @param[in] colour The colour of the string.
+	/// @param[in] scale The scale to apply to the glyph's geometry.
+	inline void GenerateScaledGeometry(Geometry* geometry, const int glyph_index, const Vector2f position, const Colourb colour,
+		const float scale) const
+	{
+		if (glyph_index >= (int)glyph_boxes.size())
+			return;
+
+		const TextureBox& box = glyph_boxes[glyph_index];
+
+		if (box.texture_index < 0)
+			return;
+
+		// Scaled glyphs are placed with sub-pixel precision, they are rendered from distance fields which remain sharp at any position.
+		Vector<Vertex>& character_vertices = geometry[box.texture_index].GetVertices();
+		Vector<int>& character_indices = geometry[box.texture_index].GetIndices();
+
+		character_vertices.resize(character_vertices.size() + 4);
+		character_indices.resize(character_indices.size() + 6);
+		GeometryUtilities::GenerateQuad(&character_vertices[0] + (character_vertices.size() - 4),
+			&character_indices[0] + (character_indices.size() - 6), position + box.origin * scale, box.dimensions * scale, colour, box.texcoords[0],
+			box.texcoords[1], (int)character_vertices.size() - 4);
+	}
+
 	/// Returns the effect used to generate the layer.
 	const FontEffect* GetFontEffect() const;
 
@@ -104,7 +133,18 @@ public:
 	/// Returns the layer's colour.
 	Colourb GetColour() const;
 
+	// Rendered bitmap of a glyph with the layer's effect applied, stored in the persistent font cache.
+	struct EffectBitmap {
+		Vector2i dimensions;
+		Vector<byte> data;
+	};
+	// Effect bitmaps indexed by the glyph index in the FreeType face.
+	using EffectBitmapMap = UnorderedMap<uint32_t, EffectBitmap>;
+
 private:
+	// Copies the glyph's bitmap into RGBA texture data.
+	static void CopyGlyphBitmap(byte* destination, int destination_stride, const FontGlyph& glyph);
+
 	struct TextureBox {
 		TextureBox() : texture_index(-1) {}
 
@@ -119,16 +159,26 @@ private:
 		int texture_index;
 	};
 
-	using CharacterMap = UnorderedMap<Character, TextureBox>;
+	// Indexed by glyph index, boxes without a texture index are not rendered.
+	using GlyphBoxList = Vector<TextureBox>;
 	using TextureList = Vector<Texture>;
 
 	SharedPtr<const FontEffect> effect;
 
+	// Effect bitmaps of the persistent font cache, loaded when first needed. New bitmaps are only saved when the layer is destroyed, such as
+	// when the font resources are released, to avoid rewriting the file whenever glyphs are added.
+	String cache_file_name;
+	EffectBitmapMap cached_bitmaps;
+	bool cached_bitmaps_loaded = false;
+	bool cached_bitmaps_dirty = false;
+
 	TextureLayout texture_layout;
 
-	CharacterMap character_boxes;
+	GlyphBoxList glyph_boxes;
 	TextureList textures;
 	Colourb colour;
+
+	friend class FontGlyphAtlas;
 };
 
 } // namespace Rml
@@ -0,0 +1,75 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "FontFaceMemory.h"
+#include "../../../Include/RmlUi/Core/Core.h"
+#include "../../../Include/RmlUi/Core/FileInterface.h"
+
+namespace Rml {
+
+UniquePtr<FontFaceMemory> FontFaceMemory::Load(const String& file_name)
+{
+	FileInterface* file_interface = GetFileInterface();
+	UniquePtr<FontFaceMemory> memory(new FontFaceMemory());
+
+	if (file_interface->MapFile(file_name, memory->data, memory->size))
+	{
+		memory->mapping_file_interface = file_interface;
+		return memory;
+	}
+
+	FileHandle handle = file_interface->Open(file_name);
+	if (!handle)
+		return nullptr;
+
+	memory->size = file_interface->Length(handle);
+	memory->buffer = UniquePtr<byte[]>(new byte[memory->size]);
+	memory->data = memory->buffer.get();
+	file_interface->Read(memory->buffer.get(), memory->size, handle);
+	file_interface->Close(handle);
+
+	return memory;
+}
+
+FontFaceMemory::~FontFaceMemory()
+{
+	if (mapping_file_interface)
+		mapping_file_interface->UnmapFile(data, size);
+}
+
+const byte* FontFaceMemory::GetData() const
+{
+	return data;
+}
+
+size_t FontFaceMemory::GetSize() const
+{
+	return size;
+}
+
+} // namespace Rml
@@ -0,0 +1,69 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTFACEMEMORY_H
+#define RMLUI_CORE_FONTENGINEDEFAULT_FONTFACEMEMORY_H
+
+#include "../../../Include/RmlUi/Core/Traits.h"
+#include "../../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class FileInterface;
+
+/**
+    Owns the data of a font file used by FreeType faces. The file is mapped into memory when supported by the file interface, so that only the
+    parts used by FreeType are read, otherwise it is read into a buffer.
+ */
+
+class FontFaceMemory final : public NonCopyMoveable {
+public:
+	/// Maps or reads the given font file through the file interface.
+	/// @param[in] file_name The path of the font file.
+	/// @return The memory of the file, or nullptr if it could not be opened.
+	static UniquePtr<FontFaceMemory> Load(const String& file_name);
+
+	~FontFaceMemory();
+
+	const byte* GetData() const;
+	size_t GetSize() const;
+
+private:
+	FontFaceMemory() = default;
+
+	const byte* data = nullptr;
+	size_t size = 0;
+
+	// Only set if the file was read into memory.
+	UniquePtr<byte[]> buffer;
+	// Only set if the file is mapped, the mapping is released through the same interface.
+	FileInterface* mapping_file_interface = nullptr;
+};
+
+} // namespace Rml
+#endif
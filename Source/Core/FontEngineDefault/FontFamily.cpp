@@ -30,6 +30,7 @@
 #include "../../../Include/RmlUi/Core/ComputedValues.h"
 #include "../../../Include/RmlUi/Core/Math.h"
 #include "FontFace.h"
+#include "FontFaceMemory.h"
 #include <limits.h>
 
 namespace Rml {
@@ -76,7 +77,7 @@ FontFaceHandleDefault* FontFamily::GetFaceHandle(Style::FontStyle style, Style::
 	return matching_face->GetHandle(size, true);
 }
 
-FontFace* FontFamily::AddFace(FontFaceHandleFreetype ft_face, Style::FontStyle style, Style::FontWeight weight, UniquePtr<byte[]> face_memory)
+FontFace* FontFamily::AddFace(FontFaceHandleFreetype ft_face, Style::FontStyle style, Style::FontWeight weight, UniquePtr<FontFaceMemory> face_memory)
 {
 	auto face = MakeUnique<FontFace>(ft_face, style, weight);
 	FontFace* result = face.get();
@@ -34,6 +34,7 @@
 namespace Rml {
 
 class FontFace;
+class FontFaceMemory;
 class FontFaceHandleDefault;
 
 /**
@@ -58,7 +59,7 @@ public:
 	/// @param[in] weight The weight of the new face.
 	/// @param[in] face_memory Optionally pass ownership of the face's memory to the face itself, automatically releasing it on destruction.
 	/// @return True if the face was loaded successfully, false otherwise.
-	FontFace* AddFace(FontFaceHandleFreetype ft_face, Style::FontStyle style, Style::FontWeight weight, UniquePtr<byte[]> face_memory);
+	FontFace* AddFace(FontFaceHandleFreetype ft_face, Style::FontStyle style, Style::FontWeight weight, UniquePtr<FontFaceMemory> face_memory);
 
 	/// Releases resources owned by sized font faces, including their textures and rendered glyphs.
 	void ReleaseFontResources();
@@ -69,7 +70,7 @@ protected:
 	struct FontFaceEntry {
 		UniquePtr<FontFace> face;
 		// Only filled if we own the memory used by the face's FreeType handle. May be shared with other faces in this family.
-		UniquePtr<byte[]> face_memory;
+		UniquePtr<FontFaceMemory> face_memory;
 	};
 
 	using FontFaceList = Vector<FontFaceEntry>;
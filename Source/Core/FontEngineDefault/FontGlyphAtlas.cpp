@@ -0,0 +1,289 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "FontGlyphAtlas.h"
+#include "../../../Include/RmlUi/Core/Core.h"
+#include "../../../Include/RmlUi/Core/RenderInterface.h"
+#include "FontFaceHandleDefault.h"
+#include "FontFaceLayer.h"
+#include <algorithm>
+
+namespace Rml {
+
+// Dimensions of the regular pages, glyphs larger than this are placed on their own page.
+static constexpr int page_size = 512;
+// Spacing between the glyphs, so that they don't bleed into each other when sampled.
+static constexpr int glyph_padding = 1;
+
+FontGlyphAtlas::FontGlyphAtlas(const String& description) : description(description) {}
+
+FontGlyphAtlas::~FontGlyphAtlas() {}
+
+int FontGlyphAtlas::AddHandle(const FontFaceHandleDefault* handle)
+{
+	members.push_back(Member{handle, MakeUnique<FontFaceLayer>(nullptr), 0, 0});
+	is_dirty = true;
+	return (int)members.size() - 1;
+}
+
+FontFaceLayer* FontGlyphAtlas::GetLayer(int member_index) const
+{
+	RMLUI_ASSERT(member_index >= 0 && member_index < (int)members.size());
+	return members[member_index].layer.get();
+}
+
+void FontGlyphAtlas::SetDirty()
+{
+	is_dirty = true;
+}
+
+bool FontGlyphAtlas::UpdateOnDirty()
+{
+	if (!is_dirty)
+		return false;
+
+	is_dirty = false;
+
+	Vector<int> packed_members;
+	for (int member_index = 0; member_index < (int)members.size(); member_index++)
+	{
+		if (members[member_index].num_packed_glyphs < (int)members[member_index].handle->GetGlyphs().size())
+		{
+			PackNewGlyphs(member_index);
+			packed_members.push_back(member_index);
+		}
+	}
+
+	for (int page_index = 0; page_index < (int)pages.size(); page_index++)
+	{
+		if (pages[page_index].is_dirty)
+		{
+			pages[page_index].is_dirty = false;
+			UpdatePageTexture(page_index);
+		}
+	}
+
+	// The packed members may reference any of the pages now, other members keep their textures so that their geometry remains valid.
+	for (int member_index : packed_members)
+	{
+		Member& member = members[member_index];
+		member.layer->textures.resize(pages.size());
+		for (size_t i = 0; i < pages.size(); i++)
+			member.layer->textures[i] = pages[i].texture;
+		++member.version;
+	}
+
+	return !packed_members.empty();
+}
+
+int FontGlyphAtlas::GetVersion(int member_index) const
+{
+	RMLUI_ASSERT(member_index >= 0 && member_index < (int)members.size());
+	return members[member_index].version;
+}
+
+void FontGlyphAtlas::PackNewGlyphs(int member_index)
+{
+	Member& member = members[member_index];
+	const FontFaceHandleDefault* handle = member.handle;
+	FontFaceLayer* layer = member.layer.get();
+	const FontGlyphList& glyphs = handle->GetGlyphs();
+
+	layer->glyph_boxes.resize(glyphs.size());
+
+	for (int glyph_index = member.num_packed_glyphs; glyph_index < (int)glyphs.size(); glyph_index++)
+	{
+		// Glyphs rendered from distance fields use the textures of the distance-field source instead.
+		if (handle->GetDistanceFieldGlyphIndex(glyph_index) >= 0)
+			continue;
+
+		const FontGlyph& glyph = glyphs[glyph_index];
+
+		FontFaceLayer::TextureBox& box = layer->glyph_boxes[glyph_index];
+		box.origin = Vector2f(float(glyph.bearing.x), float(-glyph.bearing.y));
+		box.dimensions = Vector2f(glyph.bitmap_dimensions);
+
+		if (glyph.bitmap_dimensions.x <= 0 || glyph.bitmap_dimensions.y <= 0)
+			continue;
+
+		Vector2i position;
+		const int page_index = Allocate(glyph.bitmap_dimensions, position);
+		Page& page = pages[page_index];
+		page.entries.push_back(Entry{member_index, glyph_index, position});
+		page.is_dirty = true;
+
+		const Vector2f page_dimensions(page.dimensions);
+		box.texture_index = page_index;
+		box.texcoords[0] = Vector2f(position) / page_dimensions;
+		box.texcoords[1] = Vector2f(position + glyph.bitmap_dimensions) / page_dimensions;
+	}
+
+	member.num_packed_glyphs = (int)glyphs.size();
+}
+
+int FontGlyphAtlas::Allocate(Vector2i dimensions, Vector2i& out_position)
+{
+	const Vector2i padded_dimensions = dimensions + Vector2i(glyph_padding);
+
+	if (padded_dimensions.x > page_size || padded_dimensions.y > page_size)
+	{
+		out_position = Vector2i(0);
+		return AddPage(padded_dimensions);
+	}
+
+	for (int page_index = 0; page_index < (int)pages.size(); page_index++)
+	{
+		Page& page = pages[page_index];
+		if (page.dimensions != Vector2i(page_size))
+			continue;
+
+		// Prefer the shelf with the least wasted height, but open a new shelf instead if the best one is much taller than the glyph.
+		Shelf* best_shelf = nullptr;
+		for (Shelf& shelf : page.shelves)
+		{
+			if (shelf.height >= padded_dimensions.y && shelf.width_used + padded_dimensions.x <= page_size &&
+				(!best_shelf || shelf.height < best_shelf->height))
+				best_shelf = &shelf;
+		}
+
+		const bool fits_new_shelf = (page.height_used + padded_dimensions.y <= page_size);
+		if (best_shelf && (best_shelf->height <= padded_dimensions.y * 3 / 2 || !fits_new_shelf))
+		{
+			out_position = Vector2i(best_shelf->width_used, best_shelf->position_y);
+			best_shelf->width_used += padded_dimensions.x;
+			return page_index;
+		}
+
+		if (fits_new_shelf)
+		{
+			page.shelves.push_back(Shelf{page.height_used, padded_dimensions.y, padded_dimensions.x});
+			out_position = Vector2i(0, page.height_used);
+			page.height_used += padded_dimensions.y;
+			return page_index;
+		}
+	}
+
+	const int page_index = AddPage(Vector2i(page_size));
+	Page& page = pages[page_index];
+	page.shelves.push_back(Shelf{0, padded_dimensions.y, padded_dimensions.x});
+	page.height_used = padded_dimensions.y;
+	out_position = Vector2i(0);
+	return page_index;
+}
+
+int FontGlyphAtlas::AddPage(Vector2i dimensions)
+{
+	const int page_index = (int)pages.size();
+	pages.emplace_back();
+	pages.back().dimensions = dimensions;
+	pages.back().texture = CreatePageTexture(page_index);
+	return page_index;
+}
+
+Texture FontGlyphAtlas::CreatePageTexture(int page_index)
+{
+	TextureCallback texture_callback = [this, page_index](RenderInterface* render_interface, const String& /*name*/,
+										   TextureHandle& out_texture_handle, Vector2i& out_dimensions) -> bool {
+		UniquePtr<const byte[]> data;
+		if (!GenerateTexture(data, out_dimensions, page_index) || !data)
+			return false;
+		if (!render_interface->GenerateTexture(out_texture_handle, data.get(), out_dimensions))
+			return false;
+		pages[page_index].texture_generated = true;
+		return true;
+	};
+
+	Texture texture;
+	texture.Set("font-face-atlas: " + description + " #" + ToString(page_index), texture_callback);
+	return texture;
+}
+
+void FontGlyphAtlas::UpdatePageTexture(int page_index)
+{
+	Page& page = pages[page_index];
+
+	// Pages not yet used by the renderer are generated with all their current glyphs once they are.
+	if (!page.texture_generated)
+		return;
+
+	RenderInterface* render_interface = GetRenderInterface();
+	const TextureHandle texture_handle = page.texture.GetHandle();
+
+	UniquePtr<const byte[]> data;
+	Vector2i dimensions;
+	if (render_interface && texture_handle && GenerateTexture(data, dimensions, page_index) &&
+		render_interface->UpdateTexture(texture_handle, data.get(), dimensions))
+		return;
+
+	// The renderer can't update the texture in place, replace it by a new one. The geometry of the members using this page refers to the old
+	// texture, so they need to be regenerated.
+	page.texture = CreatePageTexture(page_index);
+	page.texture_generated = false;
+
+	for (int member_index = 0; member_index < (int)members.size(); member_index++)
+	{
+		Member& member = members[member_index];
+		if (page_index >= (int)member.layer->textures.size())
+			continue;
+
+		member.layer->textures[page_index] = page.texture;
+
+		const bool has_glyphs_on_page = std::any_of(page.entries.begin(), page.entries.end(),
+			[member_index](const Entry& entry) { return entry.member_index == member_index; });
+		if (has_glyphs_on_page)
+			++member.version;
+	}
+}
+
+bool FontGlyphAtlas::GenerateTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, int page_index) const
+{
+	if (page_index < 0 || page_index >= (int)pages.size())
+		return false;
+
+	const Page& page = pages[page_index];
+	const int stride = page.dimensions.x * 4;
+
+	UniquePtr<byte[]> data(new byte[page.dimensions.x * page.dimensions.y * 4]);
+
+	// Set the texture to transparent white.
+	for (int i = 0; i < page.dimensions.x * page.dimensions.y; i++)
+		((unsigned int*)(data.get()))[i] = 0x00ffffff;
+
+	for (const Entry& entry : page.entries)
+	{
+		const FontGlyph& glyph = members[entry.member_index].handle->GetGlyphs()[entry.glyph_index];
+		FontFaceLayer::CopyGlyphBitmap(data.get() + entry.position.y * stride + entry.position.x * 4, stride, glyph);
+	}
+
+	texture_data = std::move(data);
+	texture_dimensions = page.dimensions;
+
+	return true;
+}
+
+} // namespace Rml
@@ -0,0 +1,122 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTGLYPHATLAS_H
+#define RMLUI_CORE_FONTENGINEDEFAULT_FONTGLYPHATLAS_H
+
+#include "../../../Include/RmlUi/Core/Texture.h"
+#include "../../../Include/RmlUi/Core/Traits.h"
+#include "FontTypes.h"
+
+namespace Rml {
+
+class FontFaceHandleDefault;
+class FontFaceLayer;
+
+/**
+    Packs the glyph bitmaps of all the sizes of a font face into a shared set of texture pages. Each handle renders its base layer from the
+    atlas, instead of generating textures for every size.
+
+    New glyphs are packed into the free space of the existing pages, and glyphs are never moved once placed. Thus, adding glyphs to one size
+    only updates the pages they were placed on, and leaves the layers of the other sizes untouched.
+ */
+
+class FontGlyphAtlas final : public NonCopyMoveable {
+public:
+	/// @param[in] description A human-readable description of the font face, used for naming the textures.
+	FontGlyphAtlas(const String& description);
+	~FontGlyphAtlas();
+
+	/// Adds a handle whose glyphs should be packed into the atlas. The handle must outlive the atlas, or be released together with it.
+	/// @return The index of the handle's member in the atlas.
+	int AddHandle(const FontFaceHandleDefault* handle);
+
+	/// Returns the layer the given member renders its glyphs from, owned by the atlas and updated whenever its glyphs are packed.
+	FontFaceLayer* GetLayer(int member_index) const;
+
+	/// Marks the atlas dirty, such as after new glyphs were added to one of its handles.
+	void SetDirty();
+	/// Packs any new glyphs of the handles into the atlas if it is dirty, and updates the textures of the pages they were placed on.
+	/// @return True if any glyphs were packed.
+	bool UpdateOnDirty();
+
+	/// Version is changed whenever the layer of the given member changes, invalidating the geometry generated from it.
+	int GetVersion(int member_index) const;
+
+private:
+	// Packs the glyphs added to the member's handle since it was last packed, and sets up their texture boxes.
+	void PackNewGlyphs(int member_index);
+	// Finds space for a rectangle of the given dimensions, adding a new page if needed. Returns the index of the page.
+	int Allocate(Vector2i dimensions, Vector2i& out_position);
+	// Adds a new page of the given dimensions, with a texture generated from the page's entries when first used.
+	int AddPage(Vector2i dimensions);
+	Texture CreatePageTexture(int page_index);
+	// Updates the texture of a page after new glyphs were placed on it.
+	void UpdatePageTexture(int page_index);
+	// Generate the data of one of the page textures from its current entries.
+	bool GenerateTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, int page_index) const;
+
+	struct Member {
+		const FontFaceHandleDefault* handle;
+		UniquePtr<FontFaceLayer> layer;
+		int num_packed_glyphs;
+		int version;
+	};
+	Vector<Member> members;
+
+	// A glyph placed on a page.
+	struct Entry {
+		int member_index;
+		int glyph_index;
+		Vector2i position;
+	};
+
+	// A row of glyphs with a fixed height, new glyphs are appended to the shelf with the closest matching height.
+	struct Shelf {
+		int position_y;
+		int height;
+		int width_used;
+	};
+
+	struct Page {
+		Vector2i dimensions;
+		Vector<Shelf> shelves;
+		int height_used = 0;
+		Vector<Entry> entries;
+		Texture texture;
+		bool texture_generated = false;
+		bool is_dirty = false;
+	};
+	Vector<Page> pages;
+
+	String description;
+	bool is_dirty = false;
+};
+
+} // namespace Rml
+#endif
@@ -28,12 +28,12 @@
 
 #include "FontProvider.h"
 #include "../../../Include/RmlUi/Core/Core.h"
-#include "../../../Include/RmlUi/Core/FileInterface.h"
 #include "../../../Include/RmlUi/Core/Log.h"
 #include "../../../Include/RmlUi/Core/Math.h"
 #include "../../../Include/RmlUi/Core/StringUtilities.h"
 #include "../ComputeProperty.h"
 #include "FontFace.h"
+#include "FontFaceMemory.h"
 #include "FontFamily.h"
 #include "FreeTypeInterface.h"
 #include <algorithm>
@@ -98,11 +98,29 @@ FontFaceHandleDefault* FontProvider::GetFallbackFontFace(int index, int font_siz
 	auto& faces = FontProvider::Get().fallback_font_faces;
 
 	if (index >= 0 && index < (int)faces.size())
-		return faces[index]->GetHandle(font_size, false);
+		return faces[index].face->GetHandle(font_size, false);
 
 	return nullptr;
 }
 
+int FontProvider::FindFallbackFontFace(Character character, int start_index)
+{
+	const auto& faces = FontProvider::Get().fallback_font_faces;
+	const char32_t code = char32_t(character);
+
+	for (int i = Math::Max(start_index, 0); i < (int)faces.size(); i++)
+	{
+		// Find the last range starting at or before the character.
+		const Vector<CharacterRange>& ranges = faces[i].character_ranges;
+		auto it = std::upper_bound(ranges.begin(), ranges.end(), code,
+			[](char32_t value, const CharacterRange& range) { return value < range.first; });
+		if (it != ranges.begin() && code <= std::prev(it)->last)
+			return i;
+	}
+
+	return -1;
+}
+
 void FontProvider::ReleaseFontResources()
 {
 	RMLUI_ASSERT(g_font_provider);
@@ -112,23 +130,19 @@ void FontProvider::ReleaseFontResources()
 
 bool FontProvider::LoadFontFace(const String& file_name, bool fallback_face, Style::FontWeight weight)
 {
-	FileInterface* file_interface = GetFileInterface();
-	FileHandle handle = file_interface->Open(file_name);
+	// Large fonts are mapped when possible, then FreeType only reads the parts of the file it needs.
+	UniquePtr<FontFaceMemory> face_memory = FontFaceMemory::Load(file_name);
 
-	if (!handle)
+	if (!face_memory)
 	{
 		Log::Message(Log::LT_ERROR, "Failed to load font face from %s, could not open file.", file_name.c_str());
 		return false;
 	}
 
-	size_t length = file_interface->Length(handle);
-
-	auto buffer_ptr = UniquePtr<byte[]>(new byte[length]);
-	byte* buffer = buffer_ptr.get();
-	file_interface->Read(buffer, length, handle);
-	file_interface->Close(handle);
+	const byte* data = face_memory->GetData();
+	const int data_size = (int)face_memory->GetSize();
 
-	bool result = Get().LoadFontFace(buffer, (int)length, fallback_face, std::move(buffer_ptr), file_name, {}, Style::FontStyle::Normal, weight);
+	bool result = Get().LoadFontFace(data, data_size, fallback_face, std::move(face_memory), file_name, {}, Style::FontStyle::Normal, weight);
 
 	return result;
 }
@@ -143,7 +157,7 @@ bool FontProvider::LoadFontFace(const byte* data, int data_size, const String& f
 	return result;
 }
 
-bool FontProvider::LoadFontFace(const byte* data, int data_size, bool fallback_face, UniquePtr<byte[]> face_memory, const String& source,
+bool FontProvider::LoadFontFace(const byte* data, int data_size, bool fallback_face, UniquePtr<FontFaceMemory> face_memory, const String& source,
 	String font_family, Style::FontStyle style, Style::FontWeight weight)
 {
 	using Style::FontWeight;
@@ -230,7 +244,7 @@ bool FontProvider::LoadFontFace(const byte* data, int data_size, bool fallback_f
 }
 
 bool FontProvider::AddFace(FontFaceHandleFreetype face, const String& family, Style::FontStyle style, Style::FontWeight weight, bool fallback_face,
-	UniquePtr<byte[]> face_memory)
+	UniquePtr<FontFaceMemory> face_memory)
 {
 	if (family.empty() || weight == Style::FontWeight::Auto)
 		return false;
@@ -253,10 +267,13 @@ bool FontProvider::AddFace(FontFaceHandleFreetype face, const String& family, St
 
 	if (font_face_result && fallback_face)
 	{
-		auto it_fallback_face = std::find(fallback_font_faces.begin(), fallback_font_faces.end(), font_face_result);
+		auto it_fallback_face = std::find_if(fallback_font_faces.begin(), fallback_font_faces.end(),
+			[font_face_result](const FallbackFontFace& fallback) { return fallback.face == font_face_result; });
 		if (it_fallback_face == fallback_font_faces.end())
 		{
-			fallback_font_faces.push_back(font_face_result);
+			FallbackFontFace fallback{font_face_result, {}};
+			FreeType::GetCharacterRanges(face, fallback.character_ranges);
+			fallback_font_faces.push_back(std::move(fallback));
 		}
 	}
 
@@ -38,6 +38,7 @@ namespace Rml {
 class FontFace;
 class FontFamily;
 class FontFaceHandleDefault;
+class FontFaceMemory;
 
 /**
     The font provider contains all font families currently in use by RmlUi.
@@ -72,6 +73,12 @@ public:
 	/// Return a font face handle with the given index, at the given font size.
 	static FontFaceHandleDefault* GetFallbackFontFace(int index, int font_size);
 
+	/// Return the index of the first fallback font face containing the character, without creating any font face handles.
+	/// @param[in] character The character to look for.
+	/// @param[in] start_index The index of the first fallback font face to consider.
+	/// @return The index of the fallback font face, or -1 if no such face contains the character.
+	static int FindFallbackFontFace(Character character, int start_index = 0);
+
 	/// Releases resources owned by sized font faces, including their textures and rendered glyphs.
 	static void ReleaseFontResources();
 
@@ -81,17 +88,22 @@ private:
 
 	static FontProvider& Get();
 
-	bool LoadFontFace(const byte* data, int data_size, bool fallback_face, UniquePtr<byte[]> face_memory, const String& source, String font_family,
-		Style::FontStyle style, Style::FontWeight weight);
+	bool LoadFontFace(const byte* data, int data_size, bool fallback_face, UniquePtr<FontFaceMemory> face_memory, const String& source,
+		String font_family, Style::FontStyle style, Style::FontWeight weight);
 
 	bool AddFace(FontFaceHandleFreetype face, const String& family, Style::FontStyle style, Style::FontWeight weight, bool fallback_face,
-		UniquePtr<byte[]> face_memory);
-
-	using FontFaceList = Vector<FontFace*>;
+		UniquePtr<FontFaceMemory> face_memory);
+
+	struct FallbackFontFace {
+		FontFace* face;
+		// The characters available in the face, built from its character map when the face is added.
+		Vector<CharacterRange> character_ranges;
+	};
+	using FallbackFontFaceList = Vector<FallbackFontFace>;
 	using FontFamilyMap = UnorderedMap<String, UniquePtr<FontFamily>>;
 
 	FontFamilyMap font_families;
-	FontFaceList fallback_font_faces;
+	FallbackFontFaceList fallback_font_faces;
 
 	static const String debugger_font_family_name;
 };
@@ -36,6 +36,28 @@
 namespace Rml {
 
 using FontFaceHandleFreetype = uintptr_t;
+using FontSizeHandleFreetype = uintptr_t;
+
+// Glyphs of a font face handle, indexed by their glyph index in the handle.
+using FontGlyphList = Vector<FontGlyph>;
+
+// An inclusive range of characters.
+struct CharacterRange {
+	char32_t first;
+	char32_t last;
+};
+
+// A glyph positioned by the text shaper.
+struct ShapedGlyph {
+	// The glyph index in the FreeType face, or zero if the face does not contain the character.
+	uint32_t glyph_index;
+	// The byte offset into the shaped string of the first character represented by the glyph.
+	uint32_t cluster;
+	// The horizontal advance of the pen after the glyph, in pixels.
+	int advance;
+	// The offset of the glyph from the pen position, in pixels, positive y is downwards.
+	Vector2i offset;
+};
 
 struct FaceVariation {
 	Style::FontWeight weight;
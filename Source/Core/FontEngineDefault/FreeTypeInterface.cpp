@@ -30,20 +30,43 @@
 #include "../../../Include/RmlUi/Core/ComputedValues.h"
 #include "../../../Include/RmlUi/Core/FontMetrics.h"
 #include "../../../Include/RmlUi/Core/Log.h"
+#include "../../../Include/RmlUi/Core/Math.h"
+#include "../../../Include/RmlUi/Core/StringUtilities.h"
+#include "../FrameStatisticsCollector.h"
 #include <algorithm>
 #include <ft2build.h>
 #include <limits.h>
 #include <string.h>
 #include FT_FREETYPE_H
 #include FT_MULTIPLE_MASTERS_H
+#include FT_SIZES_H
 #include FT_TRUETYPE_TABLES_H
 
+#ifdef RMLUI_ENABLE_HARFBUZZ
+	#include <hb-ft.h>
+	#include <hb.h>
+#endif
+
 namespace Rml {
 
 static FT_Library ft_library = nullptr;
 
-static bool BuildGlyph(FT_Face ft_face, Character character, FontGlyphMap& glyphs, float bitmap_scaling_factor);
-static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs, float bitmap_scaling_factor, bool load_default_glyphs);
+// The state behind a size handle, the FreeType size object is owned by its face.
+struct FaceSizeFreetype {
+	FT_Size ft_size;
+	float bitmap_scaling_factor;
+#ifdef RMLUI_ENABLE_HARFBUZZ
+	// The HarfBuzz font used to shape text at this size, created when first needed.
+	hb_font_t* hb_font = nullptr;
+#endif
+};
+
+#ifdef RMLUI_ENABLE_HARFBUZZ
+// The buffer used for shaping, reused between calls to avoid allocations.
+static hb_buffer_t* hb_buffer = nullptr;
+#endif
+
+static bool LoadGlyph(FT_Face ft_face, FT_UInt index, Character character, FontGlyph& glyph, float bitmap_scaling_factor, bool render_outlines);
 static void GenerateMetrics(FT_Face ft_face, FontMetrics& metrics, float bitmap_scaling_factor);
 static bool SetFontSize(FT_Face ft_face, int font_size, float& out_bitmap_scaling_factor);
 static void BitmapDownscale(byte* bitmap_new, int new_width, int new_height, const byte* bitmap_source, int width, int height, int pitch,
@@ -71,6 +94,14 @@ bool FreeType::Initialise()
 
 void FreeType::Shutdown()
 {
+#ifdef RMLUI_ENABLE_HARFBUZZ
+	if (hb_buffer)
+	{
+		hb_buffer_destroy(hb_buffer);
+		hb_buffer = nullptr;
+	}
+#endif
+
 	if (ft_library != nullptr)
 	{
 		FT_Done_FreeType(ft_library);
@@ -187,62 +218,155 @@ void FreeType::GetFaceStyle(FontFaceHandleFreetype in_face, String* font_family,
 	}
 }
 
-bool FreeType::InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, FontGlyphMap& glyphs, FontMetrics& metrics, bool load_default_glyphs)
+String FreeType::GetFaceCacheKey(FontFaceHandleFreetype in_face)
+{
+	FT_Face face = (FT_Face)in_face;
+
+	// Faces are always loaded from memory, hash the font data with 64-bit FNV-1a. Unlike our other hash functions, this gives the same result on
+	// every platform and between runs. For SFNT fonts, only the start of the file is hashed, which includes the table directory with the checksum
+	// of each table, together with the checksum of the whole file from the head table. This avoids reading all of a memory-mapped file.
+	const byte* data = (const byte*)face->stream->base;
+	const unsigned long data_size = face->stream->size;
+
+	unsigned long hash_size = data_size;
+	unsigned long file_checksum = 0;
+	if (const TT_Header* head = (const TT_Header*)FT_Get_Sfnt_Table(face, FT_SFNT_HEAD))
+	{
+		hash_size = Math::Min(data_size, 4096ul);
+		file_checksum = (unsigned long)head->CheckSum_Adjust;
+	}
+
+	uint64_t hash = 0xcbf29ce484222325ull;
+	for (unsigned long i = 0; i < hash_size; i++)
+	{
+		hash ^= data[i];
+		hash *= 0x100000001b3ull;
+	}
+
+	return CreateString(96, "%016llx-%08lx-%lx-%lx-ft%d.%d.%d", (unsigned long long)hash, file_checksum, data_size, (unsigned long)face->face_index,
+		FREETYPE_MAJOR, FREETYPE_MINOR, FREETYPE_PATCH);
+}
+
+FontSizeHandleFreetype FreeType::CreateSize(FontFaceHandleFreetype face, int font_size, FontMetrics& metrics)
 {
 	FT_Face ft_face = (FT_Face)face;
+	RMLUI_ASSERT(ft_face);
 
-	metrics.size = font_size;
+	FT_Size ft_size = nullptr;
+	FT_Error error = FT_New_Size(ft_face, &ft_size);
+	if (error != 0)
+	{
+		Log::Message(Log::LT_ERROR, "FreeType error %d while creating size object for the font face '%s %s'.", error, ft_face->family_name,
+			ft_face->style_name);
+		return 0;
+	}
+
+	FT_Activate_Size(ft_size);
 
 	float bitmap_scaling_factor = 1.0f;
 	if (!SetFontSize(ft_face, font_size, bitmap_scaling_factor))
-		return false;
-
-	// Construct the initial list of glyphs.
-	BuildGlyphMap(ft_face, font_size, glyphs, bitmap_scaling_factor, load_default_glyphs);
+	{
+		FT_Done_Size(ft_size);
+		return 0;
+	}
 
 	// Generate the metrics for the handle.
+	metrics.size = font_size;
 	GenerateMetrics(ft_face, metrics, bitmap_scaling_factor);
 
-	return true;
+	return (FontSizeHandleFreetype) new FaceSizeFreetype{ft_size, bitmap_scaling_factor};
+}
+
+void FreeType::ReleaseSize(FontSizeHandleFreetype size)
+{
+	FaceSizeFreetype* face_size = (FaceSizeFreetype*)size;
+	if (!face_size)
+		return;
+
+#ifdef RMLUI_ENABLE_HARFBUZZ
+	if (face_size->hb_font)
+		hb_font_destroy(face_size->hb_font);
+#endif
+
+	FT_Done_Size(face_size->ft_size);
+	delete face_size;
 }
 
-bool FreeType::AppendGlyph(FontFaceHandleFreetype face, int font_size, Character character, FontGlyphMap& glyphs)
+uint32_t FreeType::GetGlyphIndex(FontFaceHandleFreetype face, Character character)
 {
 	FT_Face ft_face = (FT_Face)face;
+	return (uint32_t)FT_Get_Char_Index(ft_face, (FT_ULong)character);
+}
 
-	RMLUI_ASSERT(glyphs.find(character) == glyphs.end());
-	RMLUI_ASSERT(ft_face);
+void FreeType::GetCharacterRanges(FontFaceHandleFreetype face, Vector<CharacterRange>& out_ranges)
+{
+	FT_Face ft_face = (FT_Face)face;
+	out_ranges.clear();
 
-	// Set face size again in case it was used at another size in another font face handle.
-	float bitmap_scaling_factor = 1.0f;
-	if (!SetFontSize(ft_face, font_size, bitmap_scaling_factor))
-		return false;
+	// Character codes are visited in increasing order, merge consecutive codes into ranges.
+	FT_UInt ft_glyph_index = 0;
+	FT_ULong code = FT_Get_First_Char(ft_face, &ft_glyph_index);
+	while (ft_glyph_index != 0)
+	{
+		const char32_t character = (char32_t)code;
+		if (!out_ranges.empty() && out_ranges.back().last + 1 == character)
+			out_ranges.back().last = character;
+		else
+			out_ranges.push_back(CharacterRange{character, character});
 
-	if (!BuildGlyph(ft_face, character, glyphs, bitmap_scaling_factor))
-		return false;
+		code = FT_Get_Next_Char(ft_face, code, &ft_glyph_index);
+	}
+}
 
-	return true;
+bool FreeType::BuildGlyph(FontSizeHandleFreetype size, uint32_t glyph_index, Character character, FontGlyph& glyph, bool render_outlines)
+{
+	const FaceSizeFreetype* face_size = (const FaceSizeFreetype*)size;
+	RMLUI_ASSERT(face_size && glyph_index != 0);
+
+	// Activating the size is cheap, and restores the scaling of this size in case the face was used with another size in the meantime.
+	FT_Activate_Size(face_size->ft_size);
+
+	return LoadGlyph(face_size->ft_size->face, (FT_UInt)glyph_index, character, glyph, face_size->bitmap_scaling_factor, render_outlines);
 }
 
-int FreeType::GetKerning(FontFaceHandleFreetype face, int font_size, Character lhs, Character rhs)
+void FreeType::BuildReplacementGlyph(int font_size, FontGlyph& glyph)
 {
-	FT_Face ft_face = (FT_Face)face;
+	glyph.dimensions = {font_size / 3, (font_size * 2) / 3};
+	glyph.bitmap_dimensions = glyph.dimensions;
+	glyph.advance = glyph.dimensions.x + 2;
+	glyph.bearing = {1, glyph.dimensions.y};
 
-	RMLUI_ASSERT(FT_HAS_KERNING(ft_face));
+	glyph.bitmap_owned_data.reset(new byte[glyph.bitmap_dimensions.x * glyph.bitmap_dimensions.y]);
+	glyph.bitmap_data = glyph.bitmap_owned_data.get();
 
-	// Set face size again in case it was used at another size in another font face handle.
-	// Font size value of zero assumes it is already set.
-	if (font_size > 0)
+	for (int y = 0; y < glyph.bitmap_dimensions.y; y++)
 	{
-		float bitmap_scaling_factor = 1.0f;
-		if (!SetFontSize(ft_face, font_size, bitmap_scaling_factor) || bitmap_scaling_factor != 1.0f)
-			return 0;
+		for (int x = 0; x < glyph.bitmap_dimensions.x; x++)
+		{
+			constexpr int stroke = 1;
+			int i = y * glyph.bitmap_dimensions.x + x;
+			bool near_edge = (x < stroke || x >= glyph.bitmap_dimensions.x - stroke || y < stroke || y >= glyph.bitmap_dimensions.y - stroke);
+			glyph.bitmap_owned_data[i] = (near_edge ? 0xdd : 0);
+		}
 	}
+}
+
+int FreeType::GetKerning(FontSizeHandleFreetype size, uint32_t lhs_glyph_index, uint32_t rhs_glyph_index)
+{
+	const FaceSizeFreetype* face_size = (const FaceSizeFreetype*)size;
+	FT_Face ft_face = face_size->ft_size->face;
+
+	RMLUI_ASSERT(FT_HAS_KERNING(ft_face));
+
+	// Kerning is not scaled for downscaled bitmap fonts, skip it in this case.
+	if (face_size->bitmap_scaling_factor != 1.0f)
+		return 0;
+
+	FT_Activate_Size(face_size->ft_size);
 
 	FT_Vector ft_kerning;
 
-	FT_Error ft_error = FT_Get_Kerning(ft_face, FT_Get_Char_Index(ft_face, (FT_ULong)lhs), FT_Get_Char_Index(ft_face, (FT_ULong)rhs),
-		FT_KERNING_DEFAULT, &ft_kerning);
+	FT_Error ft_error = FT_Get_Kerning(ft_face, (FT_UInt)lhs_glyph_index, (FT_UInt)rhs_glyph_index, FT_KERNING_DEFAULT, &ft_kerning);
 
 	if (ft_error)
 		return 0;
@@ -251,62 +375,87 @@ int FreeType::GetKerning(FontFaceHandleFreetype face, int font_size, Character l
 	return kerning;
 }
 
-bool FreeType::HasKerning(FontFaceHandleFreetype face)
+bool FreeType::HasShaper()
 {
-	FT_Face ft_face = (FT_Face)face;
-
-	return FT_HAS_KERNING(ft_face);
+#ifdef RMLUI_ENABLE_HARFBUZZ
+	return true;
+#else
+	return false;
+#endif
 }
 
-static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs, const float bitmap_scaling_factor, const bool load_default_glyphs)
+bool FreeType::ShapeString(FontSizeHandleFreetype size, const String& string, Character prior_character, Vector<ShapedGlyph>& out_glyphs)
 {
-	if (load_default_glyphs)
-	{
-		glyphs.reserve(128);
+	out_glyphs.clear();
 
-		// Add the ASCII characters now. Other characters are added later as needed.
-		FT_ULong code_min = 32;
-		FT_ULong code_max = 126;
+#ifdef RMLUI_ENABLE_HARFBUZZ
+	FaceSizeFreetype* face_size = (FaceSizeFreetype*)size;
+	FT_Face ft_face = face_size->ft_size->face;
 
-		for (FT_ULong character_code = code_min; character_code <= code_max; ++character_code)
-			BuildGlyph(ft_face, (Character)character_code, glyphs, bitmap_scaling_factor);
+	// HarfBuzz loads glyphs through the face, thus at its active size.
+	FT_Activate_Size(face_size->ft_size);
+
+	if (!face_size->hb_font)
+	{
+		face_size->hb_font = hb_ft_font_create_referenced(ft_face);
+		// Use the same hinted metrics as our rendered glyphs.
+		hb_ft_font_set_load_flags(face_size->hb_font, FT_LOAD_DEFAULT);
 	}
 
-	// Add a replacement character for rendering unknown characters.
-	Character replacement_character = Character::Replacement;
-	auto it = glyphs.find(replacement_character);
-	if (it == glyphs.end())
+	if (!hb_buffer)
+		hb_buffer = hb_buffer_create();
+
+	hb_buffer_clear_contents(hb_buffer);
+
+	// The prior character is only added as context, it may affect the shape of the first characters such as in joining scripts.
+	if (prior_character != Character::Null)
 	{
-		FontGlyph glyph;
-		glyph.dimensions = {size / 3, (size * 2) / 3};
-		glyph.bitmap_dimensions = glyph.dimensions;
-		glyph.advance = glyph.dimensions.x + 2;
-		glyph.bearing = {1, glyph.dimensions.y};
+		const uint32_t context = (uint32_t)prior_character;
+		hb_buffer_add_utf32(hb_buffer, &context, 1, 1, 0);
+	}
 
-		glyph.bitmap_owned_data.reset(new byte[glyph.bitmap_dimensions.x * glyph.bitmap_dimensions.y]);
-		glyph.bitmap_data = glyph.bitmap_owned_data.get();
+	hb_buffer_add_utf8(hb_buffer, string.data(), (int)string.size(), 0, (int)string.size());
+	hb_buffer_guess_segment_properties(hb_buffer);
+	hb_shape(face_size->hb_font, hb_buffer, nullptr, 0);
 
-		for (int y = 0; y < glyph.bitmap_dimensions.y; y++)
-		{
-			for (int x = 0; x < glyph.bitmap_dimensions.x; x++)
-			{
-				constexpr int stroke = 1;
-				int i = y * glyph.bitmap_dimensions.x + x;
-				bool near_edge = (x < stroke || x >= glyph.bitmap_dimensions.x - stroke || y < stroke || y >= glyph.bitmap_dimensions.y - stroke);
-				glyph.bitmap_owned_data[i] = (near_edge ? 0xdd : 0);
-			}
-		}
+	unsigned int num_glyphs = 0;
+	const hb_glyph_info_t* glyph_infos = hb_buffer_get_glyph_infos(hb_buffer, &num_glyphs);
+	const hb_glyph_position_t* glyph_positions = hb_buffer_get_glyph_positions(hb_buffer, &num_glyphs);
 
-		glyphs[replacement_character] = std::move(glyph);
+	// Positions are given in 26.6 fixed-point, and need to be scaled for bitmap fonts rendered at another size than requested.
+	const float scale = face_size->bitmap_scaling_factor / 64.f;
+
+	out_glyphs.reserve(num_glyphs);
+	for (unsigned int i = 0; i < num_glyphs; i++)
+	{
+		ShapedGlyph glyph;
+		glyph.glyph_index = glyph_infos[i].codepoint;
+		glyph.cluster = glyph_infos[i].cluster;
+		glyph.advance = Math::RoundToInteger(float(glyph_positions[i].x_advance) * scale);
+		glyph.offset.x = Math::RoundToInteger(float(glyph_positions[i].x_offset) * scale);
+		glyph.offset.y = -Math::RoundToInteger(float(glyph_positions[i].y_offset) * scale);
+		out_glyphs.push_back(glyph);
 	}
+
+	return true;
+#else
+	(void)size;
+	(void)string;
+	(void)prior_character;
+	return false;
+#endif
 }
 
-static bool BuildGlyph(FT_Face ft_face, const Character character, FontGlyphMap& glyphs, const float bitmap_scaling_factor)
+bool FreeType::HasKerning(FontFaceHandleFreetype face)
 {
-	FT_UInt index = FT_Get_Char_Index(ft_face, (FT_ULong)character);
-	if (index == 0)
-		return false;
+	FT_Face ft_face = (FT_Face)face;
+
+	return FT_HAS_KERNING(ft_face);
+}
 
+static bool LoadGlyph(FT_Face ft_face, const FT_UInt index, const Character character, FontGlyph& glyph, const float bitmap_scaling_factor,
+	const bool render_outlines)
+{
 	FT_Error error = FT_Load_Glyph(ft_face, index, FT_LOAD_COLOR);
 	if (error != 0)
 	{
@@ -315,24 +464,19 @@ static bool BuildGlyph(FT_Face ft_face, const Character character, FontGlyphMap&
 		return false;
 	}
 
-	error = FT_Render_Glyph(ft_face->glyph, FT_RENDER_MODE_NORMAL);
-	if (error != 0)
-	{
-		Log::Message(Log::LT_WARNING, "Unable to render glyph for character '%u' on the font face '%s %s'; error code: %d.", (unsigned int)character,
-			ft_face->family_name, ft_face->style_name, error);
-		return false;
-	}
-
-	auto result = glyphs.emplace(character, FontGlyph{});
-	if (!result.second)
+	const bool render = (render_outlines || ft_face->glyph->format != FT_GLYPH_FORMAT_OUTLINE);
+	if (render)
 	{
-		Log::Message(Log::LT_WARNING, "Glyph character '%u' is already loaded in the font face '%s %s'.", (unsigned int)character,
-			ft_face->family_name, ft_face->style_name);
-		return false;
+		error = FT_Render_Glyph(ft_face->glyph, FT_RENDER_MODE_NORMAL);
+		if (error != 0)
+		{
+			Log::Message(Log::LT_WARNING, "Unable to render glyph for character '%u' on the font face '%s %s'; error code: %d.",
+				(unsigned int)character, ft_face->family_name, ft_face->style_name, error);
+			return false;
+		}
+		FrameStatisticsCollector::Count(&FrameStatistics::glyphs_rasterized);
 	}
 
-	FontGlyph& glyph = result.first->second;
-
 	FT_GlyphSlot ft_glyph = ft_face->glyph;
 
 	// Set the glyph's dimensions.
@@ -346,6 +490,9 @@ static bool BuildGlyph(FT_Face ft_face, const Character character, FontGlyphMap&
 	// Set the glyph's advance.
 	glyph.advance = ft_glyph->metrics.horiAdvance >> 6;
 
+	if (!render)
+		return true;
+
 	// Set the glyph's bitmap dimensions.
 	glyph.bitmap_dimensions.x = ft_glyph->bitmap.width;
 	glyph.bitmap_dimensions.y = ft_glyph->bitmap.rows;
@@ -53,15 +53,38 @@ namespace FreeType {
 	// Retrieves the font family, style and weight of the given font face. Use nullptr to ignore a property.
 	void GetFaceStyle(FontFaceHandleFreetype face, String* font_family, Style::FontStyle* style, Style::FontWeight* weight);
 
-	// Initializes a face for a given font size. Glyphs are filled with the ASCII subset, and the font face metrics are set.
-	bool InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, FontGlyphMap& glyphs, FontMetrics& metrics, bool load_default_glyphs);
+	// Returns a key identifying the face's font data, instance, and FreeType version, which remains stable between runs for use in persistent caches.
+	String GetFaceCacheKey(FontFaceHandleFreetype face);
 
-	// Build a new glyph representing the given code point and append to 'glyphs'.
-	bool AppendGlyph(FontFaceHandleFreetype face, int font_size, Character character, FontGlyphMap& glyphs);
+	// Creates a size object for the face at the given font size, and sets the font face metrics. Each size object keeps its own scaling state, so
+	// that several sizes of the same face can be used without resetting the character size on the face between calls.
+	FontSizeHandleFreetype CreateSize(FontFaceHandleFreetype face, int font_size, FontMetrics& metrics);
 
-	// Returns the kerning between two characters.
-	// 'font_size' value of zero assumes the font size is already set on the face, and skips this step for performance reasons.
-	int GetKerning(FontFaceHandleFreetype face, int font_size, Character lhs, Character rhs);
+	// Releases the size object, must be called before its face is released.
+	void ReleaseSize(FontSizeHandleFreetype size);
+
+	// Returns the index of the glyph representing the given code point in the face, or zero if the face has no such glyph.
+	uint32_t GetGlyphIndex(FontFaceHandleFreetype face, Character character);
+
+	// Retrieves the characters available in the face, as sorted and non-overlapping ranges.
+	void GetCharacterRanges(FontFaceHandleFreetype face, Vector<CharacterRange>& out_ranges);
+
+	// Builds the glyph with the given index at the size. The character is only used for logging. Without 'render_outlines', outline glyphs are
+	// loaded without rasterizing them, leaving only their metrics and no bitmap.
+	bool BuildGlyph(FontSizeHandleFreetype size, uint32_t glyph_index, Character character, FontGlyph& glyph, bool render_outlines = true);
+
+	// Builds the glyph used in place of characters not available in the font face.
+	void BuildReplacementGlyph(int font_size, FontGlyph& glyph);
+
+	// Returns the kerning between two glyphs at the given size.
+	int GetKerning(FontSizeHandleFreetype size, uint32_t lhs_glyph_index, uint32_t rhs_glyph_index);
+
+	// Returns true if the library was built with a text shaper, see the CMake option 'ENABLE_HARFBUZZ'.
+	bool HasShaper();
+
+	// Shapes the string into positioned glyphs of the face at the given size, using the prior character as context. Glyph index zero is returned
+	// for characters not available in the face. Returns false if the library was built without a text shaper.
+	bool ShapeString(FontSizeHandleFreetype size, const String& string, Character prior_character, Vector<ShapedGlyph>& out_glyphs);
 
 	// Returns true if the font face has kerning.
 	bool HasKerning(FontFaceHandleFreetype face);
@@ -0,0 +1,134 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "FrameStatisticsCollector.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "Layout/ParallelLayout.h"
+
+namespace Rml {
+namespace FrameStatisticsCollector {
+
+	static FrameStatistics* active_statistics = nullptr;
+	static ElementRecorder* active_recorder = nullptr;
+	static Element* active_render_element = nullptr;
+
+	FrameStatistics* GetActive()
+	{
+		return active_statistics;
+	}
+
+	ElementFrameStatistics& ElementRecorder::Get(Element* element)
+	{
+		auto it = element_indices.find(element);
+		if (it != element_indices.end())
+		{
+			ElementFrameStatistics& entry = elements[it->second];
+			// The address may have been reused by a new element after the recorded one was destroyed.
+			if (entry.element.get() == element)
+				return entry;
+			entry = ElementFrameStatistics{};
+			entry.element = element->GetObserverPtr();
+			return entry;
+		}
+
+		element_indices.emplace(element, (int)elements.size());
+		elements.emplace_back();
+		elements.back().element = element->GetObserverPtr();
+		return elements.back();
+	}
+
+	ElementFrameStatisticsList ElementRecorder::Take()
+	{
+		element_indices.clear();
+		ElementFrameStatisticsList result = std::move(elements);
+		elements.clear();
+		return result;
+	}
+
+	Scope::Scope(FrameStatistics* statistics, ElementRecorder* recorder) : previous(active_statistics), previous_recorder(active_recorder)
+	{
+		active_statistics = statistics;
+		active_recorder = recorder;
+	}
+
+	Scope::~Scope()
+	{
+		active_statistics = previous;
+		active_recorder = previous_recorder;
+	}
+
+	void RecordElement(Element* element, bool ElementFrameStatistics::*flag)
+	{
+		if (active_recorder)
+		{
+			// Elements are recorded from parallel layout tasks when their box is set.
+			ParallelLayout::SerialLock lock;
+			active_recorder->Get(element).*flag = true;
+		}
+	}
+
+	void CountVertices(int num_vertices)
+	{
+		if (!active_statistics)
+			return;
+		active_statistics->vertices_rendered += num_vertices;
+		if (active_recorder && active_render_element)
+			active_recorder->Get(active_render_element).vertices_rendered += num_vertices;
+	}
+
+	RenderElementScope::RenderElementScope(Element* element) : previous(active_render_element)
+	{
+		active_render_element = element;
+	}
+
+	RenderElementScope::~RenderElementScope()
+	{
+		active_render_element = previous;
+	}
+
+	Timer::Timer(double FrameStatistics::*duration) : statistics(active_statistics), duration(duration)
+	{
+		if (statistics)
+			start = Clock::now();
+	}
+
+	Timer::~Timer()
+	{
+		if (statistics)
+			statistics->*duration += GetElapsed();
+	}
+
+	double Timer::GetElapsed() const
+	{
+		if (!statistics)
+			return 0.0;
+		return std::chrono::duration<double>(Clock::now() - start).count();
+	}
+
+} // namespace FrameStatisticsCollector
+} // namespace Rml
@@ -0,0 +1,117 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FRAMESTATISTICSCOLLECTOR_H
+#define RMLUI_CORE_FRAMESTATISTICSCOLLECTOR_H
+
+#include "../../Include/RmlUi/Core/FrameStatistics.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+#include <chrono>
+
+namespace Rml {
+
+/**
+    Collects frame statistics into the context currently being updated or rendered.
+
+    Statistics are only collected while a scope is active, any work done outside of Context::Update() and
+    Context::Render() is not accounted for.
+ */
+
+namespace FrameStatisticsCollector {
+
+	// Returns the statistics of the frame currently being collected, or nullptr if no collection scope is active.
+	FrameStatistics* GetActive();
+
+	// Increments the given counter of the active frame statistics, if any.
+	inline void Count(int FrameStatistics::*counter, int count = 1)
+	{
+		if (FrameStatistics* statistics = GetActive())
+			statistics->*counter += count;
+	}
+
+	// Records the per-element statistics of a frame.
+	class ElementRecorder : NonCopyMoveable {
+	public:
+		// Returns the statistics entry of the given element, adding a new entry if none exists.
+		ElementFrameStatistics& Get(Element* element);
+		// Moves the recorded statistics out of the recorder, leaving it empty for the next frame.
+		ElementFrameStatisticsList Take();
+
+	private:
+		ElementFrameStatisticsList elements;
+		UnorderedMap<Element*, int> element_indices;
+	};
+
+	// Directs all collected statistics to the given frame statistics and optional element recorder while in scope.
+	class Scope : NonCopyMoveable {
+	public:
+		explicit Scope(FrameStatistics* statistics, ElementRecorder* recorder = nullptr);
+		~Scope();
+
+	private:
+		FrameStatistics* previous;
+		ElementRecorder* previous_recorder;
+	};
+
+	// Sets the given flag in the statistics of the element, if element statistics are being recorded.
+	void RecordElement(Element* element, bool ElementFrameStatistics::*flag);
+
+	// Adds rendered vertices to the active frame statistics, and to the element currently being rendered if element
+	// statistics are being recorded.
+	void CountVertices(int num_vertices);
+
+	// Attributes all vertices rendered while in scope to the given element.
+	class RenderElementScope : NonCopyMoveable {
+	public:
+		explicit RenderElementScope(Element* element);
+		~RenderElementScope();
+
+	private:
+		Element* previous;
+	};
+
+	// Adds the time spent while in scope to the given duration of the active frame statistics, if any.
+	class Timer : NonCopyMoveable {
+	public:
+		explicit Timer(double FrameStatistics::*duration);
+		~Timer();
+
+		// Returns the time elapsed since the timer started, in seconds.
+		double GetElapsed() const;
+
+	private:
+		using Clock = std::chrono::steady_clock;
+
+		FrameStatistics* statistics;
+		double FrameStatistics::*duration;
+		Clock::time_point start;
+	};
+
+} // namespace FrameStatisticsCollector
+} // namespace Rml
+#endif
@@ -32,7 +32,9 @@
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "FrameStatisticsCollector.h"
 #include "GeometryDatabase.h"
+#include "TextBatcher.h"
 #include <utility>
 
 namespace Rml {
@@ -84,6 +86,12 @@ void Geometry::Render(Vector2f translation)
 	if (compiled_geometry)
 	{
 		RMLUI_ZoneScopedN("RenderCompiled");
+
+		// Any batched text submitted before us must be rendered first.
+		TextBatcher::Flush();
+
+		FrameStatisticsCollector::Count(&FrameStatistics::draw_calls);
+		FrameStatisticsCollector::CountVertices((int)vertices.size());
 		render_interface->RenderCompiledGeometry(compiled_geometry, translation);
 	}
 	// Otherwise, if we actually have geometry, try to compile it if we haven't already done so, otherwise render it in
@@ -95,6 +103,8 @@ void Geometry::Render(Vector2f translation)
 
 		RMLUI_ZoneScopedN("RenderGeometry");
 
+		TextBatcher::Flush();
+
 		if (!compile_attempted)
 		{
 			compile_attempted = true;
@@ -105,6 +115,9 @@ void Geometry::Render(Vector2f translation)
 			// immediately render the compiled version.
 			if (compiled_geometry)
 			{
+				FrameStatisticsCollector::Count(&FrameStatistics::geometry_compiled);
+				FrameStatisticsCollector::Count(&FrameStatistics::draw_calls);
+				FrameStatisticsCollector::CountVertices((int)vertices.size());
 				render_interface->RenderCompiledGeometry(compiled_geometry, translation);
 				return;
 			}
@@ -112,6 +125,8 @@ void Geometry::Render(Vector2f translation)
 
 		// Either we've attempted to compile before (and failed), or the compile we just attempted failed; either way,
 		// render the uncompiled version.
+		FrameStatisticsCollector::Count(&FrameStatistics::draw_calls);
+		FrameStatisticsCollector::CountVertices((int)vertices.size());
 		render_interface->RenderGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), texture ? texture->GetHandle() : 0,
 			translation);
 	}
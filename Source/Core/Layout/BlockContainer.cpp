@@ -472,7 +472,8 @@ InlineContainer* BlockContainer::EnsureOpenInlineContainer()
 	// Otherwise, we open a new one.
 	if (!inline_container)
 	{
-		const float scrollbar_width = (IsScrollContainer() ? element->GetElementScroll()->GetScrollbarSize(ElementScroll::VERTICAL) : 0.f);
+		ElementScroll* element_scroll = (IsScrollContainer() ? element->FindElementScroll() : nullptr);
+		const float scrollbar_width = (element_scroll ? element_scroll->GetScrollbarSize(ElementScroll::VERTICAL) : 0.f);
 		const float available_width = box.GetSize().x - scrollbar_width;
 
 		auto inline_container_ptr = MakeUnique<InlineContainer>(this, available_width);
@@ -33,6 +33,7 @@
 #include "../../../Include/RmlUi/Core/Profiling.h"
 #include "FormattingContext.h"
 #include "LayoutDetails.h"
+#include "ParallelLayout.h"
 #include <algorithm>
 #include <cmath>
 
@@ -43,13 +44,13 @@ void ContainerBox::ResetScrollbars(const Box& box)
 	RMLUI_ASSERT(element);
 	if (overflow_x == Style::Overflow::Scroll)
 		element->GetElementScroll()->EnableScrollbar(ElementScroll::HORIZONTAL, box.GetSizeAcross(BoxDirection::Horizontal, BoxArea::Padding));
-	else
-		element->GetElementScroll()->DisableScrollbar(ElementScroll::HORIZONTAL);
+	else if (ElementScroll* element_scroll = element->FindElementScroll())
+		element_scroll->DisableScrollbar(ElementScroll::HORIZONTAL);
 
 	if (overflow_y == Style::Overflow::Scroll)
 		element->GetElementScroll()->EnableScrollbar(ElementScroll::VERTICAL, box.GetSizeAcross(BoxDirection::Horizontal, BoxArea::Padding));
-	else
-		element->GetElementScroll()->DisableScrollbar(ElementScroll::VERTICAL);
+	else if (ElementScroll* element_scroll = element->FindElementScroll())
+		element_scroll->DisableScrollbar(ElementScroll::VERTICAL);
 }
 
 void ContainerBox::AddAbsoluteElement(Element* element, Vector2f static_position, Element* static_relative_offset_parent)
@@ -82,8 +83,22 @@ void ContainerBox::ClosePositionedElements()
 		AbsoluteElementMap absolute_elements_iterate = std::move(absolute_elements);
 		absolute_elements.clear();
 
+		// The absolute elements are sized independently of each other, so they can be laid out in parallel before being positioned below.
+		Vector<ParallelLayout::IndependentBox> independent_boxes;
+		if (ParallelLayout::IsAvailable())
+		{
+			independent_boxes.reserve(absolute_elements_iterate.size());
+			for (const auto& absolute_element_pair : absolute_elements_iterate)
+				independent_boxes.push_back(ParallelLayout::IndependentBox{absolute_element_pair.first, nullptr, nullptr});
+			ParallelLayout::FormatIndependent(this, independent_boxes);
+		}
+
+		size_t element_index = 0;
 		for (const auto& absolute_element_pair : absolute_elements_iterate)
 		{
+			const bool is_formatted = (element_index < independent_boxes.size() && independent_boxes[element_index].layout_box);
+			element_index += 1;
+
 			Element* absolute_element = absolute_element_pair.first;
 			const Vector2f static_position = absolute_element_pair.second.static_position;
 			Element* static_position_offset_parent = absolute_element_pair.second.static_position_offset_parent;
@@ -98,8 +113,9 @@ void ContainerBox::ClosePositionedElements()
 			// Now simply add the result to the stored static position to get the static position in our local space.
 			Vector2f offset = relative_position + static_position;
 
-			// Lay out the element.
-			FormattingContext::FormatIndependent(this, absolute_element, nullptr, FormattingContextType::Block);
+			// Lay out the element, unless it has already been laid out in parallel above.
+			if (!is_formatted)
+				FormattingContext::FormatIndependent(this, absolute_element, nullptr, FormattingContextType::Block);
 
 			// Now that the element's box has been built, we can offset the position we determined was appropriate for
 			// it by the element's margin. This is necessary because the coordinate system for the box begins at the
@@ -120,7 +136,7 @@ void ContainerBox::SetElementBaseline(float element_baseline)
 
 void ContainerBox::SubmitElementLayout()
 {
-	element->OnLayout();
+	ParallelLayout::CallElement(element, &Element::OnLayout);
 }
 
 ContainerBox::ContainerBox(Type type, Element* element, ContainerBox* parent_container) :
@@ -155,13 +171,13 @@ bool ContainerBox::CatchOverflow(const Vector2f content_overflow_size, const Box
 	// Allow overflow onto the padding area.
 	available_space += padding_bottom_right;
 
-	ElementScroll* element_scroll = element->GetElementScroll();
 	bool scrollbar_size_changed = false;
 
 	// @performance If we have auto-height sizing and the horizontal scrollbar is enabled, then we can in principle
 	// simply add the scrollbar size to the height instead of formatting the element all over again.
 	if (overflow_x == Style::Overflow::Auto && content_overflow_size.x > available_space.x + 0.5f)
 	{
+		ElementScroll* element_scroll = element->GetElementScroll();
 		if (element_scroll->GetScrollbarSize(ElementScroll::HORIZONTAL) == 0.f)
 		{
 			element_scroll->EnableScrollbar(ElementScroll::HORIZONTAL, padding_width);
@@ -174,6 +190,7 @@ bool ContainerBox::CatchOverflow(const Vector2f content_overflow_size, const Box
 	// If we're auto-scrolling and our height is fixed, we have to check if this box has exceeded our client height.
 	if (overflow_y == Style::Overflow::Auto && content_overflow_size.y > available_space.y + 0.5f)
 	{
+		ElementScroll* element_scroll = element->GetElementScroll();
 		if (element_scroll->GetScrollbarSize(ElementScroll::VERTICAL) == 0.f)
 		{
 			element_scroll->EnableScrollbar(ElementScroll::VERTICAL, padding_width);
@@ -210,9 +227,10 @@ bool ContainerBox::SubmitBox(const Vector2f content_overflow_size, const Box& bo
 		const Vector2f padding_size = box.GetSize() + padding_top_left + padding_bottom_right;
 
 		const bool is_scroll_container = IsScrollContainer();
+		ElementScroll* element_scroll = (is_scroll_container ? element->FindElementScroll() : nullptr);
 		const Vector2f scrollbar_size = {
-			is_scroll_container ? element->GetElementScroll()->GetScrollbarSize(ElementScroll::VERTICAL) : 0.f,
-			is_scroll_container ? element->GetElementScroll()->GetScrollbarSize(ElementScroll::HORIZONTAL) : 0.f,
+			element_scroll ? element_scroll->GetScrollbarSize(ElementScroll::VERTICAL) : 0.f,
+			element_scroll ? element_scroll->GetScrollbarSize(ElementScroll::HORIZONTAL) : 0.f,
 		};
 
 		// Scrollable overflow is the set of things extending our padding area, for which scrolling could be provided.
@@ -231,7 +249,8 @@ bool ContainerBox::SubmitBox(const Vector2f content_overflow_size, const Box& bo
 			visible_overflow_size = border_size;
 
 			// Format any scrollbars in case they were enabled on this element.
-			element->GetElementScroll()->FormatScrollbars();
+			if (element_scroll)
+				element_scroll->FormatScrollbars();
 		}
 		else
 		{
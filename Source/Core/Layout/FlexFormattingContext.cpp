@@ -34,6 +34,7 @@
 #include "ContainerBox.h"
 #include "LayoutDetails.h"
 #include "LayoutEngine.h"
+#include "ParallelLayout.h"
 #include <algorithm>
 #include <float.h>
 #include <numeric>
@@ -44,7 +45,6 @@ UniquePtr<LayoutBox> FlexFormattingContext::Format(ContainerBox* parent_containe
 {
 	auto flex_container_box = MakeUnique<FlexContainer>(element, parent_container);
 
-	ElementScroll* element_scroll = element->GetElementScroll();
 	const ComputedValues& computed = element->GetComputedValues();
 
 	const Vector2f containing_block = LayoutDetails::GetContainingBlock(parent_container, element->GetPosition()).size;
@@ -75,9 +75,10 @@ UniquePtr<LayoutBox> FlexFormattingContext::Format(ContainerBox* parent_containe
 	for (int layout_iteration = 0; layout_iteration < 3; layout_iteration++)
 	{
 		// One or both scrollbars can be enabled between iterations.
+		ElementScroll* element_scroll = element->FindElementScroll();
 		const Vector2f scrollbar_size = {
-			element_scroll->GetScrollbarSize(ElementScroll::VERTICAL),
-			element_scroll->GetScrollbarSize(ElementScroll::HORIZONTAL),
+			element_scroll ? element_scroll->GetScrollbarSize(ElementScroll::VERTICAL) : 0.f,
+			element_scroll ? element_scroll->GetScrollbarSize(ElementScroll::HORIZONTAL) : 0.f,
 		};
 
 		context.flex_available_content_size = Math::Max(box_content_size - scrollbar_size, Vector2f(0.f));
@@ -315,8 +316,7 @@ void FlexFormattingContext::Format(Vector2f& flex_resulting_content_size, Vector
 			if (initial_box_size.x < 0.f)
 				format_box.SetContent(Vector2f(flex_available_content_size.x - item.cross.sum_edges, initial_box_size.y));
 
-			FormattingContext::FormatIndependent(flex_container_box, element, &format_box, FormattingContextType::Block);
-			item.inner_flex_base_size = element->GetBox().GetSize().y;
+			item.inner_flex_base_size = LayoutDetails::GetContentHeightForWidth(flex_container_box, element, format_box);
 		}
 
 		// Calculate the hypothetical main size (clamped flex base size).
@@ -597,8 +597,8 @@ void FlexFormattingContext::Format(Vector2f& flex_resulting_content_size, Vector
 				if (content_size.y < 0.0f)
 				{
 					item.box.SetContent(Vector2f(used_main_size_inner, content_size.y));
-					FormattingContext::FormatIndependent(flex_container_box, item.element, &item.box, FormattingContextType::Block);
-					item.hypothetical_cross_size = item.element->GetBox().GetSize().y + item.cross.sum_edges;
+					item.hypothetical_cross_size =
+						LayoutDetails::GetContentHeightForWidth(flex_container_box, item.element, item.box) + item.cross.sum_edges;
 				}
 				else
 				{
@@ -847,16 +847,37 @@ void FlexFormattingContext::Format(Vector2f& flex_resulting_content_size, Vector
 
 	// -- Format items --
 	for (FlexLine& line : container.lines)
+	{
+		for (FlexItem& item : line.items)
+			item.box.SetContent(MainCrossToVec2(item.used_main_size - item.main.sum_edges, item.used_cross_size - item.cross.sum_edges));
+	}
+
+	// The items are now sized and independent of each other, thus they can be formatted in parallel before being placed below.
+	Vector<ParallelLayout::IndependentBox> independent_boxes;
+	if (ParallelLayout::IsAvailable())
+	{
+		for (FlexLine& line : container.lines)
+		{
+			for (FlexItem& item : line.items)
+				independent_boxes.push_back(ParallelLayout::IndependentBox{item.element, &item.box, nullptr});
+		}
+		ParallelLayout::FormatIndependent(flex_container_box, independent_boxes);
+	}
+
+	size_t item_index = 0;
+	for (FlexLine& line : container.lines)
 	{
 		for (FlexItem& item : line.items)
 		{
-			const Vector2f item_size = MainCrossToVec2(item.used_main_size - item.main.sum_edges, item.used_cross_size - item.cross.sum_edges);
 			const Vector2f item_offset = MainCrossToVec2(item.main_offset, line.cross_offset + item.cross_offset);
 
-			item.box.SetContent(item_size);
+			UniquePtr<LayoutBox> item_layout_box;
+			if (item_index < independent_boxes.size())
+				item_layout_box = std::move(independent_boxes[item_index].layout_box);
+			item_index += 1;
 
-			UniquePtr<LayoutBox> item_layout_box =
-				FormattingContext::FormatIndependent(flex_container_box, item.element, &item.box, FormattingContextType::Block);
+			if (!item_layout_box)
+				item_layout_box = FormattingContext::FormatIndependent(flex_container_box, item.element, &item.box, FormattingContextType::Block);
 
 			// Set the position of the element within the the flex container
 			item.element->SetOffset(flex_content_offset + item_offset, element_flex);
@@ -33,6 +33,7 @@
 #include "../../../Include/RmlUi/Core/FontEngineInterface.h"
 #include "LayoutDetails.h"
 #include "LayoutPools.h"
+#include "ParallelLayout.h"
 
 namespace Rml {
 
@@ -50,13 +51,16 @@ InlineLevelBox::~InlineLevelBox() {}
 
 void InlineLevelBox::SubmitElementOnLayout()
 {
-	element->OnLayout();
+	ParallelLayout::CallElement(element, &Element::OnLayout);
 }
 
 const FontMetrics& InlineLevelBox::GetFontMetrics() const
 {
 	if (FontFaceHandle handle = element->GetFontFaceHandle())
+	{
+		ParallelLayout::SerialLock lock;
 		return GetFontEngineInterface()->GetFontMetrics(handle);
+	}
 
 	// If there is no font face defined then we provide zero'd out font metrics. This situation can affect the layout,
 	// in particular in terms of inline box sizing and vertical alignment. Thus, this is potentially a situation where
@@ -179,8 +183,13 @@ FragmentConstructor InlineLevelBox_Text::CreateFragment(InlineLayoutMode mode, f
 	int line_begin = in_overflow_handle;
 	int line_length = 0;
 	float line_width = 0.f;
-	bool overflow = !text_element->GenerateLine(line_contents, line_length, line_width, line_begin, available_width, right_spacing_width, first_box,
-		decode_escape_characters, allow_empty);
+	bool overflow;
+	{
+		// Text is measured through the font engine, which is not required to be thread-safe.
+		ParallelLayout::SerialLock lock;
+		overflow = !text_element->GenerateLine(line_contents, line_length, line_width, line_begin, available_width, right_spacing_width, first_box,
+			decode_escape_characters, allow_empty);
+	}
 
 	if (overflow && line_contents.empty())
 		// We couldn't fit anything on this line.
@@ -206,6 +215,8 @@ void InlineLevelBox_Text::Submit(const PlacedFragment& placed_fragment)
 	ElementText* text_element = GetTextElement();
 	Vector2f line_offset;
 
+	ParallelLayout::SerialLock lock;
+
 	if (principal_box)
 	{
 		element_offset = placed_fragment.position;
@@ -210,11 +210,13 @@ ContainingBlock LayoutDetails::GetContainingBlock(ContainerBox* parent_container
 		// make positioned boxes contribute to the scrollable area.
 		if (Element* element = container->GetElement())
 		{
-			ElementScroll* element_scroll = element->GetElementScroll();
-			if (containing_block.x >= 0.f)
-				containing_block.x = Math::Max(containing_block.x - element_scroll->GetScrollbarSize(ElementScroll::VERTICAL), 0.f);
-			if (containing_block.y >= 0.f)
-				containing_block.y = Math::Max(containing_block.y - element_scroll->GetScrollbarSize(ElementScroll::HORIZONTAL), 0.f);
+			if (ElementScroll* element_scroll = element->FindElementScroll())
+			{
+				if (containing_block.x >= 0.f)
+					containing_block.x = Math::Max(containing_block.x - element_scroll->GetScrollbarSize(ElementScroll::VERTICAL), 0.f);
+				if (containing_block.y >= 0.f)
+					containing_block.y = Math::Max(containing_block.y - element_scroll->GetScrollbarSize(ElementScroll::HORIZONTAL), 0.f);
+			}
 		}
 	}
 
@@ -261,10 +263,27 @@ float LayoutDetails::GetShrinkToFitWidth(Element* element, Vector2f containing_b
 		display == Style::Display::InlineTable)
 		return 0.f;
 
+	const float available_width = Math::Max(0.f, containing_block.x - box.GetSizeAcross(BoxDirection::Horizontal, BoxArea::Margin, BoxArea::Padding));
+
+	return Math::Min(available_width, GetMaxContentWidth(element, box, containing_block));
+}
+
+float LayoutDetails::GetMaxContentWidth(Element* element, Box box, Vector2f containing_block)
+{
 	// Use a large size for the box content width, so that it is practically unconstrained. This makes the formatting
 	// procedure act as if under a maximum content constraint. Children with percentage sizing values may be scaled
 	// based on this width (such as 'width' or 'margin'), if so, the layout is considered undefined like in CSS 2.
 	const float max_content_constraint_width = containing_block.x + 1000.f;
+
+	// The max-content width is cached until the layout of the element or any of its descendants is dirtied. Nested shrink-to-fit boxes are
+	// measured by each of their ancestors' measurements, reusing the cached width avoids formatting them over and over again.
+	if (element->max_content_width_valid &&
+		(containing_block == element->max_content_containing_block ||
+			(element->max_content_width_independent && element->max_content_width < max_content_constraint_width)))
+	{
+		return element->max_content_width;
+	}
+
 	box.SetContent({max_content_constraint_width, box.GetSize().y});
 
 	// First, format the element under the above generated box. Then we ask the resulting box for its shrink-to-fit
@@ -274,9 +293,67 @@ float LayoutDetails::GetShrinkToFitWidth(Element* element, Vector2f containing_b
 	RootBox root(Math::Max(containing_block, Vector2f(0.f)));
 	UniquePtr<LayoutBox> layout_box = FormattingContext::FormatIndependent(&root, element, &box, FormattingContextType::Block);
 
-	const float available_width = Math::Max(0.f, containing_block.x - box.GetSizeAcross(BoxDirection::Horizontal, BoxArea::Margin, BoxArea::Padding));
+	const float max_content_width = layout_box->GetShrinkToFitWidth();
+
+	// When the content was not constrained by the formatting width above, the width only depends on the containing block through percentages.
+	// Without those we can reuse the width for any containing block, as long as the content stays within its constraint width.
+	element->max_content_width = max_content_width;
+	element->max_content_containing_block = containing_block;
+	element->max_content_width_independent = (max_content_width < max_content_constraint_width && !HasPercentageSizes(element));
+	element->max_content_width_valid = true;
+
+	return max_content_width;
+}
+
+float LayoutDetails::GetContentHeightForWidth(ContainerBox* parent_container, Element* element, const Box& box)
+{
+	RMLUI_ASSERT(box.GetSize().y < 0.f);
+
+	// With the width given, the resulting height only depends on the containing block height through the element's own percentage heights.
+	// Flex items are formatted like this to find their hypothetical size, caching the height avoids doing so for every format of the container.
+	const float width = box.GetSize().x;
+	const float containing_block_height = GetContainingBlock(parent_container, element->GetComputedValues().position()).size.y;
+
+	if (element->content_height_valid && width == element->content_height_width && containing_block_height == element->content_height_containing_block)
+		return element->content_height;
+
+	FormattingContext::FormatIndependent(parent_container, element, &box, FormattingContextType::Block);
+
+	element->content_height = element->GetBox().GetSize().y;
+	element->content_height_width = width;
+	element->content_height_containing_block = containing_block_height;
+	element->content_height_valid = true;
+
+	return element->content_height;
+}
+
+bool LayoutDetails::HasPercentageSizes(Element* element)
+{
+	using namespace Style;
+	const ComputedValues& computed = element->GetComputedValues();
+	if (computed.display() == Display::None)
+		return false;
+
+	if (computed.width().type == Width::Percentage || computed.min_width().type == MinWidth::Percentage ||
+		computed.max_width().type == MaxWidth::Percentage || computed.height().type == Height::Percentage ||
+		computed.min_height().type == MinHeight::Percentage || computed.max_height().type == MaxHeight::Percentage ||
+		computed.margin_top().type == Margin::Percentage || computed.margin_right().type == Margin::Percentage ||
+		computed.margin_bottom().type == Margin::Percentage || computed.margin_left().type == Margin::Percentage ||
+		computed.padding_top().type == Padding::Percentage || computed.padding_right().type == Padding::Percentage ||
+		computed.padding_bottom().type == Padding::Percentage || computed.padding_left().type == Padding::Percentage ||
+		computed.top().type == Top::Percentage || computed.right().type == Right::Percentage || computed.bottom().type == Bottom::Percentage ||
+		computed.left().type == Left::Percentage || computed.flex_basis().type == FlexBasis::Percentage ||
+		computed.row_gap().type == LengthPercentage::Percentage || computed.column_gap().type == LengthPercentage::Percentage)
+		return true;
+
+	const int num_children = element->GetNumChildren();
+	for (int i = 0; i < num_children; i++)
+	{
+		if (HasPercentageSizes(element->GetChild(i)))
+			return true;
+	}
 
-	return Math::Min(available_width, layout_box->GetShrinkToFitWidth());
+	return false;
 }
 
 ComputedAxisSize LayoutDetails::BuildComputedHorizontalSize(const ComputedValues& computed)
@@ -106,9 +106,13 @@ public:
 	static void BuildBoxSizeAndMargins(Box& box, Vector2f min_size, Vector2f max_size, Vector2f containing_block, Element* element,
 		BuildBoxMode box_context, bool replaced_element);
 
-	/// Formats the element and returns the width of its contents.
+	/// Returns the shrink-to-fit width of the element, formatting it if its max-content width is not already cached.
 	static float GetShrinkToFitWidth(Element* element, Vector2f containing_block);
 
+	/// Formats the element using the content width of the given box and returns its resulting content height, or returns the cached height if
+	/// valid. The height of the box is expected to be auto.
+	static float GetContentHeightForWidth(ContainerBox* parent_container, Element* element, const Box& box);
+
 	/// Build computed axis size along the horizontal direction (width and friends).
 	static ComputedAxisSize BuildComputedHorizontalSize(const ComputedValues& computed);
 	/// Build computed axis size along the vertical direction (height and friends).
@@ -120,6 +124,11 @@ public:
 	static String GetDebugElementName(Element* element);
 
 private:
+	/// Formats the element under a practically unconstrained width and returns the width of its contents, or returns the cached width if valid.
+	static float GetMaxContentWidth(Element* element, Box box, Vector2f containing_block);
+	/// Returns true if the element or any of its descendants have sizes, edges, or offsets relative to their containing block.
+	static bool HasPercentageSizes(Element* element);
+
 	/// Calculates and returns the content size for replaced elements.
 	static Vector2f CalculateSizeForReplacedElement(Vector2f specified_content_size, Vector2f min_size, Vector2f max_size, Vector2f intrinsic_size,
 		float intrinsic_ratio);
@@ -35,6 +35,7 @@
 #include "InlineBox.h"
 #include "InlineContainer.h"
 #include "LineBox.h"
+#include "ParallelLayout.h"
 #include "ReplacedFormattingContext.h"
 #include <algorithm>
 #include <cstddef>
@@ -60,6 +61,8 @@ void* LayoutPools::AllocateLayoutChunk(size_t size)
 {
 	static_assert(ChunkSizeBig > ChunkSizeMedium && ChunkSizeMedium > ChunkSizeSmall, "The following assumes a strict ordering of the chunk sizes.");
 
+	ParallelLayout::SerialLock lock;
+
 	// Note: If any change is made here, make sure a corresponding change is applied to the deallocation procedure below.
 	if (size <= ChunkSizeSmall)
 		return layout_chunk_pool_small.AllocateAndConstruct();
@@ -74,6 +77,8 @@ void* LayoutPools::AllocateLayoutChunk(size_t size)
 
 void LayoutPools::DeallocateLayoutChunk(void* chunk, size_t size)
 {
+	ParallelLayout::SerialLock lock;
+
 	// Note: If any change is made here, make sure a corresponding change is applied to the allocation procedure above.
 	if (size <= ChunkSizeSmall)
 		layout_chunk_pool_small.DestroyAndDeallocate((LayoutChunk<ChunkSizeSmall>*)chunk);
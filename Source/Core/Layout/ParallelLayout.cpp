@@ -0,0 +1,151 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "ParallelLayout.h"
+#include "../../../Include/RmlUi/Core/ComputedValues.h"
+#include "../../../Include/RmlUi/Core/Core.h"
+#include "../../../Include/RmlUi/Core/Element.h"
+#include "../../../Include/RmlUi/Core/TaskSchedulerInterface.h"
+#include "FormattingContext.h"
+#include "LayoutBox.h"
+#include <mutex>
+
+namespace Rml {
+
+struct DeferredElementCall {
+	Element* element;
+	void (Element::*callback)();
+};
+
+// Only modified by the thread dispatching the tasks, while no tasks are running.
+static bool tasks_running = false;
+static std::recursive_mutex serial_mutex;
+
+// Element callbacks made by the layout task running on the current thread.
+static thread_local Vector<DeferredElementCall>* task_deferred_calls = nullptr;
+
+bool ParallelLayout::IsAvailable()
+{
+	return !tasks_running && GetTaskSchedulerInterface();
+}
+
+void ParallelLayout::FormatIndependent(ContainerBox* parent_container, Vector<IndependentBox>& boxes)
+{
+	if (!IsAvailable())
+		return;
+
+	Vector<int> task_boxes;
+	for (int i = 0; i < (int)boxes.size(); i++)
+	{
+		if (CanFormatConcurrently(boxes[i].element, true, false))
+			task_boxes.push_back(i);
+	}
+
+	// There is nothing to gain from a single task, leave it to the caller.
+	if (task_boxes.size() < 2)
+		return;
+
+	const int num_tasks = (int)task_boxes.size();
+	Vector<Vector<DeferredElementCall>> deferred_calls(num_tasks);
+
+	tasks_running = true;
+
+	GetTaskSchedulerInterface()->RunTasks(num_tasks, [&](int task_index) {
+		IndependentBox& independent_box = boxes[task_boxes[task_index]];
+		task_deferred_calls = &deferred_calls[task_index];
+		independent_box.layout_box = FormattingContext::FormatIndependent(parent_container, independent_box.element,
+			independent_box.override_initial_box, FormattingContextType::Block);
+		task_deferred_calls = nullptr;
+	});
+
+	tasks_running = false;
+
+	// Make the element callbacks in the same order as they would have been made if the elements were formatted serially.
+	for (const Vector<DeferredElementCall>& calls : deferred_calls)
+	{
+		for (const DeferredElementCall& call : calls)
+			(call.element->*call.callback)();
+	}
+}
+
+void ParallelLayout::CallElement(Element* element, void (Element::*callback)())
+{
+	if (task_deferred_calls)
+		task_deferred_calls->push_back(DeferredElementCall{element, callback});
+	else
+		(element->*callback)();
+}
+
+ParallelLayout::SerialLock::SerialLock() : locked(tasks_running)
+{
+	if (locked)
+		serial_mutex.lock();
+}
+
+ParallelLayout::SerialLock::~SerialLock()
+{
+	if (locked)
+		serial_mutex.unlock();
+}
+
+bool ParallelLayout::CanFormatConcurrently(Element* element, bool is_root, bool absolute_containing_block)
+{
+	using namespace Style;
+	const ComputedValues& computed = element->GetComputedValues();
+	const Display display = computed.display();
+	if (display == Display::None)
+		return true;
+
+	// Replaced elements may load their resources, and scroll containers may construct their scrollbar elements, during layout.
+	if (element->IsReplaced() || element->FindElementScroll() || computed.overflow_x() == Overflow::Auto ||
+		computed.overflow_x() == Overflow::Scroll || computed.overflow_y() == Overflow::Auto || computed.overflow_y() == Overflow::Scroll)
+		return false;
+
+	// Absolutely positioned boxes are added to the box of their containing block, which must then be formatted as part of the same task.
+	const Position position = computed.position();
+	if (!is_root && !absolute_containing_block && (position == Position::Absolute || position == Position::Fixed))
+		return false;
+
+	// Only elements generating their own container box can act as the containing block, this excludes inline elements and table rows, columns,
+	// and their groups.
+	const bool generates_container = (display != Display::Inline && display != Display::TableRow && display != Display::TableRowGroup &&
+		display != Display::TableColumn && display != Display::TableColumnGroup);
+	if (generates_container && (position != Position::Static || computed.has_local_transform() || computed.has_local_perspective()))
+		absolute_containing_block = true;
+
+	const int num_children = element->GetNumChildren(true);
+	for (int i = 0; i < num_children; i++)
+	{
+		if (!CanFormatConcurrently(element->GetChild(i), false, absolute_containing_block))
+			return false;
+	}
+
+	return true;
+}
+
+} // namespace Rml
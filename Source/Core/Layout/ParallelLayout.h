@@ -0,0 +1,86 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_LAYOUT_PARALLELLAYOUT_H
+#define RMLUI_CORE_LAYOUT_PARALLELLAYOUT_H
+
+#include "../../../Include/RmlUi/Core/Traits.h"
+#include "../../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class Box;
+class ContainerBox;
+class LayoutBox;
+
+/**
+    Formats independent formatting contexts in parallel using the installed task scheduler interface.
+
+    Only a single level of formatting contexts is formatted in parallel at a time, any formatting contexts nested inside the tasks are formatted
+    serially. An element is only formatted concurrently when the layout of its subtree does not touch any layout state outside of itself. While the
+    tasks are running, shared state such as the layout pools and the font engine must be accessed under the serial lock, and element callbacks are
+    deferred until all the tasks have completed.
+ */
+class ParallelLayout {
+public:
+	struct IndependentBox {
+		Element* element;
+		const Box* override_initial_box;
+		// Set to the resulting layout box when the element has been formatted.
+		UniquePtr<LayoutBox> layout_box;
+	};
+
+	/// Returns true if there is a task scheduler installed, and we are not already running layout tasks.
+	static bool IsAvailable();
+
+	/// Formats the given elements in parallel as independent formatting contexts, if available. Elements that cannot be formatted concurrently are
+	/// left without a layout box, and need to be formatted by the caller.
+	/// @param[in] parent_container The container box all the elements are placed in.
+	/// @param[in,out] boxes The elements to format and their initial boxes, the resulting layout boxes are set for any formatted elements.
+	static void FormatIndependent(ContainerBox* parent_container, Vector<IndependentBox>& boxes);
+
+	/// Calls the given callback on the element now, or if called from a layout task, after all the tasks have completed.
+	static void CallElement(Element* element, void (Element::*callback)());
+
+	/// Serializes access to shared state in scope while layout tasks are running, otherwise does nothing.
+	class SerialLock : NonCopyMoveable {
+	public:
+		SerialLock();
+		~SerialLock();
+
+	private:
+		bool locked;
+	};
+
+private:
+	/// Returns true if the layout of the element and its descendants only affects the layout state of the subtree itself.
+	static bool CanFormatConcurrently(Element* element, bool is_root, bool absolute_containing_block);
+};
+
+} // namespace Rml
+#endif
@@ -33,6 +33,7 @@
 #include "ContainerBox.h"
 #include "LayoutDetails.h"
 #include "LayoutEngine.h"
+#include "ParallelLayout.h"
 #include "TableFormattingDetails.h"
 #include <algorithm>
 #include <numeric>
@@ -419,8 +420,6 @@ void TableFormattingContext::FormatCells(BoxList& cells, Vector2f& table_overflo
 		Style::VerticalAlign vertical_align = element_cell->GetComputedValues().vertical_align();
 
 		const float cell_border_height = GetSpanningCellBorderSize(rows, grid_cell.row_begin, grid_cell.row_last);
-		const Vector2f cell_offset =
-			table_content_offset + Vector2f(columns[grid_cell.column_begin].cell_offset, rows[grid_cell.row_begin].cell_offset);
 
 		// Determine the height of the cell.
 		if (box.GetSize().y < 0)
@@ -468,12 +467,34 @@ void TableFormattingContext::FormatCells(BoxList& cells, Vector2f& table_overflo
 			box.SetEdge(BoxArea::Padding, BoxEdge::Top, box.GetEdge(BoxArea::Padding, BoxEdge::Top) + add_padding_top);
 			box.SetEdge(BoxArea::Padding, BoxEdge::Bottom, box.GetEdge(BoxArea::Padding, BoxEdge::Bottom) + add_padding_bottom);
 		}
+	}
+
+	// With their final boxes determined, the cells are independent of each other and can be formatted in parallel.
+	Vector<ParallelLayout::IndependentBox> independent_boxes;
+	if (ParallelLayout::IsAvailable())
+	{
+		independent_boxes.reserve(cells.size());
+		for (int cell_index = 0; cell_index < (int)cells.size(); cell_index++)
+			independent_boxes.push_back(ParallelLayout::IndependentBox{grid.cells[cell_index].element_cell, &cells[cell_index], nullptr});
+		ParallelLayout::FormatIndependent(table_wrapper_box, independent_boxes);
+	}
+
+	for (int cell_index = 0; cell_index < (int)cells.size(); cell_index++)
+	{
+		const TableGrid::Cell& grid_cell = grid.cells[cell_index];
+		Element* element_cell = grid_cell.element_cell;
+		const Vector2f cell_offset =
+			table_content_offset + Vector2f(columns[grid_cell.column_begin].cell_offset, rows[grid_cell.row_begin].cell_offset);
 
-		// Format the cell in a new block formatting context.
+		// Format the cell in a new block formatting context, unless it has already been formatted in parallel above.
 		// @performance: We may have already formatted the element during the above procedures without the extra padding. In that case, we may
 		//   instead set the new box and offset all descending elements whose offset parent is the cell, to account for the new padding box.
 		//   That should be faster than formatting the element again, but there may be edge-cases not accounted for.
-		auto cell_box = FormattingContext::FormatIndependent(table_wrapper_box, element_cell, &box, FormattingContextType::Block);
+		UniquePtr<LayoutBox> cell_box;
+		if (cell_index < (int)independent_boxes.size())
+			cell_box = std::move(independent_boxes[cell_index].layout_box);
+		if (!cell_box)
+			cell_box = FormattingContext::FormatIndependent(table_wrapper_box, element_cell, &cells[cell_index], FormattingContextType::Block);
 		Vector2f cell_visible_overflow_size = cell_box->GetVisibleOverflowSize();
 
 		// Set the position of the element within the the table container
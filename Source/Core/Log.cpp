@@ -30,6 +30,7 @@
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/StringUtilities.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "Layout/ParallelLayout.h"
 #include <stdarg.h>
 #include <stdio.h>
 
@@ -58,6 +59,9 @@ void Log::Message(Log::Type type, const char* fmt, ...)
 	buffer[len] = '\0';
 	va_end(argument_list);
 
+	// Messages may be logged from parallel layout tasks.
+	ParallelLayout::SerialLock lock;
+
 	if (SystemInterface* system_interface = GetSystemInterface())
 		system_interface->LogMessage(type, buffer);
 	else
@@ -62,6 +62,16 @@ bool RenderInterface::GenerateTexture(TextureHandle& /*texture_handle*/, const b
 	return false;
 }
 
+bool RenderInterface::GenerateDistanceFieldTexture(TextureHandle& /*texture_handle*/, const byte* /*source*/, const Vector2i& /*source_dimensions*/)
+{
+	return false;
+}
+
+bool RenderInterface::UpdateTexture(TextureHandle /*texture_handle*/, const byte* /*source*/, const Vector2i& /*source_dimensions*/)
+{
+	return false;
+}
+
 void RenderInterface::ReleaseTexture(TextureHandle /*texture*/) {}
 
 void RenderInterface::SetTransform(const Matrix4f* /*transform*/) {}
@@ -0,0 +1,193 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "TextBatcher.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/Texture.h"
+#include <algorithm>
+
+namespace Rml {
+
+// Textures are shared between font sizes by the glyph atlas, compare their underlying resources rather than the texture objects.
+static bool IsSameTexture(const Texture* a, const Texture* b)
+{
+	return a == b || (a && b && *a == *b);
+}
+
+TextBatcher* TextBatcher::active_batcher = nullptr;
+int TextBatcher::current_frame = 0;
+
+TextBatcher::TextBatcher() {}
+
+TextBatcher::~TextBatcher()
+{
+	if (active_batcher == this)
+		active_batcher = nullptr;
+}
+
+void TextBatcher::BeginFrame()
+{
+	current_frame += 1;
+}
+
+void TextBatcher::Render(Geometry& geometry, uint64_t revision, Vector2f translation)
+{
+	if (active_batcher != this)
+		Flush();
+
+	if (!geometry)
+		return;
+
+	if (frame != current_frame)
+	{
+		// Only keep the batches of the previous frame, they are the ones most likely to be rendered again.
+		batches.resize(num_rendered_batches);
+		num_rendered_batches = 0;
+		frame = current_frame;
+	}
+
+	if (!pending_items.empty() && !IsSameTexture(geometry.GetTexture(), pending_texture))
+		RenderPendingBatch();
+
+	const Item item = {&geometry, revision, translation.Round(), (int)geometry.GetVertices().size(), (int)geometry.GetIndices().size()};
+	pending_items.push_back(item);
+	pending_geometry.push_back(&geometry);
+	pending_texture = geometry.GetTexture();
+
+	active_batcher = this;
+}
+
+void TextBatcher::RenderPendingBatch()
+{
+	RMLUI_ZoneScoped;
+
+	// We are no longer active, since rendering the batch below flushes the active batcher again.
+	if (active_batcher == this)
+		active_batcher = nullptr;
+
+	if (pending_items.empty())
+		return;
+
+	// There is nothing to gain from copying a single geometry into a batch, render it as is.
+	if (pending_items.size() == 1)
+	{
+		Geometry* geometry = pending_geometry[0];
+		const Vector2f translation = pending_items[0].translation;
+		pending_items.clear();
+		pending_geometry.clear();
+		geometry->Render(translation);
+		return;
+	}
+
+	if (num_rendered_batches == (int)batches.size())
+		batches.push_back(MakeUnique<Batch>());
+
+	Batch& batch = *batches[num_rendered_batches];
+	num_rendered_batches += 1;
+
+	Geometry& batch_geometry = batch.geometry;
+
+	auto same_size = [](const Item& a, const Item& b) { return a.num_vertices == b.num_vertices && a.num_indices == b.num_indices; };
+	auto same_contents = [&](const Item& a, const Item& b) {
+		return a.geometry == b.geometry && a.revision == b.revision && a.translation == b.translation && same_size(a, b);
+	};
+
+	if (IsSameTexture(batch_geometry.GetTexture(), pending_texture) && batch.items.size() == pending_items.size() &&
+		std::equal(batch.items.begin(), batch.items.end(), pending_items.begin(), same_size))
+	{
+		// The layout of the batch is unchanged, only rewrite the ranges of the items that have changed since the batch was last rendered.
+		bool batch_changed = false;
+		int vertex_offset = 0;
+		int index_offset = 0;
+		for (size_t i = 0; i < pending_items.size(); i++)
+		{
+			const Item& item = pending_items[i];
+			if (!same_contents(batch.items[i], item))
+			{
+				WriteItem(batch_geometry, item, *pending_geometry[i], vertex_offset, index_offset);
+				batch_changed = true;
+			}
+			vertex_offset += item.num_vertices;
+			index_offset += item.num_indices;
+		}
+
+		if (batch_changed)
+			batch_geometry.Release();
+	}
+	else
+	{
+		int num_vertices = 0;
+		int num_indices = 0;
+		for (const Item& item : pending_items)
+		{
+			num_vertices += item.num_vertices;
+			num_indices += item.num_indices;
+		}
+
+		// Setting the texture also releases any previously compiled batch.
+		batch.texture = (pending_texture ? *pending_texture : Texture());
+		batch_geometry.SetTexture(pending_texture ? &batch.texture : nullptr);
+		batch_geometry.GetVertices().resize(num_vertices);
+		batch_geometry.GetIndices().resize(num_indices);
+
+		int vertex_offset = 0;
+		int index_offset = 0;
+		for (size_t i = 0; i < pending_items.size(); i++)
+		{
+			const Item& item = pending_items[i];
+			WriteItem(batch_geometry, item, *pending_geometry[i], vertex_offset, index_offset);
+			vertex_offset += item.num_vertices;
+			index_offset += item.num_indices;
+		}
+	}
+
+	batch.items.swap(pending_items);
+	pending_items.clear();
+	pending_geometry.clear();
+
+	batch_geometry.Render(Vector2f(0.f));
+}
+
+void TextBatcher::WriteItem(Geometry& batch_geometry, const Item& item, Geometry& item_geometry, int vertex_offset, int index_offset)
+{
+	const Vector<Vertex>& vertices = item_geometry.GetVertices();
+	const Vector<int>& indices = item_geometry.GetIndices();
+
+	Vertex* batch_vertices = batch_geometry.GetVertices().data() + vertex_offset;
+	for (int i = 0; i < item.num_vertices; i++)
+	{
+		batch_vertices[i] = vertices[i];
+		batch_vertices[i].position += item.translation;
+	}
+
+	int* batch_indices = batch_geometry.GetIndices().data() + index_offset;
+	for (int i = 0; i < item.num_indices; i++)
+		batch_indices[i] = indices[i] + vertex_offset;
+}
+
+} // namespace Rml
@@ -0,0 +1,105 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_TEXTBATCHER_H
+#define RMLUI_CORE_TEXTBATCHER_H
+
+#include "../../Include/RmlUi/Core/Geometry.h"
+#include "../../Include/RmlUi/Core/Texture.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+    Merges the geometry of consecutively rendered text elements of a document into larger batches, to reduce the number of draw calls and
+    compiled geometries. Only consecutive geometry with the same texture is merged, thereby preserving the rendering order. The pending batch
+    is flushed before any other geometry is rendered, and before the clipping region or transform is changed.
+
+    The batches of the previous frame are kept. When the same text is rendered again, its compiled batch is reused. When some of the text of a
+    batch has changed, only the vertices and indices of the changed geometry are rewritten before the batch is compiled again.
+ */
+
+class TextBatcher final : public NonCopyMoveable {
+public:
+	TextBatcher();
+	~TextBatcher();
+
+	/// Starts a new frame, letting each text batcher reuse the batches it rendered during the previous frame.
+	static void BeginFrame();
+
+	/// Renders the pending batch of the active text batcher, if any. Must be called before submitting any other render calls.
+	static void Flush()
+	{
+		if (active_batcher)
+			active_batcher->RenderPendingBatch();
+	}
+
+	/// Adds text geometry to the pending batch, the pending batch is first flushed if the geometry cannot be merged with it.
+	/// @param[in] geometry The geometry to render, it must remain unchanged until the pending batch is flushed.
+	/// @param[in] revision Identifies the contents of the geometry, must be changed whenever the geometry is regenerated.
+	/// @param[in] translation The translation of the geometry.
+	void Render(Geometry& geometry, uint64_t revision, Vector2f translation);
+
+private:
+	struct Item {
+		const Geometry* geometry;
+		uint64_t revision;
+		Vector2f translation;
+		int num_vertices;
+		int num_indices;
+	};
+
+	struct Batch {
+		Vector<Item> items;
+		// A copy of the texture of the items, as the items' textures may be destroyed while the batch is kept. The geometry points to it.
+		Texture texture;
+		Geometry geometry;
+	};
+
+	void RenderPendingBatch();
+
+	// Writes the vertices and indices of the item into the batch geometry at the given offsets.
+	static void WriteItem(Geometry& batch_geometry, const Item& item, Geometry& item_geometry, int vertex_offset, int index_offset);
+
+	// The batches of the previous frame, followed by the batches rendered so far during the current frame.
+	Vector<UniquePtr<Batch>> batches;
+	int num_rendered_batches = 0;
+	int frame = -1;
+
+	// The items and geometry of the pending batch.
+	Vector<Item> pending_items;
+	Vector<Geometry*> pending_geometry;
+	const Texture* pending_texture = nullptr;
+
+	static TextBatcher* active_batcher;
+	static int current_frame;
+};
+
+} // namespace Rml
+#endif
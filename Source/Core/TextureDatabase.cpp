@@ -122,6 +122,28 @@ StringList TextureDatabase::GetSourceList()
 	return result;
 }
 
+Vector<Pair<String, Vector2i>> TextureDatabase::GetLoadedTextures()
+{
+	Vector<Pair<String, Vector2i>> result;
+
+	if (texture_database)
+	{
+		for (const auto& pair : texture_database->textures)
+		{
+			if (pair.second->IsLoaded())
+				result.emplace_back(pair.first, pair.second->GetDimensions());
+		}
+
+		for (TextureResource* texture : texture_database->callback_textures)
+		{
+			if (texture->IsLoaded())
+				result.emplace_back(texture->GetSource(), texture->GetDimensions());
+		}
+	}
+
+	return result;
+}
+
 void TextureDatabase::ReleaseTextures()
 {
 	if (texture_database)
@@ -61,6 +61,9 @@ public:
 	/// Return a list of all texture sources currently in the database.
 	static StringList GetSourceList();
 
+	/// Return the source and dimensions of all textures in the database currently loaded through the render interface.
+	static Vector<Pair<String, Vector2i>> GetLoadedTextures();
+
 	/// Returns true if there are no textures in the database yet to be released through the render interface.
 	static bool AllTexturesReleased();
 
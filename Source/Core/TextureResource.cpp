@@ -31,6 +31,7 @@
 #include "../../Include/RmlUi/Core/Log.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "FrameStatisticsCollector.h"
 #include "TextureDatabase.h"
 
 namespace Rml {
@@ -113,6 +114,7 @@ bool TextureResource::Load()
 	RenderInterface* render_interface = ::Rml::GetRenderInterface();
 
 	loaded = true;
+	FrameStatisticsCollector::Count(&FrameStatistics::texture_uploads);
 
 	// Generate the texture from the callback function if we have one.
 	if (texture_callback)
@@ -48,6 +48,10 @@ public:
 	// Returns a nullptr if there is no transform set, or the transform is singular.
 	const Matrix4f* GetInverseTransform() const;
 
+	// The absolute offset of the owning element at the time the transform and perspective were computed.
+	void SetReferenceOffset(Vector2f offset) { reference_offset = offset; }
+	Vector2f GetReferenceOffset() const { return reference_offset; }
+
 private:
 	bool have_transform = false;
 	bool have_perspective = false;
@@ -62,6 +66,8 @@ private:
 
 	// The inverse of the transform matrix for projecting points from screen space to the current element's space, such as used for picking elements.
 	mutable Matrix4f inverse_transform;
+
+	Vector2f reference_offset;
 };
 
 } // namespace Rml
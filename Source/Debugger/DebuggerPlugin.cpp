@@ -32,11 +32,13 @@
 #include "../../Include/RmlUi/Core/ElementInstancer.h"
 #include "../../Include/RmlUi/Core/ElementUtilities.h"
 #include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/Types.h"
 #include "DebuggerSystemInterface.h"
 #include "ElementContextHook.h"
 #include "ElementInfo.h"
 #include "ElementLog.h"
+#include "ElementPerformance.h"
 #include "FontSource.h"
 #include "Geometry.h"
 #include "MenuSource.h"
@@ -58,9 +60,11 @@ DebuggerPlugin::DebuggerPlugin()
 	menu_element = nullptr;
 	info_element = nullptr;
 	log_element = nullptr;
+	performance_element = nullptr;
 	hook_element = nullptr;
 
 	render_outlines = false;
+	statistics_update_time = 0;
 
 	application_interface = nullptr;
 }
@@ -81,7 +85,7 @@ bool DebuggerPlugin::Initialise(Context* context)
 		return false;
 	}
 
-	if (!LoadMenuElement() || !LoadInfoElement() || !LoadLogElement())
+	if (!LoadMenuElement() || !LoadInfoElement() || !LoadLogElement() || !LoadPerformanceElement())
 	{
 		Log::Message(Log::LT_ERROR, "Failed to initialise debugger, error while load debugger elements.");
 		return false;
@@ -127,6 +131,9 @@ bool DebuggerPlugin::SetContext(Context* context)
 		info_element->Reset();
 	}
 
+	if (performance_element)
+		performance_element->SetDebugContext(context);
+
 	debug_context = context;
 	return true;
 }
@@ -144,6 +151,32 @@ bool DebuggerPlugin::IsVisible()
 	return menu_element->IsVisible();
 }
 
+void DebuggerPlugin::Update()
+{
+	if (performance_element)
+		performance_element->Sample();
+
+	if (!debug_context || !menu_element || !menu_element->IsVisible())
+		return;
+
+	// Refresh the frame statistics periodically, so that they remain readable and don't cause a layout every frame.
+	const double t = GetSystemInterface()->GetElapsedTime();
+	constexpr double update_interval = 0.5;
+	if (t - statistics_update_time < update_interval && t >= statistics_update_time)
+		return;
+	statistics_update_time = t;
+
+	if (Element* element = menu_element->GetElementById("frame-statistics"))
+	{
+		const FrameStatistics& statistics = debug_context->GetFrameStatistics();
+		element->SetInnerRML(CreateString(128, "Update %.2f ms<br/>Render %.2f ms, %d draws", statistics.update_time * 1000.0,
+			(statistics.geometry_time + statistics.render_time) * 1000.0, statistics.draw_calls));
+
+		// We need to update the document manually since this is called during the update of the debugged context.
+		menu_element->UpdateDocument();
+	}
+}
+
 void DebuggerPlugin::Render()
 {
 	// Render the outlines of the debug context's elements.
@@ -180,6 +213,10 @@ void DebuggerPlugin::Render()
 		}
 	}
 
+	// Render the outlines of the elements regenerated during the last frame.
+	if (performance_element && performance_element->IsVisible())
+		performance_element->RenderDirtiedElements();
+
 	// Render the info element's boxes.
 	if (info_element && info_element->IsVisible())
 	{
@@ -242,6 +279,13 @@ void DebuggerPlugin::ProcessEvent(Event& event)
 			else
 				info_element->SetProperty(PropertyId::Visibility, Property(Style::Visibility::Visible));
 		}
+		else if (event.GetTargetElement()->GetId() == "performance-button")
+		{
+			if (performance_element->IsVisible())
+				performance_element->SetProperty(PropertyId::Visibility, Property(Style::Visibility::Hidden));
+			else
+				performance_element->SetProperty(PropertyId::Visibility, Property(Style::Visibility::Visible));
+		}
 		else if (event.GetTargetElement()->GetId() == "outlines-button")
 		{
 			render_outlines = !render_outlines;
@@ -294,6 +338,9 @@ bool DebuggerPlugin::LoadMenuElement()
 	Element* element_info_button = menu_element->GetElementById("debug-info-button");
 	element_info_button->AddEventListener(EventId::Click, this);
 
+	Element* performance_button = menu_element->GetElementById("performance-button");
+	performance_button->AddEventListener(EventId::Click, this);
+
 	Element* outlines_button = menu_element->GetElementById("outlines-button");
 	outlines_button->AddEventListener(EventId::Click, this);
 
@@ -347,6 +394,27 @@ bool DebuggerPlugin::LoadLogElement()
 	return true;
 }
 
+bool DebuggerPlugin::LoadPerformanceElement()
+{
+	performance_element_instancer = MakeUnique<ElementInstancerGeneric<ElementPerformance>>();
+	Factory::RegisterElementInstancer("debug-performance", performance_element_instancer.get());
+	performance_element = rmlui_dynamic_cast<ElementPerformance*>(host_context->CreateDocument("debug-performance"));
+	if (!performance_element)
+		return false;
+
+	performance_element->SetProperty(PropertyId::Visibility, Property(Style::Visibility::Hidden));
+
+	if (!performance_element->Initialise())
+	{
+		host_context->UnloadDocument(performance_element);
+		performance_element = nullptr;
+
+		return false;
+	}
+
+	return true;
+}
+
 void DebuggerPlugin::SetupInfoListeners(Rml::Context* new_context)
 {
 	RMLUI_ASSERT(info_element);
@@ -386,6 +454,13 @@ void DebuggerPlugin::ReleaseElements()
 			info_element = nullptr;
 		}
 
+		if (performance_element)
+		{
+			performance_element->SetDebugContext(nullptr);
+			host_context->UnloadDocument(performance_element);
+			performance_element = nullptr;
+		}
+
 		if (log_element)
 		{
 			host_context->UnloadDocument(log_element);
@@ -41,6 +41,7 @@ namespace Debugger {
 
 class ElementLog;
 class ElementInfo;
+class ElementPerformance;
 class ElementContextHook;
 class DebuggerSystemInterface;
 
@@ -72,6 +73,9 @@ public:
 	/// @return True if the debugger is visible, false if not.
 	bool IsVisible();
 
+	/// Updates any debug elements that display the state of the debug context.
+	void Update();
+
 	/// Renders any debug elements in the debug context.
 	void Render();
 
@@ -99,6 +103,7 @@ private:
 	bool LoadMenuElement();
 	bool LoadInfoElement();
 	bool LoadLogElement();
+	bool LoadPerformanceElement();
 
 	void SetupInfoListeners(Rml::Context* new_context);
 
@@ -114,15 +119,19 @@ private:
 	ElementDocument* menu_element;
 	ElementInfo* info_element;
 	ElementLog* log_element;
+	ElementPerformance* performance_element;
 	ElementContextHook* hook_element;
 
 	Rml::SystemInterface* application_interface;
 	UniquePtr<DebuggerSystemInterface> log_interface;
 
-	UniquePtr<ElementInstancer> hook_element_instancer, info_element_instancer, log_element_instancer;
+	UniquePtr<ElementInstancer> hook_element_instancer, info_element_instancer, log_element_instancer, performance_element_instancer;
 
 	bool render_outlines;
 
+	// The time at which the frame statistics were last displayed.
+	double statistics_update_time;
+
 	// Singleton instance
 	static DebuggerPlugin* instance;
 };
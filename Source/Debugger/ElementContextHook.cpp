@@ -46,6 +46,11 @@ void ElementContextHook::Initialise(DebuggerPlugin* _debugger)
 	debugger = _debugger;
 }
 
+void ElementContextHook::OnUpdate()
+{
+	debugger->Update();
+}
+
 void ElementContextHook::OnRender()
 {
 	// Make sure we're in the front of the render queue for this context (at least next frame).
@@ -0,0 +1,442 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "ElementPerformance.h"
+#include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/ElementUtilities.h"
+#include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "CommonSource.h"
+#include "Geometry.h"
+#include "PerformanceSource.h"
+#include <algorithm>
+
+namespace Rml {
+namespace Debugger {
+
+static constexpr int num_frame_samples = 120;
+static constexpr int max_table_rows = 8;
+static constexpr float target_frame_time = 1.f / 60.f;
+
+static const Colourb update_colour(64, 112, 224);
+static const Colourb layout_colour(224, 144, 48);
+static const Colourb render_colour(64, 176, 64);
+static const Colourb definition_colour(208, 64, 208);
+static const Colourb geometry_colour(48, 176, 192);
+
+namespace {
+	struct SubtreeStatistics {
+		Element* element;
+		int num_elements;
+		int num_vertices;
+	};
+
+	struct TextureStatistics {
+		String name;
+		Vector2i dimensions;
+		int num_textures;
+		size_t num_bytes;
+	};
+} // namespace
+
+static bool IsDebuggerDocument(const ElementDocument* document)
+{
+	return document && document->GetId().find("rmlui-debug-") == 0;
+}
+
+// Returns the statistics of the given subtree, and adds the statistics of all the subtrees within it to 'subtrees'.
+static SubtreeStatistics GatherSubtree(Element* element, const UnorderedMap<Element*, int>& vertices, Vector<SubtreeStatistics>& subtrees)
+{
+	SubtreeStatistics result = {element, 1, 0};
+
+	auto it = vertices.find(element);
+	if (it != vertices.end())
+		result.num_vertices = it->second;
+
+	for (int i = 0; i < element->GetNumChildren(true); i++)
+	{
+		const SubtreeStatistics child = GatherSubtree(element->GetChild(i), vertices, subtrees);
+		result.num_elements += child.num_elements;
+		result.num_vertices += child.num_vertices;
+	}
+
+	subtrees.push_back(result);
+	return result;
+}
+
+static void SortSubtrees(Vector<SubtreeStatistics>& subtrees)
+{
+	std::sort(subtrees.begin(), subtrees.end(), [](const SubtreeStatistics& a, const SubtreeStatistics& b) {
+		return a.num_vertices > b.num_vertices || (a.num_vertices == b.num_vertices && a.num_elements > b.num_elements);
+	});
+}
+
+static String GetDocumentName(ElementDocument* document)
+{
+	const String& url = document->GetSourceURL();
+	if (!url.empty())
+		return url.substr(url.find_last_of("/\\") + 1);
+	return document->GetAddress(false, false);
+}
+
+static void AddTableRow(String& rml, const String& name, const String& value_a, const String& value_b = String())
+{
+	rml += "<tr><td class=\"name\">" + StringUtilities::EncodeRml(name) + "</td><td class=\"number\">" + value_a + "</td><td class=\"number\">" +
+		value_b + "</td></tr>";
+}
+
+static String FormatTime(double seconds)
+{
+	return CreateString(32, "%.2f ms", seconds * 1000.0);
+}
+
+static String FormatBytes(size_t num_bytes)
+{
+	if (num_bytes >= 1024 * 1024)
+		return CreateString(32, "%.1f MiB", double(num_bytes) / (1024.0 * 1024.0));
+	return CreateString(32, "%.1f KiB", double(num_bytes) / 1024.0);
+}
+
+static void AddTextureTable(String& rml, const char* title, Vector<TextureStatistics>& textures)
+{
+	std::sort(textures.begin(), textures.end(), [](const TextureStatistics& a, const TextureStatistics& b) { return a.num_bytes > b.num_bytes; });
+
+	size_t total_bytes = 0;
+	for (const TextureStatistics& texture : textures)
+		total_bytes += texture.num_bytes;
+
+	rml += CreateString(128, "<h2>%s</h2><table>", title);
+	for (int i = 0; i < (int)textures.size() && i < max_table_rows; i++)
+	{
+		const TextureStatistics& texture = textures[i];
+		const String detail = (texture.num_textures == 1 ? CreateString(32, "%dx%d", texture.dimensions.x, texture.dimensions.y)
+														 : CreateString(32, "%d textures", texture.num_textures));
+		AddTableRow(rml, texture.name, detail, FormatBytes(texture.num_bytes));
+	}
+	if ((int)textures.size() > max_table_rows)
+		AddTableRow(rml, CreateString(32, "(%d more)", (int)textures.size() - max_table_rows), "", "");
+	AddTableRow(rml, "Total", "", FormatBytes(total_bytes));
+	rml += "</table>";
+}
+
+ElementPerformance::ElementPerformance(const String& tag) : ElementDocument(tag)
+{
+	debug_context = nullptr;
+	collecting = false;
+	num_collected_frames = 0;
+	highlight_dirtied = false;
+	samples.resize(num_frame_samples, FrameSample{0.f, 0.f, 0.f});
+	next_sample = 0;
+	graph_time_scale = target_frame_time;
+	previous_update_time = 0.0;
+	graph = nullptr;
+	graph_scale = nullptr;
+	statistics = nullptr;
+}
+
+ElementPerformance::~ElementPerformance()
+{
+	RemoveEventListener(EventId::Click, this);
+	SetCollecting(false);
+}
+
+bool ElementPerformance::Initialise()
+{
+	SetInnerRML(performance_rml);
+	SetId("rmlui-debug-performance");
+
+	graph = GetElementById("graph");
+	graph_scale = GetElementById("graph-scale");
+	statistics = GetElementById("statistics");
+
+	SharedPtr<StyleSheetContainer> style_sheet = Factory::InstanceStyleSheetString(String(common_rcss) + String(performance_rcss));
+	if (!style_sheet)
+		return false;
+
+	SetStyleSheetContainer(std::move(style_sheet));
+
+	AddEventListener(EventId::Click, this);
+
+	return true;
+}
+
+void ElementPerformance::SetDebugContext(Context* context)
+{
+	SetCollecting(false);
+	debug_context = context;
+
+	std::fill(samples.begin(), samples.end(), FrameSample{0.f, 0.f, 0.f});
+	next_sample = 0;
+	previous_update_time = 0.0;
+}
+
+void ElementPerformance::Sample()
+{
+	if (!debug_context)
+		return;
+
+	// Only collect element statistics while the panel is shown, they add some overhead to every element update and render.
+	SetCollecting(IsVisible());
+	if (!collecting)
+		return;
+
+	// Element statistics become available one frame after enabling their collection.
+	const bool first_complete_frame = (num_collected_frames == 1);
+	num_collected_frames += 1;
+
+	const FrameStatistics& frame = debug_context->GetFrameStatistics();
+	FrameSample& sample = samples[next_sample];
+	sample.update_time = float(frame.update_time - frame.layout_time);
+	sample.layout_time = float(frame.layout_time);
+	sample.render_time = float(frame.render_time + frame.geometry_time);
+	next_sample = (next_sample + 1) % num_frame_samples;
+
+	// Refresh the tables periodically, so that they remain readable and don't cause a layout every frame.
+	const double t = GetSystemInterface()->GetElapsedTime();
+	constexpr double update_interval = 0.5;
+	if (!first_complete_frame && t - previous_update_time < update_interval && t >= previous_update_time)
+		return;
+	previous_update_time = t;
+
+	UpdateStatistics();
+}
+
+void ElementPerformance::RenderDirtiedElements()
+{
+	if (!highlight_dirtied || !collecting || !debug_context)
+		return;
+
+	for (const ElementFrameStatistics& entry : debug_context->GetElementStatistics())
+	{
+		Element* element = entry.element.get();
+		if (!element || !element->IsVisible() || IsDebuggerDocument(element->GetOwnerDocument()))
+			continue;
+
+		Colourb colour;
+		if (entry.layout_updated)
+			colour = layout_colour;
+		else if (entry.definition_updated)
+			colour = definition_colour;
+		else if (entry.geometry_generated)
+			colour = geometry_colour;
+		else
+			continue;
+
+		ElementUtilities::ApplyTransform(*element);
+		for (int i = 0; i < element->GetNumBoxes(); i++)
+		{
+			Vector2f box_offset;
+			const Box& box = element->GetBox(i, box_offset);
+			Geometry::RenderOutline(element->GetAbsoluteOffset(BoxArea::Border) + box_offset, box.GetSize(BoxArea::Border), colour, 1);
+		}
+	}
+}
+
+void ElementPerformance::OnRender()
+{
+	ElementDocument::OnRender();
+
+	if (!graph)
+		return;
+
+	const Vector2f origin = graph->GetAbsoluteOffset(BoxArea::Content);
+	const Vector2f size = graph->GetBox().GetSize(BoxArea::Content);
+	if (size.x <= 0.f || size.y <= 0.f)
+		return;
+
+	// Render the samples as stacked bars from oldest to newest, scaled so that the slowest frame fits within the graph.
+	const float bar_width = size.x / float(num_frame_samples);
+	for (int i = 0; i < num_frame_samples; i++)
+	{
+		const FrameSample& sample = samples[(next_sample + i) % num_frame_samples];
+		const float x = origin.x + float(i) * bar_width;
+		float y = origin.y + size.y;
+
+		auto RenderSegment = [&](float time, Colourb colour) {
+			const float height = Math::Min(time / graph_time_scale, 1.f) * size.y;
+			if (height <= 0.f)
+				return;
+			y -= height;
+			Geometry::RenderBox(Vector2f(x, y), Vector2f(bar_width, height), colour);
+		};
+
+		RenderSegment(sample.update_time, update_colour);
+		RenderSegment(sample.layout_time, layout_colour);
+		RenderSegment(sample.render_time, render_colour);
+	}
+
+	// Mark the frame time of a 60 Hz display.
+	const float target_y = origin.y + size.y * (1.f - target_frame_time / graph_time_scale);
+	Geometry::RenderBox(Vector2f(origin.x, target_y), Vector2f(size.x, 1.f), Colourb(255, 255, 255, 96));
+}
+
+void ElementPerformance::ProcessEvent(Event& event)
+{
+	if (event == EventId::Click)
+	{
+		Element* target = event.GetTargetElement();
+		if (target->GetId() == "close_button")
+		{
+			SetProperty(PropertyId::Visibility, Property(Style::Visibility::Hidden));
+		}
+		else if (target->GetId() == "highlight_button")
+		{
+			highlight_dirtied = !highlight_dirtied;
+			target->SetInnerRML(highlight_dirtied ? "On" : "Off");
+		}
+	}
+}
+
+void ElementPerformance::SetCollecting(bool enable)
+{
+	if (enable == collecting)
+		return;
+
+	collecting = enable;
+	num_collected_frames = 0;
+	if (debug_context)
+		debug_context->EnableElementStatistics(enable);
+}
+
+void ElementPerformance::UpdateStatistics()
+{
+	graph_time_scale = target_frame_time;
+	for (const FrameSample& sample : samples)
+		graph_time_scale = Math::Max(graph_time_scale, sample.update_time + sample.layout_time + sample.render_time);
+
+	if (graph_scale)
+		graph_scale->SetInnerRML(CreateString(64, "(max %.1f ms)", graph_time_scale * 1000.f));
+
+	if (!statistics)
+		return;
+
+	const FrameStatistics& frame = debug_context->GetFrameStatistics();
+	const ElementFrameStatisticsList& element_statistics = debug_context->GetElementStatistics();
+
+	String rml;
+	rml.reserve(4096);
+
+	rml += "<h2>Last frame</h2><table>";
+	AddTableRow(rml, "Update", FormatTime(frame.update_time), CreateString(64, "%d elements, %d shared", frame.elements_updated, frame.computed_values_shared));
+	AddTableRow(rml, "Definitions", FormatTime(frame.definition_time), CreateString(32, "%d updated", frame.definitions_updated));
+	AddTableRow(rml, "Layout", FormatTime(frame.layout_time), CreateString(32, "%d passes", frame.layout_passes));
+	AddTableRow(rml, "Geometry", FormatTime(frame.geometry_time), CreateString(32, "%d compiled", frame.geometry_compiled));
+	AddTableRow(rml, "Render", FormatTime(frame.render_time), CreateString(32, "%d draws", frame.draw_calls));
+	AddTableRow(rml, "Vertices", CreateString(32, "%d", frame.vertices_rendered), "");
+	AddTableRow(rml, "Textures uploaded", CreateString(32, "%d", frame.texture_uploads), "");
+	AddTableRow(rml, "Glyphs rasterized", CreateString(32, "%d", frame.glyphs_rasterized), "");
+	rml += "</table>";
+
+	// Count the regenerated elements, and collect the number of vertices rendered by each element.
+	int num_definitions = 0, num_layouts = 0, num_geometries = 0;
+	UnorderedMap<Element*, int> element_vertices;
+	for (const ElementFrameStatistics& entry : element_statistics)
+	{
+		Element* element = entry.element.get();
+		if (!element)
+			continue;
+		num_definitions += int(entry.definition_updated);
+		num_layouts += int(entry.layout_updated);
+		num_geometries += int(entry.geometry_generated);
+		if (entry.vertices_rendered > 0)
+			element_vertices[element] = entry.vertices_rendered;
+	}
+
+	rml += "<h2>Regenerated elements</h2><table>";
+	AddTableRow(rml, "Definition", "<span class=\"definition\">" + ToString(num_definitions) + "</span>", "");
+	AddTableRow(rml, "Layout", "<span class=\"layout\">" + ToString(num_layouts) + "</span>", "");
+	AddTableRow(rml, "Geometry", "<span class=\"geometry\">" + ToString(num_geometries) + "</span>", "");
+	rml += "</table>";
+
+	// Gather the element count and rendered vertices of every document and subtree.
+	Vector<SubtreeStatistics> documents;
+	Vector<SubtreeStatistics> subtrees;
+	for (int i = 0; i < debug_context->GetNumDocuments(); i++)
+	{
+		ElementDocument* document = debug_context->GetDocument(i);
+		if (IsDebuggerDocument(document))
+			continue;
+
+		documents.push_back(GatherSubtree(document, element_vertices, subtrees));
+		// The document itself is listed separately.
+		subtrees.pop_back();
+	}
+
+	SortSubtrees(documents);
+	rml += "<h2>Documents</h2><table>";
+	AddTableRow(rml, "", "Elements", "Vertices");
+	for (const SubtreeStatistics& document : documents)
+		AddTableRow(rml, GetDocumentName(static_cast<ElementDocument*>(document.element)), ToString(document.num_elements),
+			ToString(document.num_vertices));
+	rml += "</table>";
+
+	SortSubtrees(subtrees);
+	rml += "<h2>Heaviest subtrees</h2><table>";
+	AddTableRow(rml, "", "Elements", "Vertices");
+	for (int i = 0; i < (int)subtrees.size() && i < max_table_rows; i++)
+		AddTableRow(rml, subtrees[i].element->GetAddress(false, false), ToString(subtrees[i].num_elements), ToString(subtrees[i].num_vertices));
+	rml += "</table>";
+
+	// Estimate texture memory assuming four bytes per pixel, grouping the font textures by their font face.
+	Vector<TextureStatistics> textures;
+	Vector<TextureStatistics> font_textures;
+	const String font_texture_prefix = "font-face-layer: ";
+	for (const auto& texture : GetLoadedTextures())
+	{
+		const size_t num_bytes = size_t(texture.second.x) * size_t(texture.second.y) * 4;
+		if (StringUtilities::StartsWith(texture.first, font_texture_prefix))
+		{
+			const String name = texture.first.substr(font_texture_prefix.size());
+			auto it = std::find_if(font_textures.begin(), font_textures.end(), [&](const TextureStatistics& entry) { return entry.name == name; });
+			if (it == font_textures.end())
+				font_textures.push_back(TextureStatistics{name, texture.second, 1, num_bytes});
+			else
+			{
+				it->num_textures += 1;
+				it->num_bytes += num_bytes;
+			}
+		}
+		else
+		{
+			textures.push_back(TextureStatistics{texture.first.substr(texture.first.find_last_of("/\\") + 1), texture.second, 1, num_bytes});
+		}
+	}
+
+	AddTextureTable(rml, "Textures", textures);
+	AddTextureTable(rml, "Font atlases", font_textures);
+
+	statistics->SetInnerRML(rml);
+
+	// We need to update the document manually since this is called during the update of the debugged context.
+	UpdateDocument();
+}
+
+} // namespace Debugger
+} // namespace Rml
@@ -0,0 +1,102 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_DEBUGGER_ELEMENTPERFORMANCE_H
+#define RMLUI_DEBUGGER_ELEMENTPERFORMANCE_H
+
+#include "../../Include/RmlUi/Core/ElementDocument.h"
+#include "../../Include/RmlUi/Core/EventListener.h"
+#include "../../Include/RmlUi/Core/FrameStatistics.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+namespace Debugger {
+
+/**
+    Displays the frame statistics of the debugged context: a rolling graph of frame times, the heaviest documents and
+    subtrees, texture memory, and the elements regenerated during the last frame.
+ */
+
+class ElementPerformance : public Rml::ElementDocument, public Rml::EventListener {
+public:
+	RMLUI_RTTI_DefineWithParent(ElementPerformance, Rml::ElementDocument)
+
+	ElementPerformance(const String& tag);
+	~ElementPerformance();
+
+	/// Initialises the performance element.
+	/// @return True if the element initialised successfully, false otherwise.
+	bool Initialise();
+
+	/// Sets the context to be profiled.
+	void SetDebugContext(Context* context);
+
+	/// Samples the statistics of the debugged context, should be called once every frame of the debugged context.
+	void Sample();
+
+	/// Outlines the elements of the debugged context which were regenerated during the previous frame, if enabled.
+	void RenderDirtiedElements();
+
+protected:
+	void OnRender() override;
+	void ProcessEvent(Event& event) override;
+
+private:
+	struct FrameSample {
+		float update_time;
+		float layout_time;
+		float render_time;
+	};
+
+	// Enables or disables the collection of element statistics in the debugged context.
+	void SetCollecting(bool collecting);
+
+	// Regenerates the statistics tables from the latest frame.
+	void UpdateStatistics();
+
+	Context* debug_context;
+	bool collecting;
+	int num_collected_frames;
+	bool highlight_dirtied;
+
+	// Rolling buffer of frame samples, with the next sample being written to 'next_sample'.
+	Vector<FrameSample> samples;
+	int next_sample;
+	// The frame time corresponding to the full height of the graph, in seconds.
+	float graph_time_scale;
+
+	double previous_update_time;
+	Element* graph;
+	Element* graph_scale;
+	Element* statistics;
+};
+
+} // namespace Debugger
+} // namespace Rml
+
+#endif
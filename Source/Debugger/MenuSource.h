@@ -80,13 +80,25 @@ span#version-number
 {
 	font-size: 15dp;
 }
+div#frame-statistics
+{
+	float: right;
+	margin-right: 10dp;
+	width: 210dp;
+	font-size: 12dp;
+	line-height: 14dp;
+	margin-top: 2dp;
+	color: white;
+}
 )RCSS";
 
 static const char* menu_rml = R"RML(
 <div id="version-info">RmlUi <span id="version-number"></span></div>
+<div id="frame-statistics"></div>
 <div id="button-group">
 	<button id="event-log-button">Event Log</button>
 	<button id="debug-info-button">Element Info</button>
+	<button id="performance-button">Performance</button>
 	<button id="outlines-button">Outlines</button>
 </div>
 )RML";
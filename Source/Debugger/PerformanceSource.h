@@ -0,0 +1,131 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+static const char* performance_rcss = R"RCSS(
+body
+{
+	width: 420dp;
+	height: 500dp;
+	min-width: 300dp;
+	min-height: 200dp;
+	top: 42dp;
+	right: 20dp;
+}
+div#tools
+{
+	float: right;
+	width: 150dp;
+}
+div.button
+{
+	display: inline-block;
+	width: 40dp;
+	font-size: 13dp;
+	line-height: 20dp;
+	text-align: center;
+	border-width: 1px;
+	border-color: #666;
+	background-color: #ddd;
+	color: #111;
+}
+div.button:hover
+{
+	border-color: #ddd;
+	background-color: #eee;
+}
+div.button:active
+{
+	border-color: #fff;
+	background-color: #fff;
+}
+div#graph
+{
+	height: 80dp;
+	margin: 4dp;
+	background-color: #222;
+}
+div.legend
+{
+	margin: 0 4dp;
+	font-size: 12dp;
+}
+span.update { color: #4070e0; }
+span.layout { color: #e09030; }
+span.render { color: #40b040; }
+span.definition { color: #d040d0; }
+span.geometry { color: #30b0c0; }
+div#statistics
+{
+	padding: 0 4dp 4dp;
+}
+table
+{
+	display: table;
+	width: 100%;
+	font-size: 12dp;
+}
+tr
+{
+	display: table-row;
+}
+td
+{
+	display: table-cell;
+	padding-right: 6dp;
+	white-space: nowrap;
+	overflow: hidden;
+}
+td.name
+{
+	width: 100%;
+}
+td.number
+{
+	text-align: right;
+}
+)RCSS";
+
+static const char* performance_rml = R"RML(
+<h1>
+	<handle id="position_handle" move_target="#document"/>
+	<div id="close_button">X</div>
+	<div id="tools">
+		Highlight <div id="highlight_button" class="button">Off</div>
+	</div>
+	<div style="width: 100dp;">Performance</div>
+</h1>
+<div id="content">
+	<div id="graph"></div>
+	<div class="legend">
+		<span class="update">Update</span> <span class="layout">Layout</span> <span class="render">Render</span>
+		<span id="graph-scale"></span>
+	</div>
+	<div id="statistics"></div>
+</div>
+<handle id="size_handle" size_target="#document" />
+)RML";
@@ -33,17 +33,68 @@
 #include "../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../Include/RmlUi/Core/FileInterface.h"
 #include "../../Include/RmlUi/Core/GeometryUtilities.h"
+#include "../../Include/RmlUi/Core/Math.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include <cmath>
+#include <future>
 #include <rlottie.h>
 
 namespace Rml {
 
+struct ElementLottie::RenderAheadState {
+	size_t frame = size_t(-1);
+	size_t buffer_size = 0;
+	UniquePtr<byte[]> buffer;
+	std::future<rlottie::Surface> result;
+};
+
+static bool render_ahead_enabled = false;
+
+// Reciprocals of each alpha value in 16.16 fixed point, for un-premultiplying colors without a division per channel.
+struct UnpremultiplyTable {
+	UnpremultiplyTable()
+	{
+		reciprocal[0] = 0;
+		for (uint32_t a = 1; a < 256; a++)
+			reciprocal[a] = ((255u << 16) + a / 2) / a;
+	}
+	uint32_t reciprocal[256];
+};
+
+// Swizzle the channel order from rlottie's BGRA to RmlUi's RGBA, and change pre-multiplied to post-multiplied alpha.
+static void ConvertToStraightRGBA(byte* p_data, const size_t num_pixels)
+{
+	static const UnpremultiplyTable table;
+
+	for (byte* p = p_data; p != p_data + 4 * num_pixels; p += 4)
+	{
+		const byte b = p[0];
+		const byte a = p[3];
+
+		// Fully opaque and fully transparent pixels are by far the most common, these only need the channel swap.
+		if (a == 255 || a == 0)
+		{
+			p[0] = p[2];
+			p[2] = b;
+			continue;
+		}
+
+		// The RmlUi samples shell uses post-multiplied alpha, while rlottie serves pre-multiplied alpha.
+		const uint32_t r = table.reciprocal[a];
+		p[0] = byte(Math::Min((p[2] * r + (1u << 15)) >> 16, 255u));
+		p[1] = byte(Math::Min((p[1] * r + (1u << 15)) >> 16, 255u));
+		p[2] = byte(Math::Min((b * r + (1u << 15)) >> 16, 255u));
+	}
+}
+
 ElementLottie::ElementLottie(const String& tag) : Element(tag) {}
 
-ElementLottie::~ElementLottie() {}
+ElementLottie::~ElementLottie()
+{
+	FinishRenderAhead();
+}
 
 bool ElementLottie::GetIntrinsicDimensions(Vector2f& dimensions, float& ratio)
 {
@@ -152,7 +203,9 @@ bool ElementLottie::LoadAnimation()
 {
 	animation_dirty = false;
 	intrinsic_dimensions = Vector2f{};
+	FinishRenderAhead();
 	geometry.SetTexture(nullptr);
+	texture = Texture();
 	animation.reset();
 	prev_animation_frame = size_t(-1);
 	time_animation_start = -1;
@@ -216,6 +269,10 @@ void ElementLottie::UpdateTexture()
 		return;
 	}
 
+	// Any frame rendered ahead was rendered at the previous size, and may be using the buffer we are about to replace.
+	if (texture_size_dirty)
+		FinishRenderAhead();
+
 	// Resize the texture buffer if necessary.
 	const size_t new_texture_data_size = 4 * render_dimensions.x * render_dimensions.y;
 	if (new_texture_data_size > texture_data_size)
@@ -224,45 +281,91 @@ void ElementLottie::UpdateTexture()
 		texture_data_size = new_texture_data_size;
 	}
 
-	// Callback for generating texture.
-	auto p_callback = [this, next_frame](RenderInterface* render_interface, const String& /*name*/, TextureHandle& out_handle,
-						  Vector2i& out_dimensions) -> bool {
-		RMLUI_ASSERT(animation);
+	RenderFrame(next_frame);
 
-		const size_t bytes_per_line = 4 * render_dimensions.x;
-		const size_t total_bytes = bytes_per_line * render_dimensions.y;
-		byte* p_data = texture_data.get();
+	// Replace the contents of the existing texture when possible, otherwise generate a new texture.
+	RenderInterface* render_interface = ::Rml::GetRenderInterface();
+	const TextureHandle texture_handle = (!texture_size_dirty && texture ? texture.GetHandle() : TextureHandle(0));
+	const bool updated_in_place = (texture_handle && render_interface && render_interface->UpdateTexture(texture_handle, texture_data.get(), render_dimensions));
+
+	if (!updated_in_place)
+	{
+		// Callback for generating texture. The texture data buffer always contains the most recent frame, so it can be regenerated at any time.
+		auto p_callback = [this](RenderInterface* render_interface, const String& /*name*/, TextureHandle& out_handle, Vector2i& out_dimensions) -> bool {
+			RMLUI_ASSERT(texture_data);
+			if (!render_interface->GenerateTexture(out_handle, texture_data.get(), render_dimensions))
+				return false;
+
+			out_dimensions = render_dimensions;
+			return true;
+		};
+
+		texture.Set("lottie", p_callback);
+		geometry.SetTexture(&texture);
+	}
+
+	prev_animation_frame = next_frame;
+	texture_size_dirty = false;
 
-		rlottie::Surface surface(reinterpret_cast<uint32_t*>(p_data), render_dimensions.x, render_dimensions.y, bytes_per_line);
-		animation->renderSync(next_frame, surface);
+	if (render_ahead_enabled)
+	{
+		// Start rendering the frame we expect to display next, while the current frame is being displayed.
+		const double frame_duration = 1.0 / animation->frameRate();
+		const double pos_ahead = std::modf((t + frame_duration - time_animation_start) / animation->duration(), &_unused);
+		const size_t ahead_frame = animation->frameAtPos(pos_ahead);
 
-		// Swizzle the channel order from rlottie's BGRA to RmlUi's RGBA, and change pre-multiplied to post-multiplied alpha.
-		for (size_t i = 0; i < total_bytes; i += 4)
+		if (ahead_frame != next_frame)
 		{
-			// Swap the RB order for correct color channels.
-			std::swap(p_data[i], p_data[i + 2]);
+			if (!render_ahead)
+				render_ahead = MakeUnique<RenderAheadState>();
 
-			// The RmlUi samples shell uses post-multiplied alpha, while rlottie serves pre-multiplied alpha.
-			// Here, we un-premultiply the colors.
-			const byte a = p_data[i + 3];
-			if (a > 0 && a < 255)
+			if (new_texture_data_size > render_ahead->buffer_size)
 			{
-				for (size_t j = 0; j < 3; j++)
-					p_data[i + j] = (p_data[i + j] * 255) / a;
+				render_ahead->buffer.reset(new byte[new_texture_data_size]);
+				render_ahead->buffer_size = new_texture_data_size;
 			}
+
+			rlottie::Surface surface(reinterpret_cast<uint32_t*>(render_ahead->buffer.get()), render_dimensions.x, render_dimensions.y,
+				4 * render_dimensions.x);
+			render_ahead->frame = ahead_frame;
+			render_ahead->result = animation->render(ahead_frame, surface);
 		}
+	}
+}
 
-		if (!render_interface->GenerateTexture(out_handle, p_data, render_dimensions))
-			return false;
+void ElementLottie::RenderFrame(size_t frame)
+{
+	if (render_ahead && render_ahead->result.valid() && render_ahead->frame == frame)
+	{
+		// The frame has already been rendered ahead, wait for it to finish and make its buffer the current one.
+		render_ahead->result.get();
+		std::swap(texture_data, render_ahead->buffer);
+		std::swap(texture_data_size, render_ahead->buffer_size);
+	}
+	else
+	{
+		FinishRenderAhead();
 
-		out_dimensions = render_dimensions;
-		return true;
-	};
+		const size_t bytes_per_line = 4 * render_dimensions.x;
+		rlottie::Surface surface(reinterpret_cast<uint32_t*>(texture_data.get()), render_dimensions.x, render_dimensions.y, bytes_per_line);
+		animation->renderSync(frame, surface);
+	}
 
-	texture.Set("lottie", p_callback);
-	geometry.SetTexture(&texture);
-	prev_animation_frame = next_frame;
-	texture_size_dirty = false;
+	ConvertToStraightRGBA(texture_data.get(), size_t(render_dimensions.x) * size_t(render_dimensions.y));
+}
+
+void ElementLottie::FinishRenderAhead()
+{
+	if (render_ahead && render_ahead->result.valid())
+	{
+		render_ahead->result.wait();
+		render_ahead->result = {};
+	}
+}
+
+void ElementLottie::SetRenderAhead(bool enable)
+{
+	render_ahead_enabled = enable;
 }
 
 } // namespace Rml
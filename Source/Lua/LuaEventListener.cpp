@@ -36,6 +36,48 @@ namespace Rml {
 namespace Lua {
 typedef ElementDocument Document;
 
+// Push the compiled function for the given inline event handler code onto the stack. The functions are cached by their
+// code in a table with weak values, so that identical handlers on many elements, such as the rows of a data-for loop, are
+// only compiled once and then shared for as long as any listener refers to them. This is safe since the wrapping function
+// does not capture any per-element state, all arguments are passed in when the event is processed.
+static bool PushCompiledFunction(lua_State* L, const String& code, const String& function)
+{
+	lua_getglobal(L, "EVENTLISTENERCHUNKS");
+	if (lua_isnoneornil(L, -1))
+	{
+		lua_pop(L, 1); // pop the unsucessful getglobal
+		lua_newtable(L);
+		lua_newtable(L);
+		lua_pushstring(L, "v");
+		lua_setfield(L, -2, "__mode");
+		lua_setmetatable(L, -2);
+		lua_pushvalue(L, -1);
+		lua_setglobal(L, "EVENTLISTENERCHUNKS");
+	}
+	int cache = lua_gettop(L);
+
+	lua_pushlstring(L, code.c_str(), code.size());
+	lua_rawget(L, cache);
+	if (!lua_isfunction(L, -1))
+	{
+		lua_pop(L, 1);
+
+		// compile and execute the chunk, which returns the function
+		if (!Interpreter::LoadString(function, code) || !Interpreter::ExecuteCall(0, 1))
+		{
+			lua_settop(L, cache - 1);
+			return false;
+		}
+
+		lua_pushlstring(L, code.c_str(), code.size());
+		lua_pushvalue(L, -2);
+		lua_rawset(L, cache);
+	}
+
+	lua_remove(L, cache);
+	return true;
+}
+
 LuaEventListener::LuaEventListener(const String& code, Element* element) : EventListener()
 {
 	// compose function
@@ -56,9 +98,10 @@ LuaEventListener::LuaEventListener(const String& code, Element* element) : Event
 	}
 	int tbl = lua_gettop(L);
 
-	// compile,execute,and save the function
-	if (!Interpreter::LoadString(function, code) || !Interpreter::ExecuteCall(0, 1))
+	// fetch or compile the function, and save it
+	if (!PushCompiledFunction(L, code, function))
 	{
+		lua_settop(L, top);
 		return;
 	}
 
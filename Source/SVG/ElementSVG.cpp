@@ -28,16 +28,15 @@
 
 #include "../../Include/RmlUi/SVG/ElementSVG.h"
 #include "../../Include/RmlUi/Core/ComputedValues.h"
+#include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/ElementDocument.h"
-#include "../../Include/RmlUi/Core/FileInterface.h"
 #include "../../Include/RmlUi/Core/GeometryUtilities.h"
 #include "../../Include/RmlUi/Core/Math.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
-#include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "SVGCache.h"
 #include <cmath>
-#include <lunasvg.h>
 #include <string.h>
 
 namespace Rml {
@@ -76,7 +75,15 @@ void ElementSVG::OnRender()
 			GenerateGeometry();
 
 		UpdateTexture();
-		geometry.Render(GetAbsoluteOffset(BoxArea::Content));
+		if (SVG::SVGCache::IsTextureReady(svg_texture))
+		{
+			geometry.Render(GetAbsoluteOffset(BoxArea::Content));
+		}
+		else if (Context* ctx = GetContext())
+		{
+			// Keep polling the worker thread, so that the texture is shown as soon as it is rasterized.
+			ctx->RequestNextUpdate(0);
+		}
 	}
 }
 
@@ -148,6 +155,7 @@ bool ElementSVG::LoadSource()
 	texture_dirty = true;
 	intrinsic_dimensions = Vector2f{};
 	geometry.SetTexture(nullptr);
+	svg_texture.reset();
 	svg_document.reset();
 
 	const String attribute_src = GetAttribute<String>("src", "");
@@ -156,34 +164,18 @@ bool ElementSVG::LoadSource()
 		return false;
 
 	String path = attribute_src;
-	String directory;
 
 	if (ElementDocument* document = GetOwnerDocument())
 	{
 		const String document_source_url = StringUtilities::Replace(document->GetSourceURL(), '|', ':');
 		GetSystemInterface()->JoinPath(path, document_source_url, attribute_src);
-		GetSystemInterface()->JoinPath(directory, document_source_url, "");
 	}
 
-	String svg_data;
-
-	if (path.empty() || !GetFileInterface()->LoadFile(path, svg_data))
-	{
-		Log::Message(Rml::Log::Type::LT_WARNING, "Could not load SVG file %s", path.c_str());
-		return false;
-	}
-
-	// We use a reset-release approach here in case clients use a non-std unique_ptr (lunasvg uses std::unique_ptr)
-	svg_document.reset(lunasvg::Document::loadFromData(svg_data).release());
-
+	svg_document = SVG::SVGCache::GetDocument(path);
 	if (!svg_document)
-	{
-		Log::Message(Rml::Log::Type::LT_WARNING, "Could not load SVG data from file %s", path.c_str());
 		return false;
-	}
 
-	intrinsic_dimensions.x = Math::Max(float(svg_document->width()), 1.0f);
-	intrinsic_dimensions.y = Math::Max(float(svg_document->height()), 1.0f);
+	intrinsic_dimensions = svg_document->intrinsic_dimensions;
 
 	return true;
 }
@@ -193,21 +185,14 @@ void ElementSVG::UpdateTexture()
 	if (!svg_document || !texture_dirty)
 		return;
 
-	// Callback for generating texture.
-	auto p_callback = [this](RenderInterface* render_interface, const String& /*name*/, TextureHandle& out_handle, Vector2i& out_dimensions) -> bool {
-		RMLUI_ASSERT(svg_document);
-		lunasvg::Bitmap bitmap = svg_document->renderToBitmap(render_dimensions.x, render_dimensions.y);
-		if (!bitmap.valid() || !bitmap.data())
-			return false;
-		if (!render_interface->GenerateTexture(out_handle, reinterpret_cast<const Rml::byte*>(bitmap.data()), render_dimensions))
-			return false;
-		out_dimensions = render_dimensions;
-		return true;
-	};
-
-	texture.Set("svg", p_callback);
-	geometry.SetTexture(&texture);
+	svg_texture = SVG::SVGCache::GetTexture(svg_document, render_dimensions);
+	geometry.SetTexture(&svg_texture->texture);
 	texture_dirty = false;
 }
 
+void ElementSVG::SetThreadedRasterization(bool enable)
+{
+	SVG::SVGCache::SetThreadedRasterization(enable);
+}
+
 } // namespace Rml
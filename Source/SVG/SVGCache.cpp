@@ -0,0 +1,258 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "SVGCache.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/FileInterface.h"
+#include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "../../Include/RmlUi/Core/RenderInterface.h"
+#include <atomic>
+#include <condition_variable>
+#include <lunasvg.h>
+#include <mutex>
+#include <thread>
+
+namespace Rml {
+namespace SVG {
+
+	struct RasterJob {
+		SVGDocumentHandle document;
+		Vector2i dimensions;
+		lunasvg::Bitmap bitmap;
+		std::atomic<bool> finished{false};
+	};
+
+	SVGDocumentData::~SVGDocumentData() {}
+
+	static lunasvg::Bitmap RenderToBitmap(SVGDocumentData& document, Vector2i dimensions)
+	{
+		std::lock_guard<std::mutex> lock(document.render_mutex);
+		return document.svg_document->renderToBitmap(dimensions.x, dimensions.y);
+	}
+
+	// Rasterizes queued jobs on a single background thread.
+	class RasterWorker {
+	public:
+		~RasterWorker() { Stop(); }
+
+		void Push(SharedPtr<RasterJob> job)
+		{
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				queue.push(std::move(job));
+			}
+			if (!thread.joinable())
+				thread = std::thread(&RasterWorker::Run, this);
+			condition.notify_one();
+		}
+
+		// Finishes the job currently being rasterized and stops the thread. Any remaining jobs are marked as finished without a
+		// bitmap, so that they are rasterized on demand instead.
+		void Stop()
+		{
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				stop = true;
+			}
+			condition.notify_all();
+			if (thread.joinable())
+				thread.join();
+
+			while (!queue.empty())
+			{
+				queue.front()->finished.store(true, std::memory_order_release);
+				queue.pop();
+			}
+			stop = false;
+		}
+
+	private:
+		void Run()
+		{
+			while (true)
+			{
+				SharedPtr<RasterJob> job;
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+					condition.wait(lock, [this] { return stop || !queue.empty(); });
+					if (stop)
+						return;
+					job = std::move(queue.front());
+					queue.pop();
+				}
+
+				job->bitmap = RenderToBitmap(*job->document, job->dimensions);
+				job->finished.store(true, std::memory_order_release);
+			}
+		}
+
+		std::thread thread;
+		std::mutex mutex;
+		std::condition_variable condition;
+		Queue<SharedPtr<RasterJob>> queue;
+		bool stop = false;
+	};
+
+	struct CacheData {
+		UnorderedMap<String, WeakPtr<SVGDocumentData>> documents;
+		RasterWorker worker;
+		bool threaded_rasterization = false;
+	};
+
+	static UniquePtr<CacheData> cache_data;
+
+	void SVGCache::Initialise()
+	{
+		cache_data = MakeUnique<CacheData>();
+	}
+
+	void SVGCache::Shutdown()
+	{
+		cache_data.reset();
+	}
+
+	SVGDocumentHandle SVGCache::GetDocument(const String& path)
+	{
+		RMLUI_ASSERT(cache_data);
+		auto& documents = cache_data->documents;
+
+		auto it = documents.find(path);
+		if (it != documents.end())
+		{
+			if (SVGDocumentHandle document = it->second.lock())
+				return document;
+		}
+
+		String svg_data;
+		if (path.empty() || !GetFileInterface()->LoadFile(path, svg_data))
+		{
+			Log::Message(Rml::Log::Type::LT_WARNING, "Could not load SVG file %s", path.c_str());
+			return nullptr;
+		}
+
+		auto document = MakeShared<SVGDocumentData>();
+		document->path = path;
+
+		// We use a reset-release approach here in case clients use a non-std unique_ptr (lunasvg uses std::unique_ptr)
+		document->svg_document.reset(lunasvg::Document::loadFromData(svg_data).release());
+
+		if (!document->svg_document)
+		{
+			Log::Message(Rml::Log::Type::LT_WARNING, "Could not load SVG data from file %s", path.c_str());
+			return nullptr;
+		}
+
+		document->intrinsic_dimensions.x = Math::Max(float(document->svg_document->width()), 1.0f);
+		document->intrinsic_dimensions.y = Math::Max(float(document->svg_document->height()), 1.0f);
+
+		// Documents no longer in use are only detected here, during the (already expensive) load of a new one.
+		for (auto it_expired = documents.begin(); it_expired != documents.end();)
+		{
+			if (it_expired->second.expired())
+				it_expired = documents.erase(it_expired);
+			else
+				++it_expired;
+		}
+
+		documents[path] = document;
+		return document;
+	}
+
+	SVGTextureHandle SVGCache::GetTexture(const SVGDocumentHandle& document, Vector2i dimensions)
+	{
+		RMLUI_ASSERT(cache_data && document);
+		auto& textures = document->textures;
+
+		for (auto it = textures.begin(); it != textures.end();)
+		{
+			if (SVGTextureHandle texture = it->lock())
+			{
+				if (texture->dimensions == dimensions)
+					return texture;
+				++it;
+			}
+			else
+				it = textures.erase(it);
+		}
+
+		auto texture_data = MakeShared<SVGTextureData>();
+		texture_data->document = document;
+		texture_data->dimensions = dimensions;
+
+		if (cache_data->threaded_rasterization)
+		{
+			auto job = MakeShared<RasterJob>();
+			job->document = document;
+			job->dimensions = dimensions;
+			texture_data->pending_job = job;
+			cache_data->worker.Push(std::move(job));
+		}
+
+		// The texture is owned by the texture data, thus it is safe to capture the raw pointer here.
+		SVGTextureData* data = texture_data.get();
+		auto p_callback = [data](RenderInterface* render_interface, const String& /*name*/, TextureHandle& out_handle, Vector2i& out_dimensions) -> bool {
+			lunasvg::Bitmap bitmap;
+			if (data->pending_job && data->pending_job->finished.load(std::memory_order_acquire))
+				bitmap = std::move(data->pending_job->bitmap);
+			data->pending_job.reset();
+
+			// Rasterize directly if not done by the worker, or when regenerating the texture after it has been released.
+			if (!bitmap.valid())
+				bitmap = RenderToBitmap(*data->document, data->dimensions);
+
+			if (!bitmap.valid() || !bitmap.data())
+				return false;
+			if (!render_interface->GenerateTexture(out_handle, reinterpret_cast<const Rml::byte*>(bitmap.data()), data->dimensions))
+				return false;
+			out_dimensions = data->dimensions;
+			return true;
+		};
+
+		texture_data->texture.Set("svg", p_callback);
+		textures.push_back(texture_data);
+
+		return texture_data;
+	}
+
+	bool SVGCache::IsTextureReady(const SVGTextureHandle& texture)
+	{
+		RMLUI_ASSERT(texture);
+		return !texture->pending_job || texture->pending_job->finished.load(std::memory_order_acquire);
+	}
+
+	void SVGCache::SetThreadedRasterization(bool enable)
+	{
+		RMLUI_ASSERT(cache_data);
+		cache_data->threaded_rasterization = enable;
+		if (!enable)
+			cache_data->worker.Stop();
+	}
+
+} // namespace SVG
+} // namespace Rml
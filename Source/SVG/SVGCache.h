@@ -0,0 +1,102 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_SVG_SVG_CACHE_H
+#define RMLUI_SVG_SVG_CACHE_H
+
+#include "../../Include/RmlUi/Core/Texture.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include <mutex>
+
+namespace lunasvg {
+class Document;
+}
+
+namespace Rml {
+namespace SVG {
+
+	struct RasterJob;
+	struct SVGTextureData;
+
+	/*
+	    A parsed SVG document, shared between all elements referring to the same resolved path.
+	*/
+	struct SVGDocumentData {
+		String path;
+		UniquePtr<lunasvg::Document> svg_document;
+		Vector2f intrinsic_dimensions;
+
+		// Must be held while rasterizing the document, as it may be rasterized both from the worker thread and on demand from the main thread.
+		std::mutex render_mutex;
+
+		// Textures rasterized from this document, one for each set of render dimensions in use.
+		Vector<WeakPtr<SVGTextureData>> textures;
+
+		~SVGDocumentData();
+	};
+
+	/*
+	    A rasterized SVG document, shared between all elements rendering the same document at the same dimensions.
+	*/
+	struct SVGTextureData {
+		SharedPtr<SVGDocumentData> document;
+		Vector2i dimensions;
+		Texture texture;
+
+		// Set while the bitmap is being rasterized on the worker thread.
+		SharedPtr<RasterJob> pending_job;
+	};
+
+	using SVGDocumentHandle = SharedPtr<SVGDocumentData>;
+	using SVGTextureHandle = SharedPtr<SVGTextureData>;
+
+	namespace SVGCache {
+
+		void Initialise();
+		void Shutdown();
+
+		/// Returns the parsed document at the given resolved path, loading and parsing it only if it is not already in use.
+		/// @return The shared document, or null if the file could not be loaded or parsed.
+		SVGDocumentHandle GetDocument(const String& path);
+
+		/// Returns the texture for the document rasterized at the given dimensions, shared with any other users of the same document and size.
+		/// @note If threaded rasterization is enabled, the texture may not be ready yet, see IsTextureReady().
+		SVGTextureHandle GetTexture(const SVGDocumentHandle& document, Vector2i dimensions);
+
+		/// Returns true if the texture can be used for rendering, i.e. it is not waiting on the worker thread.
+		bool IsTextureReady(const SVGTextureHandle& texture);
+
+		/// Enables or disables rasterization on a background worker thread.
+		void SetThreadedRasterization(bool enable);
+
+	} // namespace SVGCache
+
+} // namespace SVG
+} // namespace Rml
+
+#endif
@@ -32,6 +32,7 @@
 #include "../../Include/RmlUi/Core/Log.h"
 #include "../../Include/RmlUi/Core/Plugin.h"
 #include "../../Include/RmlUi/SVG/ElementSVG.h"
+#include "SVGCache.h"
 
 namespace Rml {
 namespace SVG {
@@ -40,6 +41,8 @@ namespace SVG {
 	public:
 		void OnInitialise() override
 		{
+			SVGCache::Initialise();
+
 			instancer = MakeUnique<ElementInstancerGeneric<ElementSVG>>();
 
 			Factory::RegisterElementInstancer("svg", instancer.get());
@@ -47,7 +50,11 @@ namespace SVG {
 			Log::Message(Log::LT_INFO, "SVG plugin initialised.");
 		}
 
-		void OnShutdown() override { delete this; }
+		void OnShutdown() override
+		{
+			SVGCache::Shutdown();
+			delete this;
+		}
 
 		int GetEventClasses() override { return Plugin::EVT_BASIC; }
 
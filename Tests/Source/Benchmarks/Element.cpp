@@ -26,10 +26,12 @@
  *
  */
 
+#include "../Common/TestsInterface.h"
 #include "../Common/TestsShell.h"
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/EventListener.h>
 #include <RmlUi/Core/Types.h>
 #include <doctest.h>
 #include <nanobench.h>
@@ -315,3 +317,171 @@ TEST_CASE("element.asymptotic_complexity")
 
 	document->Close();
 }
+
+class CountingEventListener : public EventListener {
+public:
+	void ProcessEvent(Event& /*event*/) override { num_events += 1; }
+	int num_events = 0;
+};
+
+TEST_CASE("element.mousemove")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	REQUIRE(el);
+	constexpr int num_rows = 50;
+	el->SetInnerRML(GenerateRml(num_rows, DefaultRow));
+	context->Update();
+	context->Render();
+	TestsShell::RenderLoop();
+
+	const Vector2i position = Vector2i(el->GetAbsoluteOffset(BoxArea::Content) + Vector2f(10.f, 10.f));
+	const Vector2i hover_offset = Vector2i(0, int(el->GetChild(1)->GetAbsoluteTop() - el->GetChild(0)->GetAbsoluteTop()));
+	REQUIRE(hover_offset.y > 0);
+
+	nanobench::Bench bench;
+	bench.title("Element mousemove");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	int i = 0;
+	bench.run("ProcessMouseMove", [&] {
+		i = (i + 1) % 2;
+		context->ProcessMouseMove(position.x + i, position.y, 0);
+	});
+
+	bench.run("ProcessMouseMove (change hover)", [&] {
+		i = (i + 1) % 2;
+		context->ProcessMouseMove(position.x, position.y + i * hover_offset.y, 0);
+	});
+
+	CountingEventListener listener;
+	document->AddEventListener(EventId::Mousemove, &listener);
+
+	bench.run("ProcessMouseMove (with listener)", [&] {
+		i = (i + 1) % 2;
+		context->ProcessMouseMove(position.x + i, position.y, 0);
+	});
+
+	document->RemoveEventListener(EventId::Mousemove, &listener);
+	CHECK(listener.num_events > 0);
+
+	document->Close();
+}
+
+static const String document_scroll_rml = R"(
+<rml>
+<head>
+	<link type="text/template" href="/assets/window.rml"/>
+	<title>Benchmark Sample</title>
+	<style>
+		body.window
+		{
+			left: 100px;
+			top: 50px;
+			width: 800px;
+			height: 600px;
+		}
+		#scroll
+		{
+			height: 400px;
+			overflow-y: auto;
+		}
+		.row
+		{
+			height: 20px;
+		}
+	</style>
+</head>
+
+<body template="window">
+<div id="scroll"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("element.scroll")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	TestsSystemInterface* system_interface = TestsShell::GetTestsSystemInterface();
+	REQUIRE(system_interface);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_scroll_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* el = document->GetElementById("scroll");
+	REQUIRE(el);
+
+	constexpr int num_rows = 10'000;
+	String rml;
+	rml.reserve(num_rows * 64);
+	for (int i = 0; i < num_rows; i++)
+		rml += CreateString(64, "<div class=\"row\">Row <span>%d</span></div>", i);
+
+	el->SetInnerRML(rml);
+	context->Update();
+	context->Render();
+	TestsShell::RenderLoop();
+
+	const float max_scroll_top = el->GetScrollHeight() - el->GetClientHeight();
+	REQUIRE(max_scroll_top > 0.f);
+
+	String msg = Rml::CreateString(128, "\nScrolling a list of %d total elements.\n", GetNumDescendentElements(el));
+	msg += TestsShell::GetRenderStats();
+	MESSAGE(msg);
+
+	nanobench::Bench bench;
+	bench.title("Element scroll");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	float scroll_top = 0.f;
+	bench.run("SetScrollTop", [&] {
+		scroll_top = (scroll_top >= max_scroll_top ? 0.f : scroll_top + 7.f);
+		el->SetScrollTop(scroll_top);
+	});
+
+	bench.run("SetScrollTop + Update", [&] {
+		scroll_top = (scroll_top >= max_scroll_top ? 0.f : scroll_top + 7.f);
+		el->SetScrollTop(scroll_top);
+		context->Update();
+	});
+
+	bench.run("SetScrollTop + Update + Render", [&] {
+		scroll_top = (scroll_top >= max_scroll_top ? 0.f : scroll_top + 7.f);
+		el->SetScrollTop(scroll_top);
+		context->Update();
+		context->Render();
+	});
+
+	// Advance the clock one frame at a time, and scroll back and forth between the ends once the smooth scrolling has come to a stop.
+	double t = 0.0;
+	float previous_scroll_top = -1.f;
+	bool scroll_down = true;
+
+	bench.run("ScrollTo (smooth) + Update + Render", [&] {
+		if (el->GetScrollTop() == previous_scroll_top)
+		{
+			el->ScrollTo(Vector2f(0.f, scroll_down ? max_scroll_top : 0.f), ScrollBehavior::Smooth);
+			scroll_down = !scroll_down;
+		}
+		previous_scroll_top = el->GetScrollTop();
+
+		t += 1.0 / 60.0;
+		system_interface->SetTime(t);
+		context->Update();
+		context->Render();
+	});
+
+	system_interface->SetTime(0.0);
+	document->Close();
+}
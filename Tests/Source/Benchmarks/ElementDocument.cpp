@@ -32,6 +32,7 @@
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
 #include <RmlUi/Core/Factory.h>
+#include <RmlUi/Core/StringUtilities.h>
 #include <RmlUi/Core/Types.h>
 #include <doctest.h>
 #include <nanobench.h>
@@ -179,4 +180,43 @@ TEST_CASE("elementdocument")
 			context->Update();
 		});
 	}
+
+	{
+		// A larger document, where the allocation of many small elements dominates loading and unloading.
+		String rows;
+		for (int i = 0; i < 100; i++)
+			rows += CreateString(256, "<div class=\"row\"><div class=\"col col1\"><a>Route %d</a></div><div class=\"col col4\">Assigned</div></div>",
+				i);
+		const String list_rml = "<rml><head><link type=\"text/rcss\" href=\"/assets/rml.rcss\"/><style>body { font-family: LatoLatin; }</style>"
+								"</head><body><div id=\"list\">" +
+			rows + "</div></body></rml>";
+
+		nanobench::Bench bench;
+		bench.title("ElementDocument arena");
+		bench.timeUnit(std::chrono::microseconds(1), "us");
+		bench.relative(true);
+		bench.minEpochIterations(20);
+
+		for (bool use_arena : {false, true})
+		{
+			context->EnableDocumentArenas(use_arena);
+			const String suffix = (use_arena ? " (arena)" : "");
+
+			bench.run("LoadDocument + Unload" + suffix, [&] {
+				ElementDocument* document = context->LoadDocumentFromMemory(list_rml);
+				document->Close();
+				context->Update();
+			});
+
+			bench.run("LoadDocument + Show + Update + Unload" + suffix, [&] {
+				ElementDocument* document = context->LoadDocumentFromMemory(list_rml);
+				document->Show();
+				context->Update();
+				document->Close();
+				context->Update();
+			});
+		}
+
+		context->EnableDocumentArenas(false);
+	}
 }
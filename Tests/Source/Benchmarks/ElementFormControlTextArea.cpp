@@ -0,0 +1,150 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Elements/ElementFormControlTextArea.h>
+#include <RmlUi/Core/Input.h>
+#include <RmlUi/Core/Types.h>
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+static const String document_textarea_rml = R"(
+<rml>
+<head>
+	<link type="text/template" href="/assets/window.rml"/>
+	<title>Benchmark Sample</title>
+	<style>
+		body.window
+		{
+			left: 100px;
+			top: 50px;
+			width: 800px;
+			height: 600px;
+		}
+		textarea
+		{
+			display: block;
+			width: 600px;
+			height: 400px;
+		}
+	</style>
+</head>
+
+<body template="window">
+<textarea id="textarea"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("element.textarea")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_textarea_rml);
+	REQUIRE(document);
+	document->Show();
+
+	auto textarea = rmlui_dynamic_cast<ElementFormControlTextArea*>(document->GetElementById("textarea"));
+	REQUIRE(textarea);
+
+	// Generate roughly 200 KB of text, with a mix of short and long lines that wrap.
+	constexpr int num_paragraphs = 3'000;
+	String value;
+	value.reserve(num_paragraphs * 72);
+	for (int i = 0; i < num_paragraphs; i++)
+	{
+		if (i % 4 == 0)
+			value += CreateString(128, "%d: The quick brown fox jumps over the lazy dog, then the lazy dog jumps over the fox again.\n", i);
+		else
+			value += CreateString(64, "[%05d] log entry\n", i);
+	}
+
+	textarea->SetValue(value);
+	textarea->Focus();
+	context->Update();
+	context->Render();
+	TestsShell::RenderLoop();
+
+	MESSAGE(CreateString(128, "\nEditing a textarea with %d characters.\n", (int)value.size()));
+
+	nanobench::Bench bench;
+	bench.title("Textarea");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	// Place the cursor in the middle of the text, and alternate between typing a character and deleting it again.
+	const int middle = (int)value.size() / 2;
+	textarea->SetSelectionRange(middle, middle);
+	context->Update();
+
+	bool type_character = true;
+	bench.run("Type + Update + Render (middle)", [&] {
+		if (type_character)
+			context->ProcessTextInput('x');
+		else
+			context->ProcessKeyDown(Input::KI_BACK, 0);
+		type_character = !type_character;
+		context->Update();
+		context->Render();
+	});
+
+	textarea->SetSelectionRange(0, 0);
+	context->Update();
+
+	bench.run("Type + Update + Render (beginning)", [&] {
+		if (type_character)
+			context->ProcessTextInput('x');
+		else
+			context->ProcessKeyDown(Input::KI_BACK, 0);
+		type_character = !type_character;
+		context->Update();
+		context->Render();
+	});
+
+	textarea->SetSelectionRange(middle, middle);
+	context->Update();
+
+	bench.run("Line break + Update + Render (middle)", [&] {
+		if (type_character)
+			context->ProcessKeyDown(Input::KI_RETURN, 0);
+		else
+			context->ProcessKeyDown(Input::KI_BACK, 0);
+		type_character = !type_character;
+		context->Update();
+		context->Render();
+	});
+
+	document->Close();
+}
@@ -30,6 +30,7 @@
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/StringUtilities.h>
 #include <RmlUi/Core/Types.h>
 #include <doctest.h>
 #include <nanobench.h>
@@ -491,3 +492,75 @@ TEST_CASE("flexbox")
 		document->Close();
 	}
 }
+
+static const String rml_flexbox_nested_document = R"(
+<rml>
+<head>
+    <title>Flex - Nested auto-width flex containers</title>
+    <link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		.flex {
+			display: flex;
+			border: 1dp #666;
+		}
+		.item {
+			margin: 0 2dp;
+			padding: 2dp;
+			background-color: #edd3c0;
+		}
+	</style>
+</head>
+<body>
+</body>
+</rml>
+)";
+
+// Every level consists of a flex container with auto-sized items, the first item containing the next level. The items need their content sized
+// before they can be formatted, thus naively the work doubles for each level of nesting.
+static String CreateNestedFlexboxRml(int depth)
+{
+	if (depth == 0)
+		return "Leaf";
+	return CreateString(64, "<div class=\"flex\"><div class=\"item\">Level %d", depth) + CreateNestedFlexboxRml(depth - 1) +
+		"</div><div class=\"item\">Sibling</div></div>";
+}
+
+TEST_CASE("flexbox.nested")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(rml_flexbox_nested_document);
+	REQUIRE(document);
+	document->Show();
+
+	nanobench::Bench bench;
+	bench.title("Flexbox nested auto width");
+	bench.relative(true);
+
+	for (int depth : {2, 4, 6, 8, 10})
+	{
+		const String body_rml = CreateNestedFlexboxRml(depth);
+		document->SetInnerRML(body_rml);
+		context->Update();
+		context->Render();
+
+		TestsShell::RenderLoop();
+
+		bench.run(CreateString(64, "SetInnerRML + Update (depth %d)", depth), [&] {
+			document->SetInnerRML(body_rml);
+			context->Update();
+		});
+	}
+
+	// Changing a single leaf should only need its ancestors to be sized again.
+	Element* leaf = document->QuerySelector(".item .item");
+	REQUIRE(leaf);
+	int counter = 0;
+	bench.run("Modify leaf + Update (depth 10)", [&] {
+		leaf->SetProperty("padding-left", CreateString(32, "%ddp", (counter++ % 2) * 4));
+		context->Update();
+	});
+
+	document->Close();
+}
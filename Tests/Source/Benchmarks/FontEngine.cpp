@@ -0,0 +1,96 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/FontEngineInterface.h>
+#include <RmlUi/Core/Geometry.h>
+#include <RmlUi/Core/Types.h>
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+static const String rml_font_engine_document = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body {
+			font-size: 16px;
+		}
+	</style>
+</head>
+<body/>
+</rml>
+)";
+
+TEST_CASE("font_engine")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(rml_font_engine_document);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	FontEngineInterface* font_engine_interface = GetFontEngineInterface();
+	const FontFaceHandle handle = document->GetFontFaceHandle();
+	REQUIRE(handle);
+
+	String text;
+	for (int i = 0; i < 50; i++)
+		text += "The quick brown fox jumps over the lazy dog. Ærøskøbing, Zürich, and Málaga are “lovely” places to visit. ";
+
+	// Make sure all glyphs are loaded before measuring.
+	font_engine_interface->GetStringWidth(handle, text, 0.f);
+
+	nanobench::Bench bench;
+	bench.title("Font engine");
+	bench.relative(true);
+
+	bench.run("GetStringWidth", [&]() {
+		const int width = font_engine_interface->GetStringWidth(handle, text, 0.f);
+		nanobench::doNotOptimizeAway(width);
+	});
+
+	GeometryList geometry;
+	bench.run("GenerateString", [&]() {
+		geometry.clear();
+		const int width = font_engine_interface->GenerateString(handle, 0, text, Vector2f(0, 20), Colourb(255), 1.f, 0.f, geometry);
+		nanobench::doNotOptimizeAway(width);
+	});
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
@@ -0,0 +1,136 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifdef RMLUI_BENCHMARKS_LUA
+
+	#include "../Common/TestsShell.h"
+	#include <RmlUi/Core/Context.h>
+	#include <RmlUi/Core/DataModelHandle.h>
+	#include <RmlUi/Core/Element.h>
+	#include <RmlUi/Core/ElementDocument.h>
+	#include <RmlUi/Lua/Interpreter.h>
+	#include <RmlUi/Lua/Lua.h>
+	#include <doctest.h>
+	#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+static const String document_lua_rml = R"(
+<rml>
+<head>
+	<link type="text/template" href="/assets/window.rml"/>
+	<title>Benchmark Sample</title>
+	<style>
+		body.window
+		{
+			left: 100px;
+			top: 50px;
+			width: 800px;
+			height: 600px;
+		}
+		#rows
+		{
+			height: 400px;
+			overflow-y: auto;
+		}
+		.row
+		{
+			height: 20px;
+		}
+	</style>
+</head>
+
+<body template="window">
+<div id="rows" data-model="lua_rows">
+	<div class="row" data-for="row : rows" onclick="clicks = clicks + 1">Row {{ row }}</div>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("lua.inline_event_handlers")
+{
+	// The Lua plugin needs to be registered before RmlUi is initialized.
+	TestsShell::ShutdownShell();
+	Lua::Initialise();
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	REQUIRE(Lua::Interpreter::LoadString("clicks = 0", "benchmark"));
+	REQUIRE(Lua::Interpreter::ExecuteCall(0, 0));
+
+	Vector<int> rows;
+	DataModelConstructor constructor = context->CreateDataModel("lua_rows");
+	REQUIRE(constructor);
+	constructor.Bind("rows", &rows);
+	DataModelHandle handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_lua_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+	context->Render();
+
+	constexpr int num_rows = 1000;
+
+	nanobench::Bench bench;
+	bench.title("Lua inline event handlers");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	bench.run("Instance data-for rows", [&] {
+		rows.resize(num_rows);
+		for (int i = 0; i < num_rows; i++)
+			rows[i] = i;
+		handle.DirtyVariable("rows");
+		context->Update();
+
+		rows.clear();
+		handle.DirtyVariable("rows");
+		context->Update();
+	});
+
+	bench.run("Instance rows with inline handlers (SetInnerRML)", [&] {
+		String rml;
+		rml.reserve(num_rows * 64);
+		for (int i = 0; i < num_rows; i++)
+			rml += CreateString(64, "<div class=\"row\" onclick=\"clicks = clicks + 1\">Row %d</div>", i);
+		document->GetElementById("rows")->SetInnerRML(rml);
+		context->Update();
+	});
+
+	document->Close();
+	context->RemoveDataModel("lua_rows");
+
+	// Make sure the Lua plugin is unregistered before the next test.
+	TestsShell::ShutdownShell();
+}
+
+#endif
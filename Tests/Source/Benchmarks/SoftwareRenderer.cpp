@@ -0,0 +1,151 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Types.h>
+#include <RmlUi_Renderer_Software.h>
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+
+static Rml::String document_rml = R"(
+<rml>
+<head>
+    <link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body {
+			background: #333;
+		}
+		#panels > div {
+			display: inline-block;
+			margin: 10px;
+			padding: 10px;
+			width: 200px;
+			height: 120px;
+			background: #c3c3c3;
+			border: 4px #55f;
+			border-radius: 10px;
+			color: #222;
+		}
+		#overlapping > div {
+			position: absolute;
+			top: 400px;
+			width: 400px;
+			height: 200px;
+			background: #f00a;
+		}
+	</style>
+</head>
+
+<body>
+<div id="panels">
+	<div>Lorem ipsum dolor sit amet, consectetur adipiscing elit.</div>
+	<div>Sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.</div>
+	<div>Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris.</div>
+	<div>Duis aute irure dolor in reprehenderit in voluptate velit esse.</div>
+	<div>Excepteur sint occaecat cupidatat non proident, sunt in culpa.</div>
+	<div>Lorem ipsum dolor sit amet, consectetur adipiscing elit.</div>
+	<div>Sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.</div>
+	<div>Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris.</div>
+</div>
+<div id="overlapping">
+	<div style="left: 50px"/><div style="left: 150px"/><div style="left: 250px"/><div style="left: 350px"/>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("software_renderer")
+{
+	// The software renderer must be selected before the shell is initialized.
+	TestsShell::ShutdownShell();
+	TestsShell::UseSoftwareRenderer();
+
+	Rml::Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+	RenderInterface_Software* render_interface = TestsShell::GetSoftwareRenderInterface();
+	REQUIRE(render_interface);
+
+	Rml::ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	const Rml::String msg = TestsShell::GetRenderStats();
+	MESSAGE(msg);
+
+#ifdef RMLUI_BENCHMARKS_CAPTURE_DIRECTORY
+	render_interface->SaveFramebuffer(RMLUI_BENCHMARKS_CAPTURE_DIRECTORY "/software_renderer.png");
+#endif
+
+	nanobench::Bench bench;
+	bench.title("Software renderer");
+	bench.relative(true);
+	bench.minEpochIterations(10);
+	bench.warmup(5);
+
+	TestsShell::RenderLoop();
+
+	bench.run("Render", [&] {
+		render_interface->BeginFrame();
+		context->Render();
+		render_interface->EndFrame();
+	});
+
+	{
+		Rml::ElementList elements;
+		document->QuerySelectorAll(elements, "#panels > div");
+		REQUIRE(!elements.empty());
+
+		bench.run("Background all (update + render)", [&] {
+			// Force regeneration of backgrounds without changing layout
+			for (auto& element : elements)
+				element->SetProperty(Rml::PropertyId::BackgroundColor, Rml::Property(Rml::Colourb(195, 195, 195), Rml::Unit::COLOUR));
+			context->Update();
+			render_interface->BeginFrame();
+			context->Render();
+			render_interface->EndFrame();
+		});
+	}
+
+	document->Close();
+
+	// Restore the dummy renderer for the remaining benchmarks.
+	TestsShell::ShutdownShell();
+}
+
+// Suppress warnings emitted by lodepng
+#if defined(RMLUI_PLATFORM_WIN32) && !defined(__MINGW32__)
+	#pragma warning(disable : 4334)
+	#pragma warning(disable : 4267)
+#endif
+
+#include <lodepng.cpp>
@@ -83,10 +83,13 @@ void TestsSystemInterface::SetTime(double t)
 	elapsed_time = t;
 }
 
-void TestsRenderInterface::RenderGeometry(Rml::Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/, int /*num_indices*/,
+void TestsRenderInterface::RenderGeometry(Rml::Vertex* vertices, int num_vertices, int* /*indices*/, int /*num_indices*/,
 	const Rml::TextureHandle /*texture*/, const Rml::Vector2f& /*translation*/)
 {
 	counters.render_calls += 1;
+	counters.render_vertices += num_vertices;
+	for (int i = 0; i < num_vertices; i++)
+		counters.render_texcoord_sum += size_t(vertices[i].tex_coord.x * 65536.f) + size_t(vertices[i].tex_coord.y * 65536.f);
 }
 
 void TestsRenderInterface::EnableScissorRegion(bool /*enable*/)
@@ -116,6 +119,13 @@ bool TestsRenderInterface::GenerateTexture(Rml::TextureHandle& texture_handle, c
 	return true;
 }
 
+bool TestsRenderInterface::UpdateTexture(Rml::TextureHandle /*texture_handle*/, const Rml::byte* /*source*/,
+	const Rml::Vector2i& /*source_dimensions*/)
+{
+	counters.update_texture += 1;
+	return true;
+}
+
 void TestsRenderInterface::ReleaseTexture(Rml::TextureHandle /*texture_handle*/)
 {
 	counters.release_texture += 1;
@@ -58,10 +58,14 @@ class TestsRenderInterface : public Rml::RenderInterface {
 public:
 	struct Counters {
 		size_t render_calls;
+		size_t render_vertices;
+		// Order-independent sum of the rendered texture coordinates, to compare the contents of the geometry.
+		size_t render_texcoord_sum;
 		size_t enable_scissor;
 		size_t set_scissor;
 		size_t load_texture;
 		size_t generate_texture;
+		size_t update_texture;
 		size_t release_texture;
 		size_t set_transform;
 	};
@@ -74,6 +78,7 @@ public:
 
 	bool LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& source) override;
 	bool GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
+	bool UpdateTexture(Rml::TextureHandle texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
 	void ReleaseTexture(Rml::TextureHandle texture_handle) override;
 
 	void SetTransform(const Rml::Matrix4f* transform) override;
@@ -34,6 +34,7 @@
 #include <RmlUi/Core/EventListener.h>
 #include <RmlUi/Debugger.h>
 #include <RmlUi_Backend.h>
+#include <RmlUi_Renderer_Software.h>
 #include <Shell.h>
 #include <doctest.h>
 
@@ -45,6 +46,7 @@ const Rml::Vector2i window_size(1500, 800);
 
 bool shell_initialized = false;
 bool debugger_allowed = true;
+bool use_software_renderer = false;
 int num_documents_begin = 0;
 Rml::Context* shell_context = nullptr;
 
@@ -68,6 +70,8 @@ public:
 #else
 // The tests renderer only collects statistics, does not render anything.
 TestsRenderInterface shell_render_interface;
+// The software renderer rasterizes into memory, created when requested.
+Rml::UniquePtr<RenderInterface_Software> software_render_interface;
 #endif
 } // namespace
 
@@ -104,7 +108,15 @@ static void InitializeShell(bool allow_debugger)
 #else
 		// Set our custom system and render interfaces.
 		Rml::SetSystemInterface(&tests_system_interface);
-		Rml::SetRenderInterface(&shell_render_interface);
+		if (use_software_renderer)
+		{
+			software_render_interface = Rml::MakeUnique<RenderInterface_Software>(window_size.x, window_size.y);
+			Rml::SetRenderInterface(software_render_interface.get());
+		}
+		else
+		{
+			Rml::SetRenderInterface(&shell_render_interface);
+		}
 
 		REQUIRE(Rml::Initialise());
 		shell_context = Rml::CreateContext("main", window_size);
@@ -119,6 +131,12 @@ Rml::Context* TestsShell::GetContext(bool allow_debugger)
 	return shell_context;
 }
 
+void TestsShell::UseSoftwareRenderer()
+{
+	REQUIRE_MESSAGE(!shell_initialized, "The software renderer must be selected before the shell is initialized.");
+	use_software_renderer = true;
+}
+
 void TestsShell::BeginFrame()
 {
 #ifdef RMLUI_TESTS_USE_SHELL
@@ -149,7 +167,11 @@ void TestsShell::RenderLoop()
 	}
 #else
 	shell_context->Update();
+	if (software_render_interface)
+		software_render_interface->BeginFrame();
 	shell_context->Render();
+	if (software_render_interface)
+		software_render_interface->EndFrame();
 #endif
 }
 
@@ -173,6 +195,11 @@ void TestsShell::ShutdownShell()
 
 		Shell::Shutdown();
 
+#ifndef RMLUI_TESTS_USE_SHELL
+		software_render_interface.reset();
+#endif
+		use_software_renderer = false;
+
 		shell_context = nullptr;
 		shell_initialized = false;
 	}
@@ -189,6 +216,25 @@ Rml::String TestsShell::GetRenderStats()
 
 #if !defined(RMLUI_TESTS_USE_SHELL)
 
+	if (software_render_interface)
+	{
+		shell_context->Update();
+		software_render_interface->BeginFrame();
+		shell_context->Render();
+		software_render_interface->EndFrame();
+		auto& statistics = software_render_interface->GetStatistics();
+
+		return Rml::CreateString(256,
+			"Context::Render() stats:\n"
+			"  Draw calls: %d\n"
+			"  State changes: %d\n"
+			"  Triangles: %d\n"
+			"  Pixels filled: %lld\n"
+			"  Pixels overdrawn: %lld",
+			statistics.draw_calls, statistics.state_changes, statistics.triangles, (long long)statistics.pixels_filled,
+			(long long)statistics.pixels_overdrawn);
+	}
+
 	shell_context->Update();
 	shell_render_interface.ResetCounters();
 	shell_context->Render();
@@ -201,10 +247,11 @@ Rml::String TestsShell::GetRenderStats()
 		"  Scissor set: %zu\n"
 		"  Texture load: %zu\n"
 		"  Texture generate: %zu\n"
+		"  Texture update: %zu\n"
 		"  Texture release: %zu\n"
 		"  Transform set: %zu",
 		counters.render_calls, counters.enable_scissor, counters.set_scissor, counters.load_texture, counters.generate_texture,
-		counters.release_texture, counters.set_transform);
+		counters.update_texture, counters.release_texture, counters.set_transform);
 
 #endif
 
@@ -216,7 +263,16 @@ TestsRenderInterface* TestsShell::GetTestsRenderInterface()
 #if defined(RMLUI_TESTS_USE_SHELL)
 	return nullptr;
 #else
-	return &shell_render_interface;
+	return software_render_interface ? nullptr : &shell_render_interface;
+#endif
+}
+
+RenderInterface_Software* TestsShell::GetSoftwareRenderInterface()
+{
+#if defined(RMLUI_TESTS_USE_SHELL)
+	return nullptr;
+#else
+	return software_render_interface.get();
 #endif
 }
 
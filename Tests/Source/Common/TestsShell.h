@@ -33,6 +33,7 @@
 namespace Rml {
 class RenderInterface;
 }
+class RenderInterface_Software;
 class TestsRenderInterface;
 class TestsSystemInterface;
 
@@ -41,6 +42,10 @@ namespace TestsShell {
 // Will initialize the shell and create a context on first use.
 Rml::Context* GetContext(bool allow_debugger = true);
 
+// Render using the headless software renderer instead of the dummy renderer, until the next call to 'ShutdownShell()'.
+// Must be called before the shell is initialized. Applies only when not compiled with the shell backend.
+void UseSoftwareRenderer();
+
 void BeginFrame();
 void PresentFrame();
 
@@ -57,11 +62,13 @@ void SetNumExpectedWarnings(int num_warnings);
 
 void SetTime(double t);
 
-// Stats only available for the dummy renderer.
+// Stats only available for the dummy and software renderers.
 Rml::String GetRenderStats();
 
 // Returns nullptr if the dummy renderer is not being used.
 TestsRenderInterface* GetTestsRenderInterface();
+// Returns nullptr if the software renderer is not being used.
+RenderInterface_Software* GetSoftwareRenderInterface();
 TestsSystemInterface* GetTestsSystemInterface();
 
 } // namespace TestsShell
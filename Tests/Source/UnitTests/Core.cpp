@@ -32,6 +32,9 @@
 #include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/FileInterface.h>
+#include <RmlUi/Core/FontEngineInterface.h>
+#include <RmlUi/Core/Geometry.h>
 #include <algorithm>
 #include <doctest.h>
 
@@ -165,11 +168,13 @@ TEST_CASE("core.release_textures")
 		TestsShell::RenderLoop();
 		CHECK(counters.generate_texture == counter_generate_before);
 
-		// However, when we display a non-ASCII character not part of the initial cache, the font texture needs to be regenerated.
+		// However, when we display a non-ASCII character not part of the initial cache, the font texture needs to be updated.
+		const auto counter_update_before = counters.update_texture;
 		element->SetInnerRML(reinterpret_cast<const char*>(u8"π"));
 		TestsShell::RenderLoop();
-		CHECK(counters.generate_texture == counter_generate_before + 1);
-		CHECK(counters.release_texture == counter_release_before + 1);
+		CHECK(counters.update_texture == counter_update_before + 1);
+		CHECK(counters.generate_texture == counter_generate_before);
+		CHECK(counters.release_texture == counter_release_before);
 	}
 
 	document->Close();
@@ -179,3 +184,514 @@ TEST_CASE("core.release_textures")
 	// Finally, verify that all generated and loaded textures are released during shutdown.
 	CHECK(counters.generate_texture + counters.load_texture == counters.release_texture);
 }
+
+static const String document_font_sizes_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			color: #fff;
+		}
+	</style>
+</head>
+
+<body>
+<p style="font-size: 12px">Small text</p>
+<p style="font-size: 16px">Medium text</p>
+<p style="font-size: 24px">Large text</p>
+<p id="huge" style="font-size: 36px">Huge text</p>
+</body>
+</rml>
+)";
+
+TEST_CASE("core.font_glyph_atlas")
+{
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	// This test only works with the dummy renderer.
+	if (!render_interface)
+		return;
+
+	render_interface->ResetCounters();
+	const auto& counters = render_interface->GetCounters();
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_font_sizes_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	// All the sizes of the font face should be packed into a single texture.
+	CHECK(counters.generate_texture == 1);
+
+	Element* huge = document->GetElementById("huge");
+	const FontFaceHandle small_handle = document->GetChild(0)->GetFontFaceHandle();
+	const int small_version = GetFontEngineInterface()->GetVersion(small_handle);
+	const int huge_version = GetFontEngineInterface()->GetVersion(huge->GetFontFaceHandle());
+
+	// New glyphs in one size are packed into the free space of the existing texture, which is updated in place.
+	huge->SetInnerRML(reinterpret_cast<const char*>(u8"π"));
+	TestsShell::RenderLoop();
+	CHECK(counters.generate_texture == 1);
+	CHECK(counters.update_texture == 1);
+	CHECK(counters.release_texture == 0);
+
+	// Only the size with new glyphs should need to regenerate its geometry.
+	CHECK(GetFontEngineInterface()->GetVersion(huge->GetFontFaceHandle()) != huge_version);
+	CHECK(GetFontEngineInterface()->GetVersion(small_handle) == small_version);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+
+	CHECK(counters.generate_texture == counters.release_texture);
+}
+
+TEST_CASE("core.text_batching")
+{
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	// This test only works with the dummy renderer.
+	if (!render_interface)
+		return;
+
+	const auto& counters = render_interface->GetCounters();
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_font_sizes_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	render_interface->ResetCounters();
+	context->Render();
+	const size_t unbatched_render_calls = counters.render_calls;
+
+	// All the text shares the texture of the glyph atlas, and should be merged into a single draw call.
+	context->EnableTextBatching(true);
+	render_interface->ResetCounters();
+	context->Render();
+	CHECK(counters.render_calls == unbatched_render_calls - 3);
+
+	// Changing the text of one element should keep it in the batch, and the batch should only contain the new geometry of the element.
+	for (const char* text : {"Changed text", "Changed TEXT", "Tiny"})
+	{
+		document->GetElementById("huge")->SetInnerRML(text);
+		context->Update();
+		render_interface->ResetCounters();
+		context->Render();
+		const size_t batched_render_vertices = counters.render_vertices;
+		const size_t batched_render_texcoord_sum = counters.render_texcoord_sum;
+		CHECK(counters.render_calls == unbatched_render_calls - 3);
+
+		context->EnableTextBatching(false);
+		render_interface->ResetCounters();
+		context->Render();
+		CHECK(counters.render_vertices == batched_render_vertices);
+		CHECK(counters.render_texcoord_sum == batched_render_texcoord_sum);
+		context->EnableTextBatching(true);
+	}
+
+	// Transformed text is rendered separately.
+	document->SetProperty("transform", "rotate(10deg)");
+	TestsShell::RenderLoop();
+	render_interface->ResetCounters();
+	context->Render();
+	CHECK(counters.render_calls == unbatched_render_calls);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("core.font_fallback")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_font_sizes_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	Element* element = document->GetElementById("huge");
+	const FontFaceHandle text_handle = element->GetFontFaceHandle();
+	element->SetProperty("font-family", "Noto Emoji");
+	context->Update();
+	const FontFaceHandle emoji_handle = element->GetFontFaceHandle();
+	REQUIRE(text_handle);
+	REQUIRE(emoji_handle);
+	REQUIRE(text_handle != emoji_handle);
+
+	// Characters missing from the font face are taken from the first fallback face containing them.
+	const String emoji = reinterpret_cast<const char*>(u8"🙂🚀");
+	const int emoji_width = GetFontEngineInterface()->GetStringWidth(emoji_handle, emoji, 0.f);
+	CHECK(emoji_width > 0);
+	CHECK(GetFontEngineInterface()->GetStringWidth(text_handle, emoji, 0.f) == emoji_width);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+#ifdef RMLUI_ENABLE_HARFBUZZ
+TEST_CASE("core.text_shaping")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_font_sizes_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	FontEngineInterface* font_engine_interface = GetFontEngineInterface();
+	const FontFaceHandle handle = document->GetElementById("huge")->GetFontFaceHandle();
+	const FontEffectsHandle effects_handle = font_engine_interface->PrepareFontEffects(handle, FontEffectList());
+	REQUIRE(handle);
+
+	int num_glyphs = 0;
+	int width = 0;
+	auto GenerateString = [&](const String& string) {
+		GeometryList geometry;
+		width = font_engine_interface->GenerateString(handle, effects_handle, string, Vector2f(0.f), Colourb(255), 1.f, 0.f, geometry);
+
+		num_glyphs = 0;
+		for (Geometry& layer_geometry : geometry)
+			num_glyphs += (int)layer_geometry.GetVertices().size() / 4;
+	};
+
+	// Shaping the characters separately gives the unshaped run of glyphs.
+	int unshaped_num_glyphs = 0;
+	int unshaped_width = 0;
+	for (const char* character : {"f", "f", "i"})
+	{
+		GenerateString(character);
+		unshaped_num_glyphs += num_glyphs;
+		unshaped_width += width;
+	}
+	CHECK(unshaped_num_glyphs == 3);
+
+	// The font face substitutes the characters by a single and narrower ligature glyph.
+	GenerateString("ffi");
+	CHECK(num_glyphs == 1);
+	CHECK(width > 0);
+	CHECK(width < unshaped_width);
+
+	CHECK(font_engine_interface->GetStringWidth(handle, "ffi", 0.f) == width);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+#endif
+
+static const String document_font_cache_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 31px;
+			color: #fff;
+		}
+		p {
+			font-effect: blur(3px #f00);
+		}
+	</style>
+</head>
+
+<body>
+<p>Cached glyphs and effects</p>
+</body>
+</rml>
+)";
+
+// Keeps saved files in memory, all other requests are forwarded to the underlying file interface.
+class MemoryFileInterface : public FileInterface {
+public:
+	MemoryFileInterface(FileInterface* parent) : parent(parent) {}
+
+	FileHandle Open(const String& path) override { return parent->Open(path); }
+	void Close(FileHandle file) override { parent->Close(file); }
+	size_t Read(void* buffer, size_t size, FileHandle file) override { return parent->Read(buffer, size, file); }
+	bool Seek(FileHandle file, long offset, int origin) override { return parent->Seek(file, offset, origin); }
+	size_t Tell(FileHandle file) override { return parent->Tell(file); }
+
+	bool LoadFile(const String& path, String& out_data) override
+	{
+		auto it = files.find(path);
+		if (it == files.end())
+			return parent->LoadFile(path, out_data);
+
+		num_loads += 1;
+		out_data = it->second;
+		return true;
+	}
+	bool SaveFile(const String& path, const String& data) override
+	{
+		num_saves += 1;
+		saved_paths.push_back(path);
+		files[path] = data;
+		return true;
+	}
+
+	int CountFiles(const String& extension) const
+	{
+		auto has_extension = [&](const decltype(files)::value_type& file) { return EndsWith(file.first, extension); };
+		return (int)std::count_if(files.begin(), files.end(), has_extension);
+	}
+	int CountSaves(const String& extension) const
+	{
+		auto has_extension = [&](const String& path) { return EndsWith(path, extension); };
+		return (int)std::count_if(saved_paths.begin(), saved_paths.end(), has_extension);
+	}
+
+	UnorderedMap<String, String> files;
+	StringList saved_paths;
+	int num_loads = 0;
+	int num_saves = 0;
+
+private:
+	static bool EndsWith(const String& str, const String& suffix)
+	{
+		return str.size() >= suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+	}
+
+	FileInterface* parent;
+};
+
+TEST_CASE("core.font_cache")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	MemoryFileInterface file_interface(Rml::GetFileInterface());
+	Rml::SetFileInterface(&file_interface);
+	Rml::SetFontCacheDirectory("font-cache/");
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_font_cache_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	Element* element = document->QuerySelector("p");
+	REQUIRE(element);
+	const String text = "Cached glyphs and effects";
+	const int width = GetFontEngineInterface()->GetStringWidth(element->GetFontFaceHandle(), text, 0.f);
+
+	// The glyphs of each new font face handle should have been rendered and saved to the cache.
+	CHECK(file_interface.num_loads == 0);
+	CHECK(file_interface.CountFiles(".glyphs") >= 1);
+	CHECK(file_interface.files.begin()->first.rfind("font-cache/", 0) == 0);
+
+	// The effect bitmaps are kept in memory while glyphs are added, instead of rewriting the file each time the effect texture is regenerated.
+	element->SetInnerRML("Additional glyphs: QZJXK 0123456789");
+	TestsShell::RenderLoop();
+	CHECK(file_interface.CountFiles(".effect") == 0);
+
+	// They are saved once when the layer is released.
+	Rml::ReleaseFontResources();
+	CHECK(file_interface.CountSaves(".effect") == 1);
+	CHECK(file_interface.CountFiles(".effect") == 1);
+
+	// After releasing the font resources, the glyphs and effect bitmaps should be loaded from the cache instead of being rendered again.
+	const int num_saves = file_interface.num_saves;
+	TestsShell::RenderLoop();
+
+	CHECK(file_interface.num_loads >= (int)file_interface.files.size());
+	CHECK(GetFontEngineInterface()->GetStringWidth(element->GetFontFaceHandle(), text, 0.f) == width);
+
+	// Nothing new was rendered, so nothing is saved when releasing them again.
+	Rml::ReleaseFontResources();
+	CHECK(file_interface.num_saves == num_saves);
+	TestsShell::RenderLoop();
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+// Maps files by loading them into memory, all other requests are forwarded to the underlying file interface.
+class MappingFileInterface : public FileInterface {
+public:
+	MappingFileInterface(FileInterface* parent) : parent(parent) {}
+
+	FileHandle Open(const String& path) override { return parent->Open(path); }
+	void Close(FileHandle file) override { parent->Close(file); }
+	size_t Read(void* buffer, size_t size, FileHandle file) override { return parent->Read(buffer, size, file); }
+	bool Seek(FileHandle file, long offset, int origin) override { return parent->Seek(file, offset, origin); }
+	size_t Tell(FileHandle file) override { return parent->Tell(file); }
+
+	bool MapFile(const String& path, const byte*& out_data, size_t& out_size) override
+	{
+		auto file = MakeUnique<String>();
+		if (!parent->LoadFile(path, *file) || file->empty())
+			return false;
+
+		out_data = (const byte*)file->data();
+		out_size = file->size();
+		mapped_files.push_back(std::move(file));
+		return true;
+	}
+	void UnmapFile(const byte* data, size_t size) override
+	{
+		auto it = std::find_if(mapped_files.begin(), mapped_files.end(),
+			[&](const UniquePtr<String>& file) { return (const byte*)file->data() == data && file->size() == size; });
+		REQUIRE(it != mapped_files.end());
+		mapped_files.erase(it);
+	}
+
+	Vector<UniquePtr<String>> mapped_files;
+
+private:
+	FileInterface* parent;
+};
+
+TEST_CASE("core.font_file_mapping")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	MappingFileInterface file_interface(Rml::GetFileInterface());
+	Rml::SetFileInterface(&file_interface);
+
+	// Font files should be mapped when supported by the file interface, and stay mapped while their faces are loaded.
+	CHECK(Rml::LoadFontFace("assets/LatoLatin-Bold.ttf"));
+	CHECK(file_interface.mapped_files.size() == 1);
+
+	Rml::ReleaseFontResources();
+	CHECK(file_interface.mapped_files.size() == 1);
+
+	// The mapping should be released together with the font engine.
+	TestsShell::ShutdownShell();
+	CHECK(file_interface.mapped_files.empty());
+}
+
+TEST_CASE("core.frame_statistics")
+{
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	// This test only works with the dummy renderer.
+	if (!render_interface)
+		return;
+
+	const auto& counters = render_interface->GetCounters();
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocument("assets/demo.rml");
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	Element* element = document->GetElementById("content");
+	REQUIRE(element);
+	element->SetInnerRML("<p>Frame statistics</p><p style='background: #f00'>Should be updated</p>");
+
+	// Statistics of a frame are made available at the start of the next update.
+	render_interface->ResetCounters();
+	context->Update();
+	context->Render();
+	const size_t render_calls = counters.render_calls;
+	const size_t texture_uploads = counters.generate_texture + counters.load_texture;
+	context->Update();
+
+	const FrameStatistics& statistics = context->GetFrameStatistics();
+	CHECK(statistics.update_time > 0.0);
+	CHECK(statistics.update_time >= statistics.definition_time + statistics.property_time + statistics.layout_time);
+	CHECK(statistics.definitions_updated > 0);
+	CHECK(statistics.elements_updated > 0);
+	CHECK(statistics.layout_passes > 0);
+	CHECK(statistics.geometry_time > 0.0);
+	CHECK(statistics.draw_calls == (int)render_calls);
+	CHECK(statistics.texture_uploads == (int)texture_uploads);
+
+	// Nothing changed during the second frame, thus we should only see rendering.
+	render_interface->ResetCounters();
+	context->Render();
+	context->Update();
+
+	CHECK(statistics.definitions_updated == 0);
+	CHECK(statistics.elements_updated == 0);
+	CHECK(statistics.layout_passes == 0);
+	CHECK(statistics.texture_uploads == 0);
+	CHECK(statistics.draw_calls == (int)counters.render_calls);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("core.element_statistics")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocument("assets/demo.rml");
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	// Element statistics are only collected when enabled.
+	CHECK(context->GetElementStatistics().empty());
+	context->EnableElementStatistics(true);
+
+	Element* element = document->GetElementById("content");
+	REQUIRE(element);
+	element->SetInnerRML("<p id='text'>Element statistics</p><p id='box' style='background: #f00; height: 10px'/>");
+	Element* text = document->GetElementById("text");
+	Element* box = document->GetElementById("box");
+	REQUIRE(text);
+	REQUIRE(box);
+
+	context->Update();
+	context->Render();
+	context->Update();
+
+	auto find_statistics = [context](Element* element) -> const ElementFrameStatistics* {
+		for (const ElementFrameStatistics& entry : context->GetElementStatistics())
+		{
+			if (entry.element.get() == element)
+				return &entry;
+		}
+		return nullptr;
+	};
+
+	const ElementFrameStatistics* box_statistics = find_statistics(box);
+	REQUIRE(box_statistics);
+	CHECK(box_statistics->definition_updated);
+	CHECK(box_statistics->layout_updated);
+	CHECK(box_statistics->geometry_generated);
+	CHECK(box_statistics->vertices_rendered > 0);
+
+	const ElementFrameStatistics* text_statistics = find_statistics(text);
+	REQUIRE(text_statistics);
+	CHECK(text_statistics->definition_updated);
+	CHECK(text_statistics->layout_updated);
+
+	// Only rendering takes place during the next frame.
+	context->Render();
+	context->Update();
+
+	box_statistics = find_statistics(box);
+	REQUIRE(box_statistics);
+	CHECK_FALSE(box_statistics->definition_updated);
+	CHECK_FALSE(box_statistics->layout_updated);
+	CHECK_FALSE(box_statistics->geometry_generated);
+	CHECK(box_statistics->vertices_rendered > 0);
+
+	context->EnableElementStatistics(false);
+	CHECK(context->GetElementStatistics().empty());
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
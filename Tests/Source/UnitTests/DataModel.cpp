@@ -116,4 +116,30 @@ TEST_CASE("Data variables")
 		REQUIRE(model.GetVariable(ParseAddress("data.fun.magic[8]")).Get(get_result));
 		CHECK(get_result.Get<String>() == "90");
 	}
+
+	// Test reuse of data addresses, which caches the resolved member and variable lookups
+	{
+		const DataAddress address = ParseAddress("data.more_fun[2].x");
+		Variant result;
+
+		data.more_fun[2].x = "first";
+		REQUIRE(model.GetVariableInto(address, result));
+		CHECK(result.Get<String>() == "first");
+
+		data.more_fun[2].x = "second";
+		REQUIRE(model.GetVariableInto(address, result));
+		CHECK(result.Get<String>() == "second");
+
+		// The cached lookups are tied to their owners, so the same address must resolve correctly against another model.
+		DataModel other_model(&types);
+		DataModelConstructor other_handle(&other_model);
+		SmartData other_data;
+		other_data.more_fun[2].x = "other";
+		other_handle.Bind("data", &other_data);
+
+		REQUIRE(other_model.GetVariableInto(address, result));
+		CHECK(result.Get<String>() == "other");
+		REQUIRE(model.GetVariableInto(address, result));
+		CHECK(result.Get<String>() == "second");
+	}
 }
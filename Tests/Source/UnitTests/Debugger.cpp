@@ -80,5 +80,47 @@ TEST_CASE("debugger")
 		TestsShell::RenderLoop();
 	}
 
+	SUBCASE("performance")
+	{
+		Rml::Debugger::Initialise(context);
+		Rml::Debugger::SetVisible(true);
+
+		ElementDocument* document = context->LoadDocument("assets/demo.rml");
+		document->Show();
+		TestsShell::RenderLoop();
+
+		ElementDocument* performance = context->GetDocument("rmlui-debug-performance");
+		REQUIRE(performance);
+		CHECK(context->GetElementStatistics().empty());
+
+		// Opening the panel enables element statistics, and fills the panel periodically.
+		performance->Show();
+		Element* highlight_button = performance->GetElementById("highlight_button");
+		REQUIRE(highlight_button);
+		highlight_button->Click();
+		CHECK(highlight_button->GetInnerRML() == "On");
+
+		document->GetElementById("content")->SetInnerRML("<p>Performance</p>");
+		TestsShell::RenderLoop();
+		TestsShell::RenderLoop();
+		CHECK(!context->GetElementStatistics().empty());
+
+		Element* statistics = performance->GetElementById("statistics");
+		REQUIRE(statistics);
+		CHECK(statistics->HasChildNodes());
+
+		// Hiding the panel stops the collection.
+		performance->Hide();
+		TestsShell::RenderLoop();
+		TestsShell::RenderLoop();
+		CHECK(context->GetElementStatistics().empty());
+
+		document->Close();
+		TestsShell::RenderLoop();
+
+		Rml::Debugger::Shutdown();
+		TestsShell::RenderLoop();
+	}
+
 	TestsShell::ShutdownShell();
 }
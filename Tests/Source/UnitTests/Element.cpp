@@ -33,6 +33,7 @@
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/EventListener.h>
 #include <RmlUi/Core/Factory.h>
 #include <doctest.h>
 
@@ -421,3 +422,257 @@ TEST_CASE("Element.ScrollIntoView")
 	document->Close();
 	TestsShell::ShutdownShell();
 }
+
+TEST_CASE("Element.Culling")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_scroll_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Run(context);
+
+	Element* scrollable = document->GetElementById("scrollable");
+	REQUIRE(scrollable);
+
+	// Only the bottom row and the rightmost column are entirely outside the 100x100 scroll region.
+	const int num_culled_initial = context->GetNumCulledElements();
+	CHECK(num_culled_initial == 8);
+
+	// After scrolling to the end the top row and leftmost column are culled instead.
+	scrollable->ScrollTo(Vector2f(100, 100));
+	Run(context);
+	CHECK(context->GetNumCulledElements() == num_culled_initial);
+
+	// Returns the ids of the elements which rendered anything, using the element statistics made available by the update after rendering.
+	context->EnableElementStatistics(true);
+	auto RenderAndGetRenderedElements = [context]() {
+		Run(context);
+		context->Update();
+		StringList ids;
+		for (const ElementFrameStatistics& statistics : context->GetElementStatistics())
+		{
+			if (statistics.element && statistics.vertices_rendered > 0)
+				ids.push_back(statistics.element->GetId());
+		}
+		return ids;
+	};
+	auto Contains = [](const StringList& ids, const char* id) { return std::find(ids.begin(), ids.end(), id) != ids.end(); };
+
+	StringList rendered = RenderAndGetRenderedElements();
+	CHECK(!Contains(rendered, "cell00"));
+	CHECK(Contains(rendered, "cell33"));
+
+	// Partially visible elements at each edge of the scroll region must still be rendered.
+	scrollable->ScrollTo(Vector2f(25, 25));
+	rendered = RenderAndGetRenderedElements();
+	CHECK(context->GetNumCulledElements() == num_culled_initial);
+	CHECK(Contains(rendered, "cell00"));
+	CHECK(Contains(rendered, "cell02"));
+	CHECK(Contains(rendered, "cell20"));
+	CHECK(Contains(rendered, "cell22"));
+	CHECK(!Contains(rendered, "cell03"));
+	CHECK(!Contains(rendered, "cell33"));
+
+	// Elements scrolled back into view are rendered again, and the ones scrolled out are culled.
+	scrollable->ScrollTo(Vector2f(0, 0));
+	rendered = RenderAndGetRenderedElements();
+	CHECK(context->GetNumCulledElements() == num_culled_initial);
+	CHECK(Contains(rendered, "cell00"));
+	CHECK(!Contains(rendered, "cell33"));
+
+	// Elements just past the edge of the scroll region are culled, while the ones just inside are rendered.
+	scrollable->ScrollTo(Vector2f(51, 51));
+	rendered = RenderAndGetRenderedElements();
+	CHECK(!Contains(rendered, "cell00"));
+	CHECK(Contains(rendered, "cell11"));
+	CHECK(Contains(rendered, "cell33"));
+
+	context->EnableElementStatistics(false);
+
+	// Nothing should be culled when all the content fits inside the element.
+	scrollable->SetProperty(PropertyId::Width, Property(500.f, Unit::PX));
+	scrollable->SetProperty(PropertyId::Height, Property(500.f, Unit::PX));
+	Run(context);
+	CHECK(context->GetNumCulledElements() == 0);
+
+	document->Close();
+}
+
+static const String document_events_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { left: 0; top: 0; right: 0; bottom: 0; }
+		div { display: block; height: 100px; }
+	</style>
+</head>
+<body>
+<div id="outer"><div id="inner"/></div>
+<div id="other"/>
+</body>
+</rml>
+)";
+
+class RecordingEventListener : public EventListener {
+public:
+	void ProcessEvent(Event& event) override
+	{
+		num_events += 1;
+		last_type = event.GetType();
+		last_mouse_x = event.GetParameter("mouse_x", -1);
+		current_element = event.GetCurrentElement();
+
+		if (nested_target)
+		{
+			// Dispatch another event while this one is being processed, it must not disturb the current event.
+			Element* target = nested_target;
+			nested_target = nullptr;
+			target->DispatchEvent("nested", {{"value", Variant(42)}});
+
+			CHECK(event.GetType() == last_type);
+			CHECK(event.GetParameter("mouse_x", -1) == last_mouse_x);
+			CHECK(event.GetCurrentElement() == current_element);
+		}
+	}
+
+	int num_events = 0;
+	String last_type;
+	int last_mouse_x = -1;
+	Element* current_element = nullptr;
+	Element* nested_target = nullptr;
+};
+
+TEST_CASE("Element.EventDispatch")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_events_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	Element* outer = document->GetElementById("outer");
+	Element* inner = document->GetElementById("inner");
+	Element* other = document->GetElementById("other");
+	REQUIRE(outer);
+	REQUIRE(inner);
+	REQUIRE(other);
+
+	// Moving the mouse without any listeners attached should not have any effect.
+	context->ProcessMouseMove(10, 10, 0);
+	context->ProcessMouseMove(11, 10, 0);
+
+	RecordingEventListener move_listener;
+	RecordingEventListener nested_listener;
+	outer->AddEventListener(EventId::Mousemove, &move_listener);
+	other->AddEventListener("nested", &nested_listener);
+
+	context->ProcessMouseMove(12, 10, 0);
+	CHECK(move_listener.num_events == 1);
+	CHECK(move_listener.last_type == "mousemove");
+	CHECK(move_listener.last_mouse_x == 12);
+	CHECK(move_listener.current_element == outer);
+
+	SUBCASE("Nested")
+	{
+		move_listener.nested_target = other;
+		context->ProcessMouseMove(13, 10, 0);
+		CHECK(move_listener.num_events == 2);
+		CHECK(move_listener.last_mouse_x == 13);
+		CHECK(nested_listener.num_events == 1);
+		CHECK(nested_listener.last_type == "nested");
+		CHECK(nested_listener.current_element == other);
+	}
+
+	SUBCASE("Removed")
+	{
+		outer->RemoveEventListener(EventId::Mousemove, &move_listener);
+		context->ProcessMouseMove(14, 10, 0);
+		CHECK(move_listener.num_events == 1);
+	}
+
+	outer->RemoveEventListener(EventId::Mousemove, &move_listener);
+	other->RemoveEventListener("nested", &nested_listener);
+
+	document->Close();
+}
+
+static const String document_memory_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		#scroll { overflow: auto; height: 50px; }
+		#decorated { decorator: gradient(vertical #f00 #00f); }
+	</style>
+</head>
+<body>
+	<p>Plain text</p>
+	<div id="plain"/>
+	<div id="scroll"><div style="height: 200px"/></div>
+	<div id="decorated"/>
+	<div id="listener"/>
+</body>
+</rml>
+)";
+
+static void SumMemoryUsage(Element* element, ElementMemoryUsage& usage, int& num_elements)
+{
+	usage += element->GetMemoryUsage();
+	num_elements += 1;
+	for (int i = 0; i < element->GetNumChildren(true); i++)
+		SumMemoryUsage(element->GetChild(i), usage, num_elements);
+}
+
+TEST_CASE("Element.MemoryUsage")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_memory_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+	context->Render();
+
+	// Rarely used components should only be allocated by the elements which need them.
+	const ElementMemoryUsage plain = document->GetElementById("plain")->GetMemoryUsage();
+	CHECK(plain.meta > 0);
+	CHECK(plain.event_dispatcher == 0);
+	CHECK(plain.decoration == 0);
+	CHECK(plain.scroll == 0);
+	CHECK(plain.GetTotal() == plain.element + plain.meta);
+
+	ElementList paragraphs;
+	document->GetElementsByTagName(paragraphs, "p");
+	REQUIRE(paragraphs.size() == 1);
+	const ElementMemoryUsage text = paragraphs[0]->GetChild(0)->GetMemoryUsage();
+	CHECK(text.GetTotal() == plain.GetTotal());
+
+	CHECK(document->GetElementById("scroll")->GetMemoryUsage().scroll > 0);
+	CHECK(document->GetElementById("decorated")->GetMemoryUsage().decoration > 0);
+
+	Element* listener_element = document->GetElementById("listener");
+	CHECK(listener_element->GetMemoryUsage().event_dispatcher == 0);
+	RecordingEventListener listener;
+	listener_element->AddEventListener(EventId::Click, &listener);
+	CHECK(listener_element->GetMemoryUsage().event_dispatcher > 0);
+	listener_element->RemoveEventListener(EventId::Click, &listener);
+
+	ElementMemoryUsage total;
+	int num_elements = 0;
+	SumMemoryUsage(document, total, num_elements);
+	CHECK(total.meta == num_elements * plain.meta);
+
+	const String msg = CreateString(256, "Memory usage of %d elements: %zu bytes (element %zu, meta %zu, events %zu, decoration %zu, scroll %zu)",
+		num_elements, total.GetTotal(), total.element, total.meta, total.event_dispatcher, total.decoration, total.scroll);
+	MESSAGE(msg);
+
+	document->Close();
+}
@@ -286,4 +286,59 @@ TEST_CASE("ReloadStyleSheet")
 	TestsShell::ShutdownShell();
 }
 
+static const String document_arena_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+</head>
+<body>
+	<div id="list"><p id="moved">Moved <span>text</span></p><p id="cloned">Cloned</p><input type="text" value="Input"/></div>
+</body>
+</rml>
+)";
+
+TEST_CASE("Arena")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* other_document = context->LoadDocumentFromMemory(document_arena_rml);
+	REQUIRE(other_document);
+	other_document->Show();
+
+	context->EnableDocumentArenas(true);
+	ElementDocument* document = context->LoadDocumentFromMemory(document_arena_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	// Elements allocated from the arena may be moved to other documents, and cloned after loading. They must outlive the document they were
+	// loaded into.
+	Element* list = document->GetElementById("list");
+	Element* moved = other_document->AppendChild(list->RemoveChild(document->GetElementById("moved")));
+	Element* cloned = other_document->AppendChild(document->GetElementById("cloned")->Clone());
+	list->AppendChild(document->CreateElement("p"))->SetInnerRML("Created after loading");
+
+	const int num_documents = context->GetNumDocuments();
+	document->Close();
+	context->Update();
+	CHECK(context->GetNumDocuments() == num_documents - 1);
+
+	CHECK(moved->GetInnerRML() == "Moved <span>text</span>");
+	CHECK(cloned->GetInnerRML() == "Cloned");
+	moved->SetInnerRML("Still alive");
+
+	// The child list of the moved element was allocated from the arena, and can keep growing after the document is unloaded.
+	for (int i = 0; i < 10; i++)
+		moved->AppendChild(other_document->CreateElement("span"));
+	CHECK(moved->GetNumChildren() == 11);
+
+	context->Update();
+	context->Render();
+
+	other_document->Close();
+	context->EnableDocumentArenas(false);
+	TestsShell::ShutdownShell();
+}
+
 TEST_SUITE_END();
@@ -27,9 +27,11 @@
  */
 
 #include "../Common/TestsShell.h"
+#include <RmlUi/Core/ComputedValues.h>
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/FrameStatistics.h>
 #include <doctest.h>
 
 using namespace Rml;
@@ -84,3 +86,158 @@ TEST_CASE("elementstyle.inline_decorator_images")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_shared_values_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		#parent { color: #f00; }
+		.colored { color: #0f0; }
+		.same-color { color: #f00; }
+		.rare { max-width: 100px; }
+	</style>
+</head>
+
+<body>
+<div id="parent">
+	<div id="plain"/>
+	<div id="plain_sibling"/>
+	<div id="colored" class="colored"/>
+	<div id="same_color" class="same-color"/>
+	<div id="rare" class="rare"/>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("elementstyle.shared_computed_values")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_shared_values_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	const ComputedValues& parent = document->GetElementById("parent")->GetComputedValues();
+	Element* plain = document->GetElementById("plain");
+	Element* colored = document->GetElementById("colored");
+	Element* same_color = document->GetElementById("same_color");
+	Element* rare = document->GetElementById("rare");
+
+	// Elements without their own inherited properties share the values of their parent, as do those setting the same values.
+	CHECK(plain->GetComputedValues().SharesInheritedValuesWith(parent));
+	CHECK(same_color->GetComputedValues().SharesInheritedValuesWith(parent));
+	CHECK(!colored->GetComputedValues().SharesInheritedValuesWith(parent));
+	CHECK(colored->GetComputedValues().color() == Colourb(0, 255, 0));
+	CHECK(plain->GetComputedValues().color() == Colourb(255, 0, 0));
+
+	CHECK(plain->GetComputedValues().HasDefaultRareValues());
+	CHECK(document->GetElementById("plain_sibling")->GetComputedValues().HasDefaultRareValues());
+	CHECK(!rare->GetComputedValues().HasDefaultRareValues());
+	CHECK(rare->GetComputedValues().max_width().value == 100.f);
+
+	// Writing to shared values should only affect the element being written to.
+	rare->SetClass("rare", false);
+	plain->SetClass("colored", true);
+	context->Update();
+
+	CHECK(rare->GetComputedValues().HasDefaultRareValues());
+	CHECK(!plain->GetComputedValues().SharesInheritedValuesWith(parent));
+	CHECK(plain->GetComputedValues().color() == Colourb(0, 255, 0));
+	CHECK(parent.color() == Colourb(255, 0, 0));
+	CHECK(same_color->GetComputedValues().color() == Colourb(255, 0, 0));
+
+	// Changes to the parent are inherited by the children sharing its values.
+	document->GetElementById("parent")->SetProperty("color", "#00f");
+	context->Update();
+
+	CHECK(same_color->GetComputedValues().color() == Colourb(255, 0, 0));
+	CHECK(rare->GetComputedValues().color() == Colourb(0, 0, 255));
+	CHECK(rare->GetComputedValues().SharesInheritedValuesWith(parent));
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+static const String document_sibling_values_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		#list { font-size: 20px; }
+		p { width: 2em; color: #f00; }
+		p.wide { width: 4em; }
+	</style>
+</head>
+
+<body>
+<div id="list">
+	<p id="first"/>
+	<p id="second"/>
+	<p/>
+	<p/>
+	<p/>
+	<p/>
+	<p id="wide" class="wide"/>
+	<p id="inline" style="width: 10px"/>
+	<p id="last"/>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("elementstyle.sibling_computed_values")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_sibling_values_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	Element* first = document->GetElementById("first");
+	Element* second = document->GetElementById("second");
+	Element* wide = document->GetElementById("wide");
+	Element* inline_element = document->GetElementById("inline");
+	Element* last = document->GetElementById("last");
+
+	// Siblings with the same definition share their values, while those with different definitions or inline properties compute their own.
+	CHECK(second->GetComputedValues().SharesInheritedValuesWith(first->GetComputedValues()));
+	CHECK(last->GetComputedValues().SharesInheritedValuesWith(first->GetComputedValues()));
+	CHECK(first->GetComputedValues().width().value == 40.f);
+	CHECK(last->GetComputedValues().width().value == 40.f);
+	CHECK(wide->GetComputedValues().width().value == 80.f);
+	CHECK(inline_element->GetComputedValues().width().value == 10.f);
+	CHECK(last->GetComputedValues().color() == Colourb(255, 0, 0));
+
+	// Shared values should still notify the elements of changed em-relative properties, so that they are formatted again.
+	document->GetElementById("list")->SetProperty("font-size", "10px");
+	context->Update();
+
+	// Statistics of a frame are made available at the start of the next update.
+	context->Update();
+	CHECK(context->GetFrameStatistics().computed_values_shared >= 6);
+
+	CHECK(first->GetComputedValues().width().value == 20.f);
+	CHECK(last->GetComputedValues().width().value == 20.f);
+	CHECK(last->GetBox().GetSize().x == 20.f);
+	CHECK(wide->GetBox().GetSize().x == 40.f);
+	CHECK(inline_element->GetBox().GetSize().x == 10.f);
+
+	// Changing a single element must not affect its siblings.
+	second->SetProperty("color", "#00f");
+	context->Update();
+
+	CHECK(second->GetComputedValues().color() == Colourb(0, 0, 255));
+	CHECK(first->GetComputedValues().color() == Colourb(255, 0, 0));
+	CHECK(last->GetComputedValues().color() == Colourb(255, 0, 0));
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
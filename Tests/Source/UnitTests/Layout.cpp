@@ -31,7 +31,9 @@
 #include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/TaskSchedulerInterface.h>
 #include <doctest.h>
+#include <thread>
 
 using namespace Rml;
 
@@ -138,3 +140,225 @@ TEST_CASE("Layout.Position.Relative")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_layout_rml_nested_flex = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			width: 500px;
+			height: 300px;
+		}
+		.flex {
+			display: flex;
+		}
+		.item {
+			padding: 0 5px;
+		}
+		#inner {
+			display: inline-block;
+		}
+		#leaf {
+			width: 50px;
+			height: 20px;
+		}
+	</style>
+</head>
+
+<body>
+	<div class="flex">
+		<div class="item" id="outer"><div class="item" id="inner"><div id="leaf"/></div></div>
+	</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("Layout.IntrinsicSizeCache")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	// Intrinsic sizes of the flex items are cached between layout runs, test that they are updated when their descendants change.
+	ElementDocument* document = context->LoadDocumentFromMemory(document_layout_rml_nested_flex);
+	REQUIRE(document);
+	document->Show();
+
+	Element* outer = document->GetElementById("outer");
+	Element* inner = document->GetElementById("inner");
+	Element* leaf = document->GetElementById("leaf");
+	REQUIRE(outer);
+	REQUIRE(inner);
+	REQUIRE(leaf);
+
+	TestsShell::RenderLoop();
+	CHECK(inner->GetBox().GetSize().x == 50.f);
+	CHECK(outer->GetBox().GetSize().x == 60.f);
+
+	leaf->SetProperty("width", "100px");
+	leaf->SetProperty("height", "40px");
+	TestsShell::RenderLoop();
+	CHECK(inner->GetBox().GetSize().x == 100.f);
+	CHECK(outer->GetBox().GetSize().x == 110.f);
+	CHECK(inner->GetBox().GetSize().y == 40.f);
+
+	// Changing the size of the document does not affect the intrinsic sizes of the items.
+	document->SetProperty("width", "400px");
+	TestsShell::RenderLoop();
+	CHECK(outer->GetBox().GetSize().x == 110.f);
+
+	// Adding content to the innermost item must invalidate the cached sizes of all its ancestors.
+	inner->AppendChild(document->CreateElement("div"))->SetProperty("width", "150px");
+	TestsShell::RenderLoop();
+	CHECK(inner->GetBox().GetSize().x == 150.f);
+	CHECK(outer->GetBox().GetSize().x == 160.f);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_layout_rml_parallel = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			width: 600px;
+			height: 400px;
+		}
+		.flex {
+			display: flex;
+			flex-wrap: wrap;
+		}
+		.panel {
+			flex: 1 1 150px;
+			margin: 5px;
+			padding: 5px;
+			border: 1px #000;
+		}
+		.relative {
+			position: relative;
+		}
+		.absolute {
+			position: absolute;
+			right: 5px;
+			bottom: 5px;
+			width: 30%;
+		}
+		.scroll {
+			overflow: auto;
+			height: 40px;
+		}
+		table {
+			display: table;
+		}
+		tr {
+			display: table-row;
+		}
+		td {
+			display: table-cell;
+			padding: 3px;
+		}
+	</style>
+</head>
+
+<body>
+	<div class="flex">
+		<div class="panel">Lorem ipsum dolor sit amet, consectetur adipiscing elit.</div>
+		<div class="panel relative">Sed do eiusmod tempor <span>incididunt</span> ut labore.<div class="absolute">Ut enim ad minim veniam</div></div>
+		<div class="panel">Quis nostrud <div class="absolute">exercitation</div> ullamco laboris.</div>
+		<div class="panel scroll">Duis aute irure dolor in reprehenderit in voluptate velit esse cillum dolore eu fugiat nulla pariatur.</div>
+		<div class="panel">
+			<table>
+				<tr><td>Excepteur sint</td><td>occaecat cupidatat</td></tr>
+				<tr><td>non proident,</td><td>sunt in culpa qui officia deserunt mollit anim id est laborum.</td></tr>
+			</table>
+		</div>
+	</div>
+	<div class="relative">
+		<div class="absolute">First</div>
+		<div class="absolute" style="left: 5px">Second <div class="relative">nested</div></div>
+	</div>
+</body>
+</rml>
+)";
+
+class ThreadedTaskScheduler : public TaskSchedulerInterface {
+public:
+	void RunTasks(int num_tasks, const Function<void(int)>& task) override
+	{
+		num_batches += 1;
+		num_tasks_run += num_tasks;
+
+		Vector<std::thread> threads;
+		for (int i = 0; i < num_tasks; i++)
+			threads.emplace_back(task, i);
+		for (std::thread& thread : threads)
+			thread.join();
+	}
+
+	int num_batches = 0;
+	int num_tasks_run = 0;
+};
+
+static void GetLayoutResults(Element* element, Vector<Vector2f>& results)
+{
+	results.push_back(element->GetAbsoluteOffset(BoxArea::Border));
+	results.push_back(element->GetBox().GetSize(BoxArea::Border));
+	for (int i = 0; i < element->GetNumChildren(); i++)
+		GetLayoutResults(element->GetChild(i), results);
+}
+
+static Vector<Vector2f> LoadDocumentAndGetLayoutResults(Context* context, const String& rml)
+{
+	ElementDocument* document = context->LoadDocumentFromMemory(rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	Vector<Vector2f> results;
+	GetLayoutResults(document, results);
+
+	// Force a new layout with a different width, and then return to the original width.
+	document->SetProperty("width", "450px");
+	TestsShell::RenderLoop();
+	document->SetProperty("width", "600px");
+	TestsShell::RenderLoop();
+
+	Vector<Vector2f> results_relayout;
+	GetLayoutResults(document, results_relayout);
+	CHECK(results == results_relayout);
+
+	document->Close();
+	context->Update();
+	return results;
+}
+
+TEST_CASE("Layout.Parallel")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	const Vector<Vector2f> serial_results = LoadDocumentAndGetLayoutResults(context, document_layout_rml_parallel);
+	REQUIRE(!serial_results.empty());
+
+	ThreadedTaskScheduler task_scheduler;
+	SetTaskSchedulerInterface(&task_scheduler);
+
+	const Vector<Vector2f> parallel_results = LoadDocumentAndGetLayoutResults(context, document_layout_rml_parallel);
+
+	SetTaskSchedulerInterface(nullptr);
+
+	CHECK(task_scheduler.num_batches > 0);
+	CHECK(task_scheduler.num_tasks_run > task_scheduler.num_batches);
+
+	REQUIRE(parallel_results.size() == serial_results.size());
+	for (size_t i = 0; i < serial_results.size(); i++)
+	{
+		INFO("Result index ", i);
+		CHECK(parallel_results[i] == serial_results[i]);
+	}
+
+	TestsShell::ShutdownShell();
+}
@@ -0,0 +1,335 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Types.h>
+#include <RmlUi/Core/Vertex.h>
+#include <RmlUi_Renderer_Software.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static void MakeQuad(Vertex vertices[4], int indices[6], Vector2f origin, Vector2f size, Colourb colour)
+{
+	const Vector2f corners[4] = {origin, origin + Vector2f(size.x, 0), origin + size, origin + Vector2f(0, size.y)};
+	const Vector2f tex_coords[4] = {Vector2f(0, 0), Vector2f(1, 0), Vector2f(1, 1), Vector2f(0, 1)};
+	for (int i = 0; i < 4; i++)
+		vertices[i] = Vertex{corners[i], colour, tex_coords[i]};
+
+	const int quad_indices[6] = {0, 1, 2, 0, 2, 3};
+	for (int i = 0; i < 6; i++)
+		indices[i] = quad_indices[i];
+}
+
+static Colourb GetPixel(const RenderInterface_Software& renderer, int x, int y)
+{
+	const byte* pixel = renderer.GetFramebuffer() + 4 * (y * renderer.GetViewportDimensions().x + x);
+	return Colourb(pixel[0], pixel[1], pixel[2], pixel[3]);
+}
+
+TEST_CASE("RendererSoftware.coverage")
+{
+	RenderInterface_Software renderer(64, 32);
+	renderer.BeginFrame();
+
+	Vertex vertices[4];
+	int indices[6];
+
+	SUBCASE("quad")
+	{
+		MakeQuad(vertices, indices, Vector2f(10, 5), Vector2f(20, 10), Colourb(255, 0, 0, 255));
+		renderer.RenderGeometry(vertices, 4, indices, 6, {}, Vector2f(0, 0));
+
+		// The two triangles of the quad share a diagonal, every pixel should be filled exactly once.
+		const auto& statistics = renderer.GetStatistics();
+		CHECK(statistics.draw_calls == 1);
+		CHECK(statistics.triangles == 2);
+		CHECK(statistics.pixels_filled == 20 * 10);
+		CHECK(statistics.pixels_overdrawn == 0);
+
+		CHECK(GetPixel(renderer, 10, 5) == Colourb(255, 0, 0, 255));
+		CHECK(GetPixel(renderer, 29, 14) == Colourb(255, 0, 0, 255));
+		CHECK(GetPixel(renderer, 9, 5) == Colourb(0, 0, 0, 0));
+		CHECK(GetPixel(renderer, 30, 14) == Colourb(0, 0, 0, 0));
+		CHECK(GetPixel(renderer, 29, 15) == Colourb(0, 0, 0, 0));
+	}
+
+	SUBCASE("adjacent_quads")
+	{
+		// Quads sharing edges at fractional positions should still not overlap nor leave gaps.
+		for (int i = 0; i < 4; i++)
+		{
+			MakeQuad(vertices, indices, Vector2f(2.3f + 7.7f * i, 1.6f), Vector2f(7.7f, 20.5f), Colourb(0, 255, 0, 255));
+			renderer.RenderGeometry(vertices, 4, indices, 6, {}, Vector2f(0, 0));
+		}
+
+		const auto& statistics = renderer.GetStatistics();
+		CHECK(statistics.draw_calls == 4);
+		CHECK(statistics.pixels_overdrawn == 0);
+
+		for (int x = 3; x < 33; x++)
+			CHECK(renderer.GetPixelWriteCount(x, 10) == 1);
+	}
+
+	SUBCASE("overdraw")
+	{
+		MakeQuad(vertices, indices, Vector2f(0, 0), Vector2f(8, 8), Colourb(255, 255, 255, 255));
+		renderer.RenderGeometry(vertices, 4, indices, 6, {}, Vector2f(0, 0));
+		renderer.RenderGeometry(vertices, 4, indices, 6, {}, Vector2f(4, 4));
+
+		const auto& statistics = renderer.GetStatistics();
+		CHECK(statistics.pixels_filled == 2 * 64);
+		CHECK(statistics.pixels_overdrawn == 16);
+		CHECK(renderer.GetPixelWriteCount(5, 5) == 2);
+		CHECK(renderer.GetPixelWriteCount(1, 1) == 1);
+		CHECK(renderer.GetPixelWriteCount(10, 10) == 1);
+	}
+
+	SUBCASE("scissor")
+	{
+		MakeQuad(vertices, indices, Vector2f(0, 0), Vector2f(64, 32), Colourb(0, 0, 255, 255));
+		renderer.EnableScissorRegion(true);
+		renderer.SetScissorRegion(4, 6, 10, 5);
+		renderer.RenderGeometry(vertices, 4, indices, 6, {}, Vector2f(0, 0));
+
+		CHECK(renderer.GetStatistics().pixels_filled == 10 * 5);
+		CHECK(GetPixel(renderer, 4, 6) == Colourb(0, 0, 255, 255));
+		CHECK(GetPixel(renderer, 13, 10) == Colourb(0, 0, 255, 255));
+		CHECK(GetPixel(renderer, 14, 10) == Colourb(0, 0, 0, 0));
+		CHECK(GetPixel(renderer, 4, 5) == Colourb(0, 0, 0, 0));
+	}
+
+	SUBCASE("blending")
+	{
+		MakeQuad(vertices, indices, Vector2f(0, 0), Vector2f(4, 4), Colourb(255, 255, 255, 255));
+		renderer.RenderGeometry(vertices, 4, indices, 6, {}, Vector2f(0, 0));
+		MakeQuad(vertices, indices, Vector2f(0, 0), Vector2f(4, 4), Colourb(0, 0, 0, 128));
+		renderer.RenderGeometry(vertices, 4, indices, 6, {}, Vector2f(0, 0));
+
+		const Colourb pixel = GetPixel(renderer, 1, 1);
+		CHECK(pixel.red == 127);
+		CHECK(pixel.alpha == 191);
+	}
+
+	SUBCASE("texture")
+	{
+		const byte texels[2 * 1 * 4] = {255, 0, 0, 255, 0, 0, 255, 255};
+		TextureHandle texture = {};
+		REQUIRE(renderer.GenerateTexture(texture, texels, Vector2i(2, 1)));
+
+		MakeQuad(vertices, indices, Vector2f(0, 0), Vector2f(8, 2), Colourb(255, 255, 255, 255));
+		CompiledGeometryHandle geometry = renderer.CompileGeometry(vertices, 4, indices, 6, texture);
+		renderer.RenderCompiledGeometry(geometry, Vector2f(0, 0));
+
+		CHECK(GetPixel(renderer, 0, 0) == Colourb(255, 0, 0, 255));
+		CHECK(GetPixel(renderer, 7, 1) == Colourb(0, 0, 255, 255));
+
+		renderer.ReleaseCompiledGeometry(geometry);
+		renderer.ReleaseTexture(texture);
+	}
+
+	SUBCASE("distance_field")
+	{
+		// A horizontal ramp of distances with the edge at the center of texel 8, which is magnified onto pixel 34 of the quad.
+		byte texels[16 * 4];
+		for (int i = 0; i < 16; i++)
+		{
+			texels[4 * i + 0] = texels[4 * i + 1] = texels[4 * i + 2] = 255;
+			texels[4 * i + 3] = byte(128 + (i - 8) * 16);
+		}
+		TextureHandle texture = {};
+		REQUIRE(renderer.GenerateDistanceFieldTexture(texture, texels, Vector2i(16, 1)));
+
+		MakeQuad(vertices, indices, Vector2f(0, 0), Vector2f(64, 4), Colourb(255, 255, 255, 255));
+		renderer.RenderGeometry(vertices, 4, indices, 6, texture, Vector2f(0, 0));
+
+		// The edge should be a sharp transition about one pixel wide, instead of being interpolated across the magnified texels.
+		CHECK(GetPixel(renderer, 31, 1).red == 0);
+		CHECK(GetPixel(renderer, 33, 1).red < GetPixel(renderer, 34, 1).red);
+		CHECK(GetPixel(renderer, 36, 1).red == 255);
+
+		renderer.ReleaseTexture(texture);
+	}
+}
+
+TEST_CASE("RendererSoftware.state_changes")
+{
+	RenderInterface_Software renderer(16, 16);
+	renderer.BeginFrame();
+
+	Vertex vertices[4];
+	int indices[6];
+	MakeQuad(vertices, indices, Vector2f(0, 0), Vector2f(4, 4), Colourb(255, 255, 255, 255));
+
+	const byte texel[4] = {255, 255, 255, 255};
+	TextureHandle texture = {};
+	REQUIRE(renderer.GenerateTexture(texture, texel, Vector2i(1, 1)));
+
+	const auto& statistics = renderer.GetStatistics();
+
+	// The first draw always changes state, consecutive draws with the same state do not.
+	renderer.RenderGeometry(vertices, 4, indices, 6, {}, Vector2f(0, 0));
+	renderer.RenderGeometry(vertices, 4, indices, 6, {}, Vector2f(4, 0));
+	CHECK(statistics.state_changes == 1);
+
+	renderer.RenderGeometry(vertices, 4, indices, 6, texture, Vector2f(8, 0));
+	renderer.RenderGeometry(vertices, 4, indices, 6, texture, Vector2f(12, 0));
+	CHECK(statistics.state_changes == 2);
+
+	renderer.EnableScissorRegion(true);
+	renderer.SetScissorRegion(0, 0, 8, 8);
+	renderer.RenderGeometry(vertices, 4, indices, 6, texture, Vector2f(0, 4));
+	CHECK(statistics.state_changes == 3);
+
+	renderer.SetScissorRegion(0, 0, 8, 8);
+	renderer.RenderGeometry(vertices, 4, indices, 6, texture, Vector2f(4, 4));
+	CHECK(statistics.state_changes == 3);
+	CHECK(statistics.draw_calls == 6);
+
+	renderer.ReleaseTexture(texture);
+}
+
+TEST_CASE("RendererSoftware.context")
+{
+	TestsShell::ShutdownShell();
+	TestsShell::UseSoftwareRenderer();
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	RenderInterface_Software* renderer = TestsShell::GetSoftwareRenderInterface();
+	REQUIRE(renderer);
+	CHECK(TestsShell::GetTestsRenderInterface() == nullptr);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(R"(
+<rml>
+<head>
+	<style>
+		body { width: 100px; height: 50px; background-color: #f00; }
+		div { display: block; margin: 10px; height: 20px; background-color: #00ff0080; }
+	</style>
+</head>
+<body><div/></body>
+</rml>
+)");
+	REQUIRE(document);
+	document->Show();
+
+	TestsShell::RenderLoop();
+
+	const auto& statistics = renderer->GetStatistics();
+	CHECK(statistics.draw_calls >= 2);
+	CHECK(statistics.pixels_filled == 100 * 50 + 80 * 20);
+	CHECK(statistics.pixels_overdrawn == 80 * 20);
+
+	const Colourb body_pixel = GetPixel(*renderer, 5, 5);
+	CHECK(body_pixel == Colourb(255, 0, 0, 255));
+	const Colourb div_pixel = GetPixel(*renderer, 50, 20);
+	CHECK(div_pixel.red == 127);
+	CHECK(div_pixel.green == 128);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_distance_field_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; font-size: 16px; color: #000; background-color: #fff; width: 400px; height: 100px; }
+	</style>
+</head>
+<body>Distance field text</body>
+</rml>
+)";
+
+// Renders the text at each font size, returning the total amount of ink, and the number of glyphs rasterized for each size.
+static void RenderText(bool distance_field, const Vector<int>& font_sizes, Vector<int64_t>& out_ink, Vector<int>& out_glyphs_rasterized)
+{
+	TestsShell::ShutdownShell();
+	TestsShell::UseSoftwareRenderer();
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+	Rml::SetFontDistanceFieldRendering(distance_field);
+
+	RenderInterface_Software* renderer = TestsShell::GetSoftwareRenderInterface();
+	ElementDocument* document = context->LoadDocumentFromMemory(document_distance_field_rml);
+	REQUIRE(document);
+	document->Show();
+
+	for (int font_size : font_sizes)
+	{
+		document->SetProperty("font-size", CreateString(16, "%dpx", font_size));
+		TestsShell::RenderLoop();
+
+		int64_t ink = 0;
+		for (int y = 0; y < 100; y++)
+			for (int x = 0; x < 400; x++)
+				ink += 255 - GetPixel(*renderer, x, y).red;
+
+		// Statistics of a frame are made available at the start of the next update.
+		context->Update();
+		out_ink.push_back(ink);
+		out_glyphs_rasterized.push_back(context->GetFrameStatistics().glyphs_rasterized);
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("RendererSoftware.distance_field_text")
+{
+	const Vector<int> font_sizes = {16, 37};
+
+	Vector<int64_t> bitmap_ink, distance_field_ink;
+	Vector<int> bitmap_glyphs_rasterized, distance_field_glyphs_rasterized;
+	RenderText(false, font_sizes, bitmap_ink, bitmap_glyphs_rasterized);
+	RenderText(true, font_sizes, distance_field_ink, distance_field_glyphs_rasterized);
+
+	// Each new font size rasterizes the glyphs again, unless they are rendered from the distance fields of the face.
+	CHECK(bitmap_glyphs_rasterized[1] > 0);
+	CHECK(distance_field_glyphs_rasterized[1] == 0);
+
+	// The text should cover about the same area in both modes.
+	for (size_t i = 0; i < font_sizes.size(); i++)
+	{
+		INFO("Font size: ", font_sizes[i]);
+		REQUIRE(bitmap_ink[i] > 0);
+		const double ratio = double(distance_field_ink[i]) / double(bitmap_ink[i]);
+		CHECK(ratio > 0.85);
+		CHECK(ratio < 1.2);
+	}
+
+	Rml::SetFontDistanceFieldRendering(false);
+}